@@ -0,0 +1,249 @@
+//
+// File: Benchmark.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <new>
+
+
+Benchmark::AllocationCounters& Benchmark::allocationCounters()
+/**
+Returns the process wide allocation counters.
+These are updated by the global operator new replacements below.
+
+@return: AllocationCounters
+*/
+{
+
+	static AllocationCounters counters;
+	return counters;
+
+};
+
+
+void* operator new(std::size_t size)
+{
+
+	Benchmark::AllocationCounters& counters = Benchmark::allocationCounters();
+	counters.allocations.fetch_add(1, std::memory_order_relaxed);
+	counters.bytes.fetch_add(size, std::memory_order_relaxed);
+
+	void* pointer = std::malloc(size == 0 ? 1 : size);
+
+	if (pointer == nullptr)
+	{
+
+		throw std::bad_alloc();
+
+	}
+
+	return pointer;
+
+};
+
+
+void* operator new[](std::size_t size)
+{
+
+	return ::operator new(size);
+
+};
+
+
+void operator delete(void* pointer) noexcept { std::free(pointer); };
+void operator delete[](void* pointer) noexcept { std::free(pointer); };
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); };
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); };
+
+
+Benchmark::Runner::Runner(int argc, char** argv)
+/**
+Constructor.
+Supported arguments are `--filter <substring>` and `--min-time <seconds>`.
+
+@param argc: Number of command line arguments.
+@param argv: Command line arguments.
+*/
+{
+
+	this->minimumSeconds = 0.2;
+
+	for (int i = 1; i < argc; i++)
+	{
+
+		if (std::strcmp(argv[i], "--filter") == 0 && (i + 1) < argc)
+		{
+
+			this->filter = argv[++i];
+
+		}
+		else if (std::strcmp(argv[i], "--min-time") == 0 && (i + 1) < argc)
+		{
+
+			this->minimumSeconds = std::atof(argv[++i]);
+
+		}
+
+	}
+
+	// Print header
+	//
+	std::printf("benchmark\tsize\titerations\tns_per_op\tbytes_per_op\tallocs_per_op\titems_per_sec\n");
+
+};
+
+
+bool Benchmark::Runner::matches(const std::string& name) const
+/**
+Evaluates if the supplied case name passes the command line filter.
+
+@param name: The case name.
+@return: bool
+*/
+{
+
+	return this->filter.empty() || name.find(this->filter) != std::string::npos;
+
+};
+
+
+void Benchmark::Runner::run(const std::string& name, const uint64_t size, const uint64_t itemsPerOp, const std::function<void()>& function)
+/**
+Times the supplied function until the minimum time has elapsed and prints a tab separated result row.
+A single warm up call is made first so that lazily initialized state is excluded from the measurement.
+
+@param name: The case name.
+@param size: The problem size, usually the number of points or subdivisions.
+@param itemsPerOp: The number of items processed per call, used for throughput.
+@param function: The function to time.
+@return: void
+*/
+{
+
+	if (!this->matches(name))
+	{
+
+		return;
+
+	}
+
+	using Clock = std::chrono::steady_clock;
+
+	function();
+
+	// Grow the batch size until the minimum time is reached
+	//
+	AllocationCounters& counters = Benchmark::allocationCounters();
+
+	uint64_t iterations = 1;
+	double elapsed = 0.0;
+	uint64_t allocations = 0, bytes = 0;
+
+	while (true)
+	{
+
+		uint64_t startAllocations = counters.allocations.load(std::memory_order_relaxed);
+		uint64_t startBytes = counters.bytes.load(std::memory_order_relaxed);
+		Clock::time_point start = Clock::now();
+
+		for (uint64_t i = 0; i < iterations; i++)
+		{
+
+			function();
+
+		}
+
+		elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		allocations = counters.allocations.load(std::memory_order_relaxed) - startAllocations;
+		bytes = counters.bytes.load(std::memory_order_relaxed) - startBytes;
+
+		if (elapsed >= this->minimumSeconds || iterations >= (uint64_t(1) << 40))
+		{
+
+			break;
+
+		}
+
+		iterations *= (elapsed > 0.0 && elapsed * 10.0 < this->minimumSeconds) ? 10 : 2;
+
+	}
+
+	// Record and print result
+	//
+	Result result;
+	result.name = name;
+	result.size = size;
+	result.iterations = iterations;
+	result.nanosecondsPerOp = (elapsed * 1e9) / static_cast<double>(iterations);
+	result.bytesPerOp = static_cast<double>(bytes) / static_cast<double>(iterations);
+	result.allocationsPerOp = static_cast<double>(allocations) / static_cast<double>(iterations);
+	result.itemsPerSecond = (elapsed > 0.0) ? (static_cast<double>(itemsPerOp) * static_cast<double>(iterations)) / elapsed : 0.0;
+
+	std::printf("%s\t%llu\t%llu\t%.1f\t%.1f\t%.2f\t%.0f\n", result.name.c_str(), static_cast<unsigned long long>(result.size), static_cast<unsigned long long>(result.iterations), result.nanosecondsPerOp, result.bytesPerOp, result.allocationsPerOp, result.itemsPerSecond);
+	std::fflush(stdout);
+
+	this->completed.push_back(result);
+
+};
+
+
+void Benchmark::Runner::runAllocationFree(const std::string& name, const uint64_t size, const uint64_t itemsPerOp, const std::function<void()>& function)
+/**
+Times the supplied function like run() and records a failure if any call after the warm up allocates.
+Use this for steady state paths that are expected to reuse their buffers.
+
+@param name: The case name.
+@param size: The problem size, usually the number of points or subdivisions.
+@param itemsPerOp: The number of items processed per call, used for throughput.
+@param function: The function to time.
+@return: void
+*/
+{
+
+	size_t numCompleted = this->completed.size();
+	this->run(name, size, itemsPerOp, function);
+
+	if (this->completed.size() == numCompleted)
+	{
+
+		return;
+
+	}
+
+	const Result& result = this->completed.back();
+
+	if (result.allocationsPerOp > 0.0)
+	{
+
+		std::fprintf(stderr, "%s: expected no allocations once warmed up, got %.2f per op\n", result.name.c_str(), result.allocationsPerOp);
+		this->failures.push_back(result);
+
+	}
+
+};
+
+
+int Benchmark::Runner::finish()
+/**
+Returns the process exit code once all cases have run.
+This is non-zero if any allocation free case allocated.
+
+@return: int
+*/
+{
+
+	if (!this->failures.empty())
+	{
+
+		std::fprintf(stderr, "%zu allocation free case(s) allocated\n", this->failures.size());
+		return 1;
+
+	}
+
+	return 0;
+
+};
@@ -0,0 +1,96 @@
+#ifndef _POINT_HELPER_BENCHMARK
+#define _POINT_HELPER_BENCHMARK
+//
+// File: Benchmark.h
+//
+// Author: Ben Singleton
+//
+// Minimal timing harness used by the benchmark executable.
+// Every case reports nanoseconds, bytes allocated and allocations per operation plus throughput.
+// Cases run through runAllocationFree() fail the executable if they allocate once warmed up.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+namespace Benchmark
+{
+
+	struct AllocationCounters
+	{
+
+		std::atomic<uint64_t>	allocations{ 0 };
+		std::atomic<uint64_t>	bytes{ 0 };
+
+	};
+
+	AllocationCounters&	allocationCounters();
+
+
+	template<typename T>
+	inline void doNotOptimize(const T& value)
+	/**
+	Prevents the compiler from discarding a value that is otherwise unused.
+
+	@param value: The value to keep alive.
+	@return: void
+	*/
+	{
+
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+
+	};
+
+
+	struct Result
+	{
+
+		std::string		name;
+		uint64_t		size;
+		uint64_t		iterations;
+		double			nanosecondsPerOp;
+		double			bytesPerOp;
+		double			allocationsPerOp;
+		double			itemsPerSecond;
+
+	};
+
+
+	class Runner
+	{
+
+	public:
+
+						Runner(int argc, char** argv);
+
+				void	run(const std::string& name, const uint64_t size, const uint64_t itemsPerOp, const std::function<void()>& function);
+				void	runAllocationFree(const std::string& name, const uint64_t size, const uint64_t itemsPerOp, const std::function<void()>& function);
+				int		finish();
+
+		const std::vector<Result>&	results() const { return this->completed; };
+
+	private:
+
+				bool	matches(const std::string& name) const;
+
+				std::string			filter;
+				double				minimumSeconds;
+				std::vector<Result>	completed;
+				std::vector<Result>	failures;
+
+	};
+
+};
+#endif
@@ -0,0 +1,1160 @@
+//
+// File: DrawableBenchmark.cpp
+//
+// Author: Ben Singleton
+//
+// Microbenchmarks for the Drawable geometry core.
+// Each case runs at the subdivision counts shipped with the drawables and at scaled-up sizes.
+//
+
+#include "Benchmark.h"
+#include "DrawableCore.h"
+#include "DrawableIO.h"
+#include "DrawableLibrary.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+using namespace Drawable::Core;
+namespace IO = Drawable::IO;
+namespace Library = Drawable::Library;
+
+
+namespace
+{
+
+	const int SCALES[] = { 1, 4, 16 };
+
+	const int SPHERE_SUBDIVISIONS = 40;
+	const int CYLINDER_SUBDIVISIONS = 40;
+	const int DISC_SUBDIVISIONS = 32;
+	const int SECTOR_SUBDIVISIONS = 40;
+
+
+	std::string caseName(const char* name, const int scale)
+	/**
+	Returns the case name for the supplied scale.
+
+	@param name: The base name.
+	@param scale: The subdivision scale.
+	@return: The case name.
+	*/
+	{
+
+		return std::string(name) + "/x" + std::to_string(scale);
+
+	};
+
+
+	Matrix objectMatrix()
+	/**
+	Returns a representative object matrix: a size of 10 with a small local rotation and offset.
+
+	@return: Matrix
+	*/
+	{
+
+		return createScaleMatrix(10.0, 10.0, 10.0) * createRotationMatrix(0.1, 0.2, 0.3) * createPositionMatrix(1.0, 2.0, 3.0);
+
+	};
+
+
+	void benchmarkCurves(Benchmark::Runner& runner)
+	/**
+	Benchmarks the line strip routines used by the wireframe drawables.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const VectorD center(0.0, 0.0, 0.0);
+		const VectorD normal(0.0, 1.0, 0.0);
+
+		for (int scale : SCALES)
+		{
+
+			const int numPoints = (SPHERE_SUBDIVISIONS * scale) + 1;
+
+			runner.run(caseName("arc", scale), numPoints, numPoints, [&]()
+			{
+
+				std::vector<PointD> points = arc(center, normal, 0.5, 10.0, 350.0, numPoints);
+				Benchmark::doNotOptimize(points.data());
+
+			});
+
+			std::vector<PointD> storage(numPoints);
+
+			runner.run(caseName("arc_into", scale), numPoints, numPoints, [&]()
+			{
+
+				arc(center, normal, 0.5, 10.0, 350.0, PointSpan<double>(storage));
+				Benchmark::doNotOptimize(storage.data());
+
+			});
+
+			runner.run(caseName("circle", scale), numPoints, numPoints, [&]()
+			{
+
+				std::vector<PointD> points = circle(center, normal, 0.5, numPoints);
+				Benchmark::doNotOptimize(points.data());
+
+			});
+
+			std::vector<PointD> strip = circle(center, normal, 0.5, numPoints);
+
+			runner.run(caseName("stagger", scale), numPoints, numPoints, [&]()
+			{
+
+				std::vector<PointD> lines = stagger(strip);
+				Benchmark::doNotOptimize(lines.data());
+
+			});
+
+			std::vector<std::vector<PointD>> strips(3, strip);
+
+			runner.run(caseName("stagger_multi", scale), numPoints * 3, numPoints * 3, [&]()
+			{
+
+				std::vector<PointD> lines = stagger(strips);
+				Benchmark::doNotOptimize(lines.data());
+
+			});
+
+			runner.run(caseName("chain", scale), numPoints * 3, numPoints * 3, [&]()
+			{
+
+				std::vector<PointD> points = chain(strips);
+				Benchmark::doNotOptimize(points.data());
+
+			});
+
+			// Tessellate a circle the way connected nurbs curves are, one segment per span
+			//
+			const double radius = 10.0 * scale;
+			const size_t numSpans = 8 * scale;
+
+			auto evaluate = [radius](const double parameter)
+			{
+
+				return PointD(radius * std::cos(parameter), 0.0, radius * std::sin(parameter));
+
+			};
+
+			std::vector<PointD> tessellated;
+
+			runner.run(caseName("tessellate", scale), numSpans, numSpans, [&]()
+			{
+
+				tessellated.clear();
+				tessellateCurve(evaluate, 0.0, 2.0 * PI, numSpans * 2, 1e-3 * radius, 8, tessellated);
+				Benchmark::doNotOptimize(tessellated.data());
+
+			});
+
+		}
+
+	};
+
+
+	void benchmarkTransforms(Benchmark::Runner& runner)
+	/**
+	Benchmarks point transformation in both precisions.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const Matrix matrix = objectMatrix();
+
+		for (int scale : SCALES)
+		{
+
+			// Size the buffers after the sphere's triangle list
+			//
+			const size_t numPoints = size_t(SPHERE_SUBDIVISIONS * scale) * size_t(SPHERE_SUBDIVISIONS * scale) * 6;
+
+			std::vector<PointD> source(numPoints, PointD(0.25, 0.5, 0.75));
+			std::vector<PointD> inPlace = source;
+			std::vector<PointD> outputD(numPoints);
+			std::vector<PointF> outputF(numPoints);
+
+			runner.run(caseName("transform_inplace", scale), numPoints, numPoints, [&]()
+			{
+
+				transform(matrix, PointSpan<double>(inPlace));
+				Benchmark::doNotOptimize(inPlace.data());
+
+			});
+
+			runner.run(caseName("transform_double", scale), numPoints, numPoints, [&]()
+			{
+
+				transform(matrix, ConstPointSpan<double>(source.data(), source.size()), PointSpan<double>(outputD));
+				Benchmark::doNotOptimize(outputD.data());
+
+			});
+
+			runner.run(caseName("transform_float", scale), numPoints, numPoints, [&]()
+			{
+
+				transform(matrix, ConstPointSpan<double>(source.data(), source.size()), PointSpan<float>(outputF));
+				Benchmark::doNotOptimize(outputF.data());
+
+			});
+
+			runner.run(caseName("transform_affine", scale), numPoints, numPoints, [&]()
+			{
+
+				transformAffine(matrix, ConstPointSpan<double>(source.data(), source.size()), PointSpan<double>(outputD));
+				Benchmark::doNotOptimize(outputD.data());
+
+			});
+
+		}
+
+	};
+
+
+	void benchmarkPrimitives(Benchmark::Runner& runner)
+	/**
+	Benchmarks the primitive mesh builders.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const VectorD center(0.0, 0.0, 0.0);
+		const VectorD xAxis(1.0, 0.0, 0.0);
+
+		for (int scale : SCALES)
+		{
+
+			const int sphereSubdivisions = SPHERE_SUBDIVISIONS * scale;
+
+			// The scaled-up sphere is quadratic in the subdivisions so only run the first two sizes
+			//
+			if (scale <= 4)
+			{
+
+				runner.run(caseName("sphere", scale), sphereSubdivisions, size_t(sphereSubdivisions) * size_t(sphereSubdivisions), [&]()
+				{
+
+					Mesh mesh;
+					sphere(center, 0.5, sphereSubdivisions, sphereSubdivisions, mesh);
+					Benchmark::doNotOptimize(mesh.points.data());
+
+				});
+
+			}
+
+			const int cylinderSubdivisions = CYLINDER_SUBDIVISIONS * scale;
+
+			runner.run(caseName("cylinder", scale), cylinderSubdivisions, cylinderSubdivisions * 3, [&]()
+			{
+
+				Mesh mesh;
+				cylinder(center, xAxis, 0.5, 1.0, cylinderSubdivisions, mesh);
+				Benchmark::doNotOptimize(mesh.points.data());
+
+			});
+
+			const int discSubdivisions = DISC_SUBDIVISIONS * scale;
+
+			runner.run(caseName("disc", scale), discSubdivisions, discSubdivisions, [&]()
+			{
+
+				Mesh mesh;
+				disc(center, xAxis, 0.5, discSubdivisions, mesh);
+				Benchmark::doNotOptimize(mesh.points.data());
+
+			});
+
+			const int sectorSubdivisions = SECTOR_SUBDIVISIONS * scale;
+
+			runner.run(caseName("sector", scale), sectorSubdivisions, sectorSubdivisions, [&]()
+			{
+
+				Mesh mesh;
+				sector(center, xAxis, 0.5, 10.0, 350.0, sectorSubdivisions, mesh);
+				Benchmark::doNotOptimize(mesh.points.data());
+
+			});
+
+		}
+
+	};
+
+
+	void benchmarkExtraction(Benchmark::Runner& runner)
+	/**
+	Benchmarks triangle and line extraction from prebuilt primitives.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const VectorD center(0.0, 0.0, 0.0);
+		const VectorD xAxis(1.0, 0.0, 0.0);
+
+		for (int scale : SCALES)
+		{
+
+			if (scale > 4)
+			{
+
+				continue;
+
+			}
+
+			Mesh sphereMesh;
+			sphere(center, 0.5, SPHERE_SUBDIVISIONS * scale, SPHERE_SUBDIVISIONS * scale, sphereMesh);
+
+			Mesh cylinderMesh;
+			cylinder(center, xAxis, 0.5, 1.0, CYLINDER_SUBDIVISIONS * scale, cylinderMesh);
+
+			Mesh discMesh;
+			disc(center, xAxis, 0.5, DISC_SUBDIVISIONS * scale, discMesh);
+
+			const std::pair<const char*, const Mesh*> meshes[] =
+			{
+				{ "sphere", &sphereMesh },
+				{ "cylinder", &cylinderMesh },
+				{ "disc", &discMesh }
+			};
+
+			for (const std::pair<const char*, const Mesh*>& item : meshes)
+			{
+
+				const Mesh& mesh = *item.second;
+				const std::string name(item.first);
+
+				std::vector<PointD> triangles, lines;
+				std::vector<VectorD> normals;
+
+				getTriangles(mesh, triangles, normals);
+
+				runner.run(caseName(("triangles_" + name).c_str(), scale), mesh.numPolygons(), triangles.size(), [&]()
+				{
+
+					getTriangles(mesh, triangles, normals);
+					Benchmark::doNotOptimize(triangles.data());
+
+				});
+
+				runner.run(caseName(("lines_" + name).c_str(), scale), mesh.numPolygons(), mesh.polygonConnects.size(), [&]()
+				{
+
+					getLines(mesh, lines);
+					Benchmark::doNotOptimize(lines.data());
+
+				});
+
+				std::vector<Edge> edges = getEdges(mesh);
+				std::vector<int> boundary = getBoundary(edges);
+
+				runner.run(caseName(("boundary_lines_" + name).c_str(), scale), boundary.size(), boundary.size() * 2, [&]()
+				{
+
+					getLines(mesh, edges, boundary, lines);
+					Benchmark::doNotOptimize(lines.data());
+
+				});
+
+			}
+
+		}
+
+	};
+
+
+	void benchmarkFrame(Benchmark::Runner& runner)
+	/**
+	Benchmarks a steady state prepare for a fixed layout of helpers.
+	Shapes are extracted once in object space and every frame transforms them into each helper's reused buffers.
+	This mirrors the plugin's prepare path and must not allocate once warmed up.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const VectorD center(0.0, 0.0, 0.0);
+		const VectorD xAxis(1.0, 0.0, 0.0);
+
+		// Extract the shared object space buffers
+		//
+		Mesh sphereMesh, cylinderMesh, discMesh, sectorMesh;
+		sphere(center, 0.5, SPHERE_SUBDIVISIONS, SPHERE_SUBDIVISIONS, sphereMesh);
+		cylinder(center, xAxis, 0.5, 1.0, CYLINDER_SUBDIVISIONS, cylinderMesh);
+		disc(center, xAxis, 0.5, DISC_SUBDIVISIONS, discMesh);
+		sector(center, xAxis, 0.5, 10.0, 350.0, SECTOR_SUBDIVISIONS, sectorMesh);
+
+		MeshBuffers shapes[4];
+		getMeshBuffers(sphereMesh, shapes[0]);
+		getMeshBuffers(cylinderMesh, shapes[1]);
+		getMeshBuffers(discMesh, shapes[2]);
+		getMeshBuffers(sectorMesh, shapes[3]);
+
+		const double CROSS[6][4] =
+		{
+			{ 0.5, 0.0, 0.0, 1.0 }, { -0.5, 0.0, 0.0, 1.0 },
+			{ 0.0, 0.5, 0.0, 1.0 }, { 0.0, -0.5, 0.0, 1.0 },
+			{ 0.0, 0.0, 0.5, 1.0 }, { 0.0, 0.0, -0.5, 1.0 }
+		};
+
+		const int numHelpers[] = { 10, 100 };
+
+		for (int count : numHelpers)
+		{
+
+			// Each helper draws a cross and one of the mesh shapes
+			//
+			std::vector<MeshBuffers> buffers(count);
+			std::vector<std::vector<PointD>> crosses(count);
+
+			size_t numPoints = 0;
+
+			for (int i = 0; i < count; i++)
+			{
+
+				const MeshBuffers& shape = shapes[i % 4];
+				numPoints += shape.triangles.size() + shape.lines.size() + 6;
+
+			}
+
+			uint64_t frame = 0;
+
+			runner.runAllocationFree("frame/helpers_" + std::to_string(count), count, numPoints, [&]()
+			{
+
+				const double size = 1.0 + (static_cast<double>(frame++ % 8) * 0.125);
+
+				for (int i = 0; i < count; i++)
+				{
+
+					const Matrix matrix = createScaleMatrix(size, size, size) * createPositionMatrix(double(i), 0.0, 0.0);
+
+					transform(matrix, shapes[i % 4], buffers[i]);
+					transform(matrix, CROSS, 6, crosses[i]);
+
+				}
+
+				Benchmark::doNotOptimize(buffers.data());
+				Benchmark::doNotOptimize(crosses.data());
+
+			});
+
+		}
+
+	};
+
+
+	void benchmarkArray(Benchmark::Runner& runner)
+	/**
+	Benchmarks the pointHelperArray prepare path: frustum culling followed by one batched append per visible element.
+	Elements are laid out on a grid that straddles the frustum so roughly half of them are culled.
+	The batch is cleared rather than released so a warmed up frame must not allocate.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const VectorD xAxis(1.0, 0.0, 0.0);
+
+		MeshBuffers box, cross;
+
+		Mesh boxMesh;
+		cylinder(VectorD(0.0, 0.0, 0.0), xAxis, 0.5, 1.0, 4, boxMesh);
+		getMeshBuffers(boxMesh, box);
+
+		cross.lines =
+		{
+			PointD(0.5, 0.0, 0.0), PointD(-0.5, 0.0, 0.0),
+			PointD(0.0, 0.5, 0.0), PointD(0.0, -0.5, 0.0),
+			PointD(0.0, 0.0, 0.5), PointD(0.0, 0.0, -0.5)
+		};
+
+		// An orthographic frustum spanning -100 to 100 on every axis
+		//
+		Plane planes[6];
+		frustumPlanes(createScaleMatrix(0.01, 0.01, 0.01), planes);
+
+		const int numElements[] = { 10000, 100000 };
+
+		for (int count : numElements)
+		{
+
+			std::vector<Matrix> matrices(count);
+
+			for (int i = 0; i < count; i++)
+			{
+
+				const double x = static_cast<double>(i % 400) - 200.0;
+				const double z = static_cast<double>((i / 400) % 200) - 100.0;
+
+				matrices[i] = createPositionMatrix(x, 0.0, z);
+
+			}
+
+			std::vector<char> visible(count);
+	
+			runner.runAllocationFree("array/cull_" + std::to_string(count), count, count, [&]()
+			{
+
+				for (int i = 0; i < count; i++)
+				{
+
+					const Matrix& matrix = matrices[i];
+					visible[i] = isSphereVisible(planes, PointD(matrix(3, 0), matrix(3, 1), matrix(3, 2)), boundingRadius(matrix, 0.5));
+
+				}
+
+				Benchmark::doNotOptimize(visible.data());
+
+			});
+
+			MeshBuffers batch;
+			batch.triangles.reserve(size_t(count) * box.triangles.size());
+			batch.normals.reserve(size_t(count) * box.normals.size());
+			batch.lines.reserve(size_t(count) * (box.lines.size() + cross.lines.size()));
+
+			const size_t numPoints = size_t(count) * (box.triangles.size() + box.lines.size() + cross.lines.size());
+
+			runner.runAllocationFree("array/append_" + std::to_string(count), count, numPoints, [&]()
+			{
+
+				batch.triangles.clear();
+				batch.normals.clear();
+				batch.lines.clear();
+
+				for (int i = 0; i < count; i++)
+				{
+
+					appendInstance(matrices[i], box, true, batch);
+					appendInstance(matrices[i], cross, false, batch);
+
+				}
+
+				Benchmark::doNotOptimize(batch.triangles.data());
+				Benchmark::doNotOptimize(batch.lines.data());
+
+			});
+
+		}
+
+	};
+
+
+	void benchmarkImport(Benchmark::Runner& runner)
+	/**
+	Benchmarks streaming helper records from in-memory binary and CSV files.
+	A small chunk size is used so the chunking and carry-over paths are part of every run.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const size_t numRecords = 100000;
+		const size_t chunkSize = 1024 * 1024;
+
+		// Encode binary records
+		//
+		IO::RecordFormat format;
+		format.layout = IO::RecordLayout::Matrix44f;
+		format.shapes = true;
+		format.colors = true;
+
+		std::string binary(numRecords * format.recordSize(), '\0');
+
+		for (size_t i = 0; i < numRecords; i++)
+		{
+
+			float values[20] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, float(i), 0.0f, 0.0f, 1.0f, 0.0f, 0.5f, 0.5f, 0.5f };
+			int32_t mask = 40;
+
+			std::memcpy(&binary[i * format.recordSize()], values, 16 * sizeof(float));
+			std::memcpy(&binary[(i * format.recordSize()) + (16 * sizeof(float))], &mask, sizeof(int32_t));
+			std::memcpy(&binary[(i * format.recordSize()) + (16 * sizeof(float)) + sizeof(int32_t)], values + 17, 3 * sizeof(float));
+
+		}
+
+		// Encode CSV rows
+		//
+		std::ostringstream text;
+		text << "tx,ty,tz,rx,ry,rz,sx,sy,sz,shapes,r,g,b\n";
+
+		for (size_t i = 0; i < numRecords; i++)
+		{
+
+			text << i << ",1.5,-2.25,0,45,90,1,1,1,40,0.5,0.25,1\n";
+
+		}
+
+		const std::string csv = text.str();
+
+		// Each chunk is copied out the way the import command does
+		//
+		IO::HelperRecords records;
+
+		auto consume = [&](const IO::HelperRecords& chunk)
+		{
+
+			records.matrices.insert(records.matrices.end(), chunk.matrices.begin(), chunk.matrices.end());
+			records.shapeMasks.insert(records.shapeMasks.end(), chunk.shapeMasks.begin(), chunk.shapeMasks.end());
+			records.colors.insert(records.colors.end(), chunk.colors.begin(), chunk.colors.end());
+
+		};
+
+		runner.run("import/binary_" + std::to_string(numRecords), numRecords, numRecords, [&]()
+		{
+
+			std::istringstream stream(binary);
+			std::string error;
+
+			records.clear();
+			IO::readBinaryRecords(stream, format, chunkSize, consume, error);
+			Benchmark::doNotOptimize(records.matrices.data());
+
+		});
+
+		runner.run("import/csv_" + std::to_string(numRecords), numRecords, numRecords, [&]()
+		{
+
+			std::istringstream stream(csv);
+			std::string error;
+			size_t numErrors = 0;
+
+			records.clear();
+			IO::readCsvRecords(stream, chunkSize, consume, numErrors, error);
+			Benchmark::doNotOptimize(records.matrices.data());
+
+		});
+
+	};
+
+
+	void benchmarkExport(Benchmark::Runner& runner)
+	/**
+	Benchmarks writing helper records, with and without geometry, to an in-memory file.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const size_t numHelpers = 10000;
+		const size_t chunkSize = 1024 * 1024;
+
+		Mesh mesh;
+		sphere(VectorD(0.0, 0.0, 0.0), 1.0, 12, 8, mesh);
+
+		MeshBuffers geometry;
+		getMeshBuffers(mesh, geometry);
+
+		IO::ExportRecord record;
+		record.shapeFlags = 40;
+		record.size = 10.0;
+
+		runner.run("export/records_" + std::to_string(numHelpers), numHelpers, numHelpers, [&]()
+		{
+
+			std::ostringstream stream;
+			IO::ExportWriter writer(stream, chunkSize);
+
+			writer.begin();
+			record.geometry = nullptr;
+
+			for (size_t i = 0; i < numHelpers; i++)
+			{
+
+				record.helper = static_cast<uint32_t>(writer.addHelper("pointHelper" + std::to_string(i)));
+				writer.write(record);
+
+			}
+
+			writer.finish();
+			Benchmark::doNotOptimize(stream.tellp());
+
+		});
+
+		runner.run("export/geometry_" + std::to_string(numHelpers), numHelpers, numHelpers, [&]()
+		{
+
+			std::ostringstream stream;
+			IO::ExportWriter writer(stream, chunkSize);
+
+			writer.begin();
+			record.geometry = &geometry;
+
+			for (size_t i = 0; i < numHelpers; i++)
+			{
+
+				record.helper = static_cast<uint32_t>(writer.addHelper("pointHelper" + std::to_string(i)));
+				writer.write(record);
+
+			}
+
+			writer.finish();
+			Benchmark::doNotOptimize(stream.tellp());
+
+		});
+
+	};
+
+
+	void benchmarkLibrary(Benchmark::Runner& runner)
+	/**
+	Benchmarks mapping a shape library and looking up and expanding its shapes the way the custom drawable does.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const size_t numShapes = 1000;
+
+		// Bake a sphere into every shape
+		//
+		Mesh mesh;
+		sphere(VectorD(0.0, 0.0, 0.0), 1.0, 12, 8, mesh);
+
+		std::vector<Library::ShapeSource> sources(numShapes);
+		std::vector<std::string> names(numShapes);
+
+		for (size_t i = 0; i < numShapes; i++)
+		{
+
+			names[i] = "control" + std::to_string(i);
+
+			Library::ShapeSource& source = sources[i];
+			source.name = names[i];
+			source.points = mesh.points;
+
+			size_t start = 0;
+
+			for (const int count : mesh.polygonCounts)
+			{
+
+				for (int j = 0; j < count; j++)
+				{
+
+					source.lineIndices.push_back(static_cast<uint32_t>(mesh.polygonConnects[start + j]));
+					source.lineIndices.push_back(static_cast<uint32_t>(mesh.polygonConnects[start + ((j + 1) % count)]));
+
+				}
+
+				start += count;
+
+			}
+
+		}
+
+		const std::string path = (std::filesystem::temp_directory_path() / "DrawableBenchmark.phshape").string();
+		std::string error;
+
+		{
+
+			std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+			Library::writeLibrary(stream, sources, error);
+
+		}
+
+		runner.run("library/open_" + std::to_string(numShapes), numShapes, 1, [&]()
+		{
+
+			Library::ShapeLibrary library;
+			library.open(path, error);
+			Benchmark::doNotOptimize(library.numShapes());
+
+		});
+
+		std::shared_ptr<const Library::ShapeLibrary> library = Library::acquire(path, error);
+
+		if (library == nullptr)
+		{
+
+			return;
+
+		}
+
+		runner.run("library/find_" + std::to_string(numShapes), numShapes, numShapes, [&]()
+		{
+
+			for (const std::string& name : names)
+			{
+
+				Benchmark::doNotOptimize(library->find(name));
+
+			}
+
+		});
+
+		const Library::Shape* shape = library->find(names.front());
+		std::vector<PointD> lines(shape->numLineIndices);
+
+		runner.run("library/expand", shape->numLineIndices, shape->numLineIndices, [&]()
+		{
+
+			for (uint32_t i = 0; i < shape->numLineIndices; i++)
+			{
+
+				const float* point = shape->points + (3 * shape->lineIndices[i]);
+				lines[i] = PointD(point[0], point[1], point[2]);
+
+			}
+
+			Benchmark::doNotOptimize(lines.data());
+
+		});
+
+		library.reset();
+		std::remove(path.c_str());
+
+		// Write the same sphere as an OBJ
+		//
+		std::ostringstream obj;
+
+		for (const PointD& point : mesh.points)
+		{
+
+			obj << "v " << point.x << " " << point.y << " " << point.z << "\n";
+
+		}
+
+		size_t start = 0;
+
+		for (const int count : mesh.polygonCounts)
+		{
+
+			obj << "f";
+
+			for (int j = 0; j < count; j++)
+			{
+
+				obj << " " << (mesh.polygonConnects[start + j] + 1);
+
+			}
+
+			obj << "\n";
+			start += count;
+
+		}
+
+		const std::string text = obj.str();
+		Library::ShapeAsset asset;
+
+		runner.run("library/parse_obj", mesh.points.size(), mesh.points.size(), [&]()
+		{
+
+			std::istringstream stream(text);
+
+			Library::parseObj(stream, asset, error);
+			Benchmark::doNotOptimize(asset.shape.numTriangleIndices);
+
+		});
+
+		// Parse and flatten an icon of filled arcs and curves
+		//
+		std::ostringstream svg;
+		svg << "<svg viewBox=\"0 0 100 100\">\n";
+
+		for (int i = 0; i < 16; i++)
+		{
+
+			const int x = 10 + ((i % 4) * 25);
+			const int y = 10 + ((i / 4) * 25);
+
+			svg << "<path d=\"M" << x << " " << y << " a8 8 0 1 1 0.01 0 z m2 2 c4 -6 8 6 12 0 s8 6 12 0 q-6 8 -12 4 t-12 -4\"/>\n";
+
+		}
+
+		svg << "</svg>\n";
+
+		const std::string icon = svg.str();
+
+		runner.run("library/parse_svg", 16, 16, [&]()
+		{
+
+			std::istringstream stream(icon);
+
+			Library::parseSvg(stream, asset, error);
+			Benchmark::doNotOptimize(asset.shape.numLineIndices);
+
+		});
+
+	};
+
+
+	struct CacheKey
+	{
+
+		uint32_t	drawable;
+		double		matrix[16];
+		uint64_t	source = 0;
+
+		bool operator==(const CacheKey& other) const
+		{
+
+			return this->drawable == other.drawable && this->source == other.source && std::memcmp(this->matrix, other.matrix, sizeof(this->matrix)) == 0;
+
+		};
+
+	};
+
+
+	struct CacheKeyHash
+	{
+
+		size_t operator()(const CacheKey& key) const
+		{
+
+			return static_cast<size_t>(hashBytes(&key.source, sizeof(key.source), hashBytes(key.matrix, sizeof(key.matrix), hashBytes(&key.drawable, sizeof(key.drawable)))));
+
+		};
+
+	};
+
+
+	void benchmarkCache(Benchmark::Runner& runner)
+	/**
+	Benchmarks sharing prepared geometry between helpers with identical inputs, the way the geometry cache does.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const Matrix matrix = objectMatrix();
+		const size_t numHelpers = 1000;
+		const size_t numLooks = 10;
+
+		std::vector<PointD> source(SPHERE_SUBDIVISIONS * SPHERE_SUBDIVISIONS * 6, PointD(0.25, 0.5, 0.75));
+		std::vector<CacheKey> keys(numHelpers);
+
+		for (size_t i = 0; i < numHelpers; i++)
+		{
+
+			keys[i].drawable = 0;
+
+			for (int j = 0; j < 16; j++)
+			{
+
+				keys[i].matrix[j] = matrix(j / 4, j % 4) + static_cast<double>(i % numLooks);
+
+			}
+
+		}
+
+		// Every helper transforms its own copy
+		//
+		runner.run("cache/prepare_each", numHelpers, numHelpers, [&]()
+		{
+
+			std::vector<std::vector<PointD>> outputs(numHelpers, std::vector<PointD>(source.size()));
+
+			for (size_t i = 0; i < numHelpers; i++)
+			{
+
+				transform(matrix, ConstPointSpan<double>(source.data(), source.size()), PointSpan<double>(outputs[i]));
+
+			}
+
+			Benchmark::doNotOptimize(outputs.data());
+
+		});
+
+		// Helpers with the same key share one transformed copy
+		//
+		runner.run("cache/prepare_shared", numHelpers, numHelpers, [&]()
+		{
+
+			SharedCache<CacheKey, std::vector<PointD>, CacheKeyHash> cache(numLooks);
+			std::vector<std::shared_ptr<const std::vector<PointD>>> outputs(numHelpers);
+
+			for (size_t i = 0; i < numHelpers; i++)
+			{
+
+				outputs[i] = cache.find(keys[i]);
+
+				if (outputs[i] == nullptr)
+				{
+
+					std::shared_ptr<std::vector<PointD>> output = std::make_shared<std::vector<PointD>>(source.size());
+					transform(matrix, ConstPointSpan<double>(source.data(), source.size()), PointSpan<double>(*output));
+
+					outputs[i] = cache.insert(keys[i], output);
+
+				}
+
+			}
+
+			Benchmark::doNotOptimize(outputs.data());
+
+		});
+
+		// Instanced helpers drawing their control points, keyed by the generation of each node's points
+		// Each node's points are expanded into segments once, as the node copies them, so only the transform is timed
+		//
+		const size_t numControlPoints = 64;
+		std::vector<std::vector<PointD>> segments(numLooks, std::vector<PointD>((numControlPoints - 1) * 2));
+
+		for (size_t i = 0; i < numLooks; i++)
+		{
+
+			for (size_t j = 0; j < (numControlPoints - 1); j++)
+			{
+
+				segments[i][j * 2] = PointD(static_cast<double>(j), static_cast<double>(i), 0.0);
+				segments[i][(j * 2) + 1] = PointD(static_cast<double>(j + 1), static_cast<double>(i), 0.0);
+
+			}
+
+		}
+
+		std::vector<CacheKey> controlPointKeys(numHelpers);
+
+		for (size_t i = 0; i < numHelpers; i++)
+		{
+
+			controlPointKeys[i].drawable = 1;
+			controlPointKeys[i].source = static_cast<uint64_t>(i % numLooks) + 1;
+
+			for (int j = 0; j < 16; j++)
+			{
+
+				controlPointKeys[i].matrix[j] = matrix(j / 4, j % 4);
+
+			}
+
+		}
+
+		// Every helper transforms its own segments
+		//
+		runner.run("cache/control_points_each", numHelpers, numHelpers, [&]()
+		{
+
+			std::vector<std::vector<PointD>> outputs(numHelpers, std::vector<PointD>(segments[0].size()));
+
+			for (size_t i = 0; i < numHelpers; i++)
+			{
+
+				const std::vector<PointD>& input = segments[i % numLooks];
+				transform(matrix, ConstPointSpan<double>(input.data(), input.size()), PointSpan<double>(outputs[i]));
+
+			}
+
+			Benchmark::doNotOptimize(outputs.data());
+
+		});
+
+		// Instances of the same node share one set of segments
+		//
+		runner.run("cache/control_points_shared", numHelpers, numHelpers, [&]()
+		{
+
+			SharedCache<CacheKey, std::vector<PointD>, CacheKeyHash> cache(numLooks);
+			std::vector<std::shared_ptr<const std::vector<PointD>>> outputs(numHelpers);
+
+			for (size_t i = 0; i < numHelpers; i++)
+			{
+
+				outputs[i] = cache.find(controlPointKeys[i]);
+
+				if (outputs[i] == nullptr)
+				{
+
+					const std::vector<PointD>& input = segments[i % numLooks];
+
+					std::shared_ptr<std::vector<PointD>> output = std::make_shared<std::vector<PointD>>(input.size());
+					transform(matrix, ConstPointSpan<double>(input.data(), input.size()), PointSpan<double>(*output));
+
+					outputs[i] = cache.insert(controlPointKeys[i], output);
+
+				}
+
+			}
+
+			Benchmark::doNotOptimize(outputs.data());
+
+		});
+
+	};
+
+
+	void benchmarkRetained(Benchmark::Runner& runner)
+	/**
+	Benchmarks welding captured triangle and line lists into the indexed buffers uploaded by the retained geometry override.
+
+	@param runner: The benchmark runner.
+	@return: void
+	*/
+	{
+
+		const VectorD center(0.0, 0.0, 0.0);
+
+		for (int scale : SCALES)
+		{
+
+			if (scale > 4)
+			{
+
+				continue;
+
+			}
+
+			Mesh mesh;
+			sphere(center, 0.5, SPHERE_SUBDIVISIONS * scale, SPHERE_SUBDIVISIONS * scale, mesh);
+
+			MeshBuffers buffers;
+			getMeshBuffers(mesh, buffers);
+
+			IndexedBuffers indexed;
+			const size_t numVertices = buffers.triangles.size() + buffers.lines.size();
+
+			runner.run(caseName("index_buffers", scale), numVertices, numVertices, [&]()
+			{
+
+				buildIndexedBuffers(buffers, indexed);
+				Benchmark::doNotOptimize(indexed.positions.data());
+
+			});
+
+		}
+
+	};
+};
+
+
+int main(int argc, char** argv)
+{
+
+	Benchmark::Runner runner(argc, argv);
+
+	benchmarkCurves(runner);
+	benchmarkTransforms(runner);
+	benchmarkPrimitives(runner);
+	benchmarkExtraction(runner);
+	benchmarkFrame(runner);
+	benchmarkArray(runner);
+	benchmarkImport(runner);
+	benchmarkExport(runner);
+	benchmarkLibrary(runner);
+	benchmarkCache(runner);
+	benchmarkRetained(runner);
+
+	return runner.finish();
+
+}
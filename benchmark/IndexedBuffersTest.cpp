@@ -0,0 +1,237 @@
+//
+// File: IndexedBuffersTest.cpp
+//
+// Author: Ben Singleton
+//
+// Behaviour checks for Drawable::Core::buildIndexedBuffers(), which feeds the retained geometry override.
+// Each check prints its name when it fails and the exit code is the number of failed checks.
+//
+
+#include "DrawableCore.h"
+
+#include <cstdio>
+#include <vector>
+
+
+using namespace Drawable::Core;
+
+
+namespace
+{
+
+	int numFailures = 0;
+
+
+	void check(const bool condition, const char* name)
+	/**
+	Records a failed check.
+
+	@param condition: The condition that should hold.
+	@param name: The name of the check.
+	@return: void
+	*/
+	{
+
+		if (!condition)
+		{
+
+			std::printf("FAILED: %s\n", name);
+			numFailures++;
+
+		}
+
+	};
+
+
+	bool indicesInRange(const std::vector<uint32_t>& indices, const IndexedBuffers& buffers)
+	/**
+	Returns whether every index points at a vertex in the supplied buffers.
+
+	@param indices: The indices to check.
+	@param buffers: The buffers the indices point into.
+	@return: bool
+	*/
+	{
+
+		for (uint32_t index : indices)
+		{
+
+			if (index >= buffers.numVertices())
+			{
+
+				return false;
+
+			}
+
+		}
+
+		return true;
+
+	};
+
+
+	MeshBuffers quad()
+	/**
+	Returns a unit quad as two triangles facing +Z, with its outline as lines.
+
+	@return: MeshBuffers
+	*/
+	{
+
+		const PointD a(0.0, 0.0, 0.0), b(1.0, 0.0, 0.0), c(1.0, 1.0, 0.0), d(0.0, 1.0, 0.0);
+		const VectorD up(0.0, 0.0, 1.0);
+
+		MeshBuffers buffers;
+		buffers.triangles = { a, b, c, a, c, d };
+		buffers.normals = { up, up, up, up, up, up };
+		buffers.lines = { a, b, b, c, c, d, d, a };
+
+		return buffers;
+
+	};
+
+
+	void testSharedVertices()
+	/**
+	Triangle vertices with the same position and normal are welded into one vertex.
+	*/
+	{
+
+		IndexedBuffers output;
+		buildIndexedBuffers(quad(), output);
+
+		check(output.numVertices() == 4, "shared vertices are welded");
+		check(output.positions.size() == output.normals.size(), "every vertex has a normal");
+		check(output.triangleIndices.size() == 6, "every triangle vertex is indexed");
+		check(output.triangleIndices[0] == output.triangleIndices[3], "first shared corner uses one index");
+		check(output.triangleIndices[2] == output.triangleIndices[4], "second shared corner uses one index");
+		check(indicesInRange(output.triangleIndices, output), "triangle indices are in range");
+
+	};
+
+
+	void testHardEdges()
+	/**
+	Triangle vertices with the same position but different normals stay separate.
+	*/
+	{
+
+		const PointD a(0.0, 0.0, 0.0), b(1.0, 0.0, 0.0), c(0.0, 1.0, 0.0), d(0.0, 0.0, 1.0);
+		const VectorD front(0.0, 0.0, 1.0), side(0.0, 1.0, 0.0);
+
+		MeshBuffers source;
+		source.triangles = { a, b, c, a, b, d };
+		source.normals = { front, front, front, side, side, side };
+
+		IndexedBuffers output;
+		buildIndexedBuffers(source, output);
+
+		check(output.numVertices() == 6, "hard edges keep their normals");
+		check(output.triangleIndices[0] != output.triangleIndices[3], "hard edge corners use separate indices");
+		check(indicesInRange(output.triangleIndices, output), "hard edge indices are in range");
+
+	};
+
+
+	void testLinesAndTriangles()
+	/**
+	Lines and triangles are indexed into separate lists over one vertex list, and line vertices reuse triangle vertices at the same position.
+	*/
+	{
+
+		MeshBuffers source = quad();
+		source.lines.push_back(PointD(0.0, 0.0, 0.0));
+		source.lines.push_back(PointD(0.0, 0.0, 2.0));
+
+		IndexedBuffers output;
+		buildIndexedBuffers(source, output);
+
+		check(output.triangleIndices.size() == source.triangles.size(), "triangles are indexed on their own");
+		check(output.lineIndices.size() == source.lines.size(), "lines are indexed on their own");
+		check(output.numVertices() == 5, "only the line vertex off the quad is added");
+		check(output.lineIndices[0] == output.triangleIndices[0], "line vertices reuse triangle vertices");
+		check(output.lineIndices[9] == 4, "new line vertices are appended");
+		check(output.normals[12] == 0.0f && output.normals[13] == 0.0f && output.normals[14] == 0.0f, "new line vertices have a zero normal");
+		check(indicesInRange(output.lineIndices, output), "line indices are in range");
+
+	};
+
+
+	void testLinesOnly()
+	/**
+	Lines without triangles leave the triangle list empty and weld their shared end points.
+	*/
+	{
+
+		MeshBuffers source = quad();
+		source.triangles.clear();
+		source.normals.clear();
+
+		IndexedBuffers output;
+		buildIndexedBuffers(source, output);
+
+		check(output.triangleIndices.empty(), "lines alone have no triangle indices");
+		check(output.lineIndices.size() == 8, "every line vertex is indexed");
+		check(output.numVertices() == 4, "line end points are welded");
+
+	};
+
+
+	void testMissingNormals()
+	/**
+	Triangles without matching normals are given zero normals.
+	*/
+	{
+
+		MeshBuffers source = quad();
+		source.normals.clear();
+
+		IndexedBuffers output;
+		buildIndexedBuffers(source, output);
+
+		bool isZero = true;
+
+		for (float value : output.normals)
+		{
+
+			isZero &= (value == 0.0f);
+
+		}
+
+		check(output.numVertices() == 4, "triangles without normals are welded by position");
+		check(isZero, "triangles without normals have zero normals");
+
+	};
+
+
+	void testRebuild()
+	/**
+	Building into populated buffers replaces their contents.
+	*/
+	{
+
+		IndexedBuffers output;
+		buildIndexedBuffers(quad(), output);
+		buildIndexedBuffers(MeshBuffers(), output);
+
+		check(output.numVertices() == 0 && output.normals.empty(), "rebuilding clears the vertices");
+		check(output.lineIndices.empty() && output.triangleIndices.empty(), "rebuilding clears the indices");
+
+	};
+
+};
+
+
+int main()
+{
+
+	testSharedVertices();
+	testHardEdges();
+	testLinesAndTriangles();
+	testLinesOnly();
+	testMissingNormals();
+	testRebuild();
+
+	return numFailures;
+
+}
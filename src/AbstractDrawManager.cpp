@@ -0,0 +1,196 @@
+//
+// File: AbstractDrawManager.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "AbstractDrawManager.h"
+
+using namespace Drawable;
+
+
+AbstractDrawManager::AbstractDrawManager()
+/**
+Constructor.
+*/
+{
+
+	this->resetCounts();
+
+};
+
+
+AbstractDrawManager::~AbstractDrawManager() {};
+
+
+uint64_t AbstractDrawManager::callCount(DrawCall call) const
+/**
+Returns the number of times the supplied call was made since the last reset.
+
+@param call: The draw call type.
+@return: uint64_t
+*/
+{
+
+	return this->calls[static_cast<size_t>(call)];
+
+};
+
+
+uint64_t AbstractDrawManager::totalCalls() const
+/**
+Returns the number of calls of any type made since the last reset.
+
+@return: uint64_t
+*/
+{
+
+	uint64_t total = 0;
+
+	for (uint64_t count : this->calls)
+	{
+
+		total += count;
+
+	}
+
+	return total;
+
+};
+
+
+uint64_t AbstractDrawManager::vertexCount() const
+/**
+Returns the number of vertices submitted since the last reset.
+
+@return: uint64_t
+*/
+{
+
+	return this->vertices;
+
+};
+
+
+uint64_t AbstractDrawManager::primitiveCount() const
+/**
+Returns the number of primitives submitted since the last reset.
+
+@return: uint64_t
+*/
+{
+
+	return this->primitives;
+
+};
+
+
+void AbstractDrawManager::resetCounts()
+/**
+Resets the call, vertex and primitive counters.
+
+@return: void
+*/
+{
+
+	this->vertices = 0;
+	this->primitives = 0;
+
+	for (uint64_t& count : this->calls)
+	{
+
+		count = 0;
+
+	}
+
+};
+
+
+const char* AbstractDrawManager::callName(DrawCall call)
+/**
+Returns the MUIDrawManager method name for the supplied call type.
+
+@param call: The draw call type.
+@return: const char*
+*/
+{
+
+	static const char* names[] =
+	{
+		"beginDrawable", "endDrawable", "beginDrawInXray", "endDrawInXray",
+		"setColor", "setDepthPriority", "setLineWidth", "setLineStyle", "setPaintStyle", "setFontSize",
+		"mesh", "lineList", "line", "sphere", "text", "icon"
+	};
+
+	return (call < DrawCall::Count) ? names[static_cast<size_t>(call)] : "unknown";
+
+};
+
+
+uint32_t AbstractDrawManager::primitiveCount(MHWRender::MUIDrawManager::Primitive mode, uint32_t vertexCount)
+/**
+Returns the number of primitives formed by the supplied number of vertices.
+
+@param mode: The primitive type.
+@param vertexCount: The number of vertices.
+@return: uint32_t
+*/
+{
+
+	switch (mode)
+	{
+
+	case MHWRender::MUIDrawManager::kPoints:
+	case MHWRender::MUIDrawManager::kClosedLine:
+		return vertexCount;
+
+	case MHWRender::MUIDrawManager::kLines:
+		return vertexCount / 2;
+
+	case MHWRender::MUIDrawManager::kLineStrip:
+		return (vertexCount > 1) ? vertexCount - 1 : 0;
+
+	case MHWRender::MUIDrawManager::kTriangles:
+		return vertexCount / 3;
+
+	case MHWRender::MUIDrawManager::kTriStrip:
+		return (vertexCount > 2) ? vertexCount - 2 : 0;
+
+	default:
+		return 0;
+
+	}
+
+};
+
+
+void AbstractDrawManager::count(DrawCall call)
+/**
+Increments the counter for the supplied call type.
+Derived classes should call this from every call.
+
+@param call: The draw call type.
+@return: void
+*/
+{
+
+	this->calls[static_cast<size_t>(call)]++;
+
+};
+
+
+void AbstractDrawManager::tally(uint32_t vertexCount, uint32_t primitiveCount)
+/**
+Adds the supplied vertices and primitives to the counters.
+Derived classes should call this from every call that submits geometry.
+
+@param vertexCount: The number of vertices submitted.
+@param primitiveCount: The number of primitives submitted.
+@return: void
+*/
+{
+
+	this->vertices += vertexCount;
+	this->primitives += primitiveCount;
+
+};
@@ -0,0 +1,102 @@
+#ifndef _ABSTRACT_DRAW_MANAGER
+#define _ABSTRACT_DRAW_MANAGER
+//
+// File: AbstractDrawManager.h
+//
+// Author: Ben Singleton
+//
+
+#include <maya/MPoint.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
+#include <maya/MColor.h>
+#include <maya/MColorArray.h>
+#include <maya/MString.h>
+
+#include <maya/MUIDrawManager.h>
+
+#include <cstdint>
+
+
+namespace Drawable
+{
+
+	enum class DrawCall : uint8_t
+	{
+
+		BeginDrawable = 0,
+		EndDrawable,
+		BeginDrawInXray,
+		EndDrawInXray,
+		SetColor,
+		SetDepthPriority,
+		SetLineWidth,
+		SetLineStyle,
+		SetPaintStyle,
+		SetFontSize,
+		Mesh,
+		LineList,
+		Line,
+		Sphere,
+		Text,
+		Icon,
+		Count
+
+	};
+
+
+	class AbstractDrawManager
+	/**
+	Interface over the slice of MHWRender::MUIDrawManager used by the drawables.
+	This allows draw calls to be forwarded to the viewport or recorded for headless benchmarks.
+	Every implementation counts calls, vertices and primitives so the same statistics are available from either.
+	*/
+	{
+
+	public:
+
+							AbstractDrawManager();
+		virtual				~AbstractDrawManager();
+
+		virtual	void		beginDrawable() = 0;
+		virtual	void		endDrawable() = 0;
+
+		virtual	void		beginDrawInXray() = 0;
+		virtual	void		endDrawInXray() = 0;
+
+		virtual	void		setColor(const MColor& color) = 0;
+		virtual	void		setDepthPriority(unsigned int priority) = 0;
+		virtual	void		setLineWidth(float width) = 0;
+		virtual	void		setLineStyle(MHWRender::MUIDrawManager::LineStyle style) = 0;
+		virtual	void		setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style) = 0;
+		virtual	void		setFontSize(unsigned int fontSize) = 0;
+
+		virtual	void		mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal = nullptr, const MColorArray* color = nullptr) = 0;
+		virtual	void		lineList(const MPointArray& points, bool draw2D) = 0;
+		virtual	void		line(const MPoint& startPoint, const MPoint& endPoint) = 0;
+		virtual	void		sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled) = 0;
+		virtual	void		text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment) = 0;
+		virtual	void		icon(const MPoint& position, const MString& name, float scale) = 0;
+
+				uint64_t	callCount(DrawCall call) const;
+				uint64_t	totalCalls() const;
+				uint64_t	vertexCount() const;
+				uint64_t	primitiveCount() const;
+				void		resetCounts();
+
+		static	const char*	callName(DrawCall call);
+		static	uint32_t	primitiveCount(MHWRender::MUIDrawManager::Primitive mode, uint32_t vertexCount);
+
+	protected:
+
+				void		count(DrawCall call);
+				void		tally(uint32_t vertexCount, uint32_t primitiveCount);
+
+				uint64_t	calls[static_cast<size_t>(DrawCall::Count)];
+				uint64_t	vertices;
+				uint64_t	primitives;
+
+	};
+
+};
+#endif
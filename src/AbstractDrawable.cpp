@@ -6,6 +6,23 @@
 
 #include "AbstractDrawable.h"
 
+#include "Arrow.h"
+#include "AxisTripod.h"
+#include "AxisView.h"
+#include "Box.h"
+#include "CenterMarker.h"
+#include "Cross.h"
+#include "Custom.h"
+#include "Cylinder.h"
+#include "Triangle.h"
+#include "Pyramid.h"
+#include "Diamond.h"
+#include "Disc.h"
+#include "Notch.h"
+#include "Sphere.h"
+#include "Square.h"
+#include "TearDrop.h"
+
 using namespace Drawable;
 
 
@@ -16,6 +33,7 @@ Constructor.
 {
 
 	this->enabled = false;
+	this->id = 0;
 	this->objectMatrix = MMatrix::identity;
 	this->forward = MVector::xAxis;
 	this->right = MVector::zAxis;
@@ -87,4 +105,126 @@ Determines if this drawable is enabled.
 
 	return this->enabled;
 
-};
\ No newline at end of file
+};
+
+
+unsigned int AbstractDrawable::getId()
+/**
+Returns the id used to identify this drawable in stats, traces and probes.
+
+@return: unsigned int
+*/
+{
+
+	return this->id;
+
+};
+
+
+void AbstractDrawable::setId(unsigned int id)
+/**
+Updates the id used to identify this drawable in stats, traces and probes.
+
+@param id: The new id.
+@return: void
+*/
+{
+
+	this->id = id;
+
+};
+
+
+uint64_t AbstractDrawable::vertexCount()
+/**
+Returns the number of triangle and line points in this drawable's prepared geometry.
+
+@return: uint64_t
+*/
+{
+
+	if (this->geometry == nullptr)
+	{
+
+		return 0;
+
+	}
+
+	return static_cast<uint64_t>(this->geometry->triangles.length()) + static_cast<uint64_t>(this->geometry->lines.length());
+
+};
+
+
+void AbstractDrawable::memoryUsage(MemoryUsage& usage)
+/**
+Adds the bytes held by this drawable's buffers to the supplied usage.
+Shared geometry is reported by the geometry cache so only private geometry is added here.
+
+@param usage: The usage to add to.
+@return: void
+*/
+{
+
+	if (this->geometry != nullptr && !this->geometry->isShared)
+	{
+
+		GeometryCache::memoryUsage(*this->geometry, usage);
+
+	}
+
+};
+
+
+size_t AbstractDrawable::meshDataMemoryUsage()
+/**
+Returns the bytes held by static data shared between every instance of this drawable.
+
+@return: size_t
+*/
+{
+
+	return 0;
+
+};
+
+
+AbstractDrawable* AbstractDrawable::create(Shape shape)
+/**
+Returns a new drawable for the supplied shape, the caller owns the drawable.
+The drawable's id is the shape's index, which also keys the geometry it shares with other helpers.
+
+@param shape: The shape to create.
+@return: AbstractDrawable
+*/
+{
+
+	AbstractDrawable* drawable;
+
+	switch (shape)
+	{
+
+	case Shape::Arrow: drawable = new Arrow(); break;
+	case Shape::AxisTripod: drawable = new AxisTripod(); break;
+	case Shape::AxisView: drawable = new AxisView(); break;
+	case Shape::Box: drawable = new Box(); break;
+	case Shape::CenterMarker: drawable = new CenterMarker(); break;
+	case Shape::Cross: drawable = new Cross(); break;
+	case Shape::Custom: drawable = new Custom(); break;
+	case Shape::Cylinder: drawable = new Cylinder(); break;
+	case Shape::Diamond: drawable = new Diamond(); break;
+	case Shape::Disc: drawable = new Disc(); break;
+	case Shape::Notch: drawable = new Notch(); break;
+	case Shape::Pyramid: drawable = new Pyramid(); break;
+	case Shape::Sphere: drawable = new Sphere(); break;
+	case Shape::Square: drawable = new Square(); break;
+	case Shape::TearDrop: drawable = new TearDrop(); break;
+	case Shape::Triangle: drawable = new Triangle(); break;
+	default: return nullptr;
+
+	}
+
+	drawable->setId(static_cast<unsigned int>(shape));
+
+	return drawable;
+
+};
@@ -8,9 +8,11 @@
 
 #include "PointHelperData.h"
 #include "Drawable.h"
+#include "AbstractDrawManager.h"
+#include "MemoryUsage.h"
+#include "GeometryCache.h"
 
-#include <maya/MUIDrawManager.h>
-#include <maya/MFrameContext.h>
+#include <memory>
 
 
 namespace Drawable
@@ -24,8 +26,8 @@ namespace Drawable
 							AbstractDrawable();
 		virtual				~AbstractDrawable();
 
-		virtual	void		prepareForDraw(const MDagPath& dagPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData) = 0;
-		virtual	void		draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData) = 0;
+		virtual	void		prepareForDraw(const MDagPath& dagPath, const MDagPath& cameraPath, PointHelperData* pointHelperData) = 0;
+		virtual	void		draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData) = 0;
 
 		virtual	MMatrix		getObjectMatrix();
 		virtual	void		setObjectMatrix(MMatrix objectMatrix);
@@ -33,13 +35,26 @@ namespace Drawable
 		virtual	bool		isEnabled();
 		virtual	void		setEnabled(bool enabled);
 
+		virtual	unsigned int	getId();
+		virtual	void			setId(unsigned int id);
+
+		virtual	uint64_t	vertexCount();
+
+		virtual	void		memoryUsage(MemoryUsage& usage);
+		virtual	size_t		meshDataMemoryUsage();
+
+		static	AbstractDrawable*	create(Shape shape);
+
 	protected:
 
 				bool		enabled;
+				unsigned int	id;
 				MMatrix		objectMatrix;
 				MVector		forward, up, right, scale;
 				MPoint		center;
 
+				std::shared_ptr<const PreparedGeometry>	geometry;
+
 	};
 
 };
@@ -8,6 +8,7 @@
 
 
 MObject		Arrow::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Arrow::MESH_BUFFERS = Drawable::MeshBuffers();
 MIntArray	Arrow::BOUNDARY = MIntArray();
 
 
@@ -44,6 +45,11 @@ Constructor.
 		status = Drawable::getBoundary(Arrow::MESH_DATA, Arrow::BOUNDARY);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Arrow::MESH_DATA, Arrow::BOUNDARY, Arrow::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 	
 	
@@ -53,44 +59,29 @@ Constructor.
 Arrow::~Arrow() {};
 
 
-void Arrow::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Arrow::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw an arrow.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Arrow::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Get lines from boundary
-	//
-	status = Drawable::getLines(meshData, Arrow::BOUNDARY, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Arrow::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Arrow::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Arrow::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
 /**
 Draws an arrow.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -103,12 +94,25 @@ Draws an arrow.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
-};
\ No newline at end of file
+};
+
+
+size_t Arrow::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every arrow.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Arrow::MESH_DATA) + Drawable::sizeOf(Arrow::BOUNDARY);
+
+};
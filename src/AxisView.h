@@ -17,12 +17,11 @@ public:
 						AxisView();
 	virtual				~AxisView();
 
-	virtual	void		prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData);
-	virtual	void		draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
+	virtual	void		prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void		draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
 
 protected:
 
-			MPointArray	lines;
 			double		radius;
 
 private:
@@ -8,6 +8,7 @@
 
 
 MObject	Box::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Box::MESH_BUFFERS = Drawable::MeshBuffers();
 
 
 Box::Box() : Drawable::AbstractDrawable()
@@ -39,6 +40,11 @@ Constructor.
 		Box::MESH_DATA = Drawable::createMeshData(points, polygonCounts, polygonConnects, edgeSmoothings, &status);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Box::MESH_DATA, Box::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -47,42 +53,29 @@ Constructor.
 Box::~Box() {};
 
 
-void Box::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Box::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a box.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Box::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	status = Drawable::getLines(meshData, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Box::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Box::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Box::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
 /**
 Draws a box.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -93,12 +86,25 @@ Draws a box.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
+
+};
+
 
-};
\ No newline at end of file
+size_t Box::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every box.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Box::MESH_DATA) + Drawable::sizeOf(Box::MESH_BUFFERS);
+
+};
@@ -0,0 +1,360 @@
+//
+// File: CaptureDrawManager.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "CaptureDrawManager.h"
+
+using namespace Drawable;
+
+
+CaptureDrawManager::CaptureDrawManager() : AbstractDrawManager(), sphereFill(true), unitSphereAxis(0), unitSphereHeight(0) {};
+CaptureDrawManager::~CaptureDrawManager() {};
+
+
+void CaptureDrawManager::reset()
+/**
+Clears the captured geometry and counters.
+
+@return: void
+*/
+{
+
+	this->captured.triangles.clear();
+	this->captured.normals.clear();
+	this->captured.lines.clear();
+
+	this->resetCounts();
+
+};
+
+
+void CaptureDrawManager::setSphereFill(bool fill)
+/**
+Sets whether filled spheres are captured as triangles.
+When off every sphere is captured as wireframe lines, to match a helper that is drawn without fill.
+
+@param fill: If true filled spheres keep their triangles.
+@return: void
+*/
+{
+
+	this->sphereFill = fill;
+
+};
+
+
+void CaptureDrawManager::rewind(size_t numTriangles, size_t numLines)
+/**
+Discards any geometry captured after the supplied number of triangle and line vertices.
+Counters are left as is.
+
+@param numTriangles: The number of triangle vertices to keep.
+@param numLines: The number of line vertices to keep.
+@return: void
+*/
+{
+
+	this->captured.triangles.resize(numTriangles);
+	this->captured.normals.resize(numTriangles);
+	this->captured.lines.resize(numLines);
+
+};
+
+
+const Core::MeshBuffers& CaptureDrawManager::buffers() const
+/**
+Returns the geometry captured since the last reset.
+Every triangle vertex has a matching normal and lines are stored as segment pairs.
+
+@return: Core::MeshBuffers
+*/
+{
+
+	return this->captured;
+
+};
+
+
+void CaptureDrawManager::addTriangle(const MPoint& a, const MPoint& b, const MPoint& c, const MVectorArray* normal, unsigned int ia, unsigned int ib, unsigned int ic)
+/**
+Appends a single triangle.
+When no normals were submitted the face normal is used for every vertex.
+
+@param a: The first vertex.
+@param b: The second vertex.
+@param c: The third vertex.
+@param normal: The submitted normals, or nullptr.
+@param ia: The index of the first vertex's normal.
+@param ib: The index of the second vertex's normal.
+@param ic: The index of the third vertex's normal.
+@return: void
+*/
+{
+
+	this->captured.triangles.push_back(toCore(a));
+	this->captured.triangles.push_back(toCore(b));
+	this->captured.triangles.push_back(toCore(c));
+
+	if (normal != nullptr && ic < normal->length())
+	{
+
+		this->captured.normals.push_back(toCore((*normal)[ia]));
+		this->captured.normals.push_back(toCore((*normal)[ib]));
+		this->captured.normals.push_back(toCore((*normal)[ic]));
+
+	}
+	else
+	{
+
+		Core::VectorD faceNormal = toCore(((b - a) ^ (c - a)).normal());
+
+		this->captured.normals.push_back(faceNormal);
+		this->captured.normals.push_back(faceNormal);
+		this->captured.normals.push_back(faceNormal);
+
+	}
+
+};
+
+
+void CaptureDrawManager::beginDrawable() { this->count(DrawCall::BeginDrawable); };
+void CaptureDrawManager::endDrawable() { this->count(DrawCall::EndDrawable); };
+
+void CaptureDrawManager::beginDrawInXray() { this->count(DrawCall::BeginDrawInXray); };
+void CaptureDrawManager::endDrawInXray() { this->count(DrawCall::EndDrawInXray); };
+
+void CaptureDrawManager::setColor(const MColor& color) { this->count(DrawCall::SetColor); };
+void CaptureDrawManager::setDepthPriority(unsigned int priority) { this->count(DrawCall::SetDepthPriority); };
+void CaptureDrawManager::setLineWidth(float width) { this->count(DrawCall::SetLineWidth); };
+void CaptureDrawManager::setLineStyle(MHWRender::MUIDrawManager::LineStyle style) { this->count(DrawCall::SetLineStyle); };
+void CaptureDrawManager::setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style) { this->count(DrawCall::SetPaintStyle); };
+void CaptureDrawManager::setFontSize(unsigned int fontSize) { this->count(DrawCall::SetFontSize); };
+
+void CaptureDrawManager::text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment) { this->count(DrawCall::Text); };
+void CaptureDrawManager::icon(const MPoint& position, const MString& name, float scale) { this->count(DrawCall::Icon); };
+
+
+void CaptureDrawManager::mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal, const MColorArray* color)
+/**
+Captures a mesh as triangle or line lists.
+Per vertex colors are ignored since the batch is colored per instance.
+
+@param mode: The primitive type.
+@param position: The vertex positions.
+@param normal: The optional vertex normals.
+@param color: The optional vertex colors.
+@return: void
+*/
+{
+
+	this->count(DrawCall::Mesh);
+
+	const unsigned int numPoints = position.length();
+	this->tally(numPoints, AbstractDrawManager::primitiveCount(mode, numPoints));
+
+	switch (mode)
+	{
+
+	case MHWRender::MUIDrawManager::kTriangles:
+	{
+
+		for (unsigned int i = 0; i + 2 < numPoints; i += 3)
+		{
+
+			this->addTriangle(position[i], position[i + 1], position[i + 2], normal, i, i + 1, i + 2);
+
+		}
+
+		break;
+
+	}
+
+	case MHWRender::MUIDrawManager::kTriStrip:
+	{
+
+		// Alternate the winding so every triangle faces the same way
+		//
+		for (unsigned int i = 0; i + 2 < numPoints; i++)
+		{
+
+			if (i % 2 == 0)
+			{
+
+				this->addTriangle(position[i], position[i + 1], position[i + 2], normal, i, i + 1, i + 2);
+
+			}
+			else
+			{
+
+				this->addTriangle(position[i + 1], position[i], position[i + 2], normal, i + 1, i, i + 2);
+
+			}
+
+		}
+
+		break;
+
+	}
+
+	case MHWRender::MUIDrawManager::kLines:
+	{
+
+		for (unsigned int i = 0; i + 1 < numPoints; i += 2)
+		{
+
+			this->captured.lines.push_back(toCore(position[i]));
+			this->captured.lines.push_back(toCore(position[i + 1]));
+
+		}
+
+		break;
+
+	}
+
+	case MHWRender::MUIDrawManager::kLineStrip:
+	case MHWRender::MUIDrawManager::kClosedLine:
+	{
+
+		for (unsigned int i = 0; i + 1 < numPoints; i++)
+		{
+
+			this->captured.lines.push_back(toCore(position[i]));
+			this->captured.lines.push_back(toCore(position[i + 1]));
+
+		}
+
+		if (mode == MHWRender::MUIDrawManager::kClosedLine && numPoints > 2)
+		{
+
+			this->captured.lines.push_back(toCore(position[numPoints - 1]));
+			this->captured.lines.push_back(toCore(position[0]));
+
+		}
+
+		break;
+
+	}
+
+	default:
+		break;
+
+	}
+
+};
+
+
+void CaptureDrawManager::lineList(const MPointArray& points, bool draw2D)
+/**
+Captures a list of line segments.
+Screen space lines cannot be transformed with the instance so they are skipped.
+
+@param points: The segment end points.
+@param draw2D: If true the points are in screen space.
+@return: void
+*/
+{
+
+	this->count(DrawCall::LineList);
+
+	if (draw2D)
+	{
+
+		return;
+
+	}
+
+	const unsigned int numPoints = points.length();
+	this->tally(numPoints, numPoints / 2);
+
+	for (unsigned int i = 0; i + 1 < numPoints; i += 2)
+	{
+
+		this->captured.lines.push_back(toCore(points[i]));
+		this->captured.lines.push_back(toCore(points[i + 1]));
+
+	}
+
+};
+
+
+void CaptureDrawManager::line(const MPoint& startPoint, const MPoint& endPoint)
+/**
+Captures a single line segment.
+
+@param startPoint: The start of the segment.
+@param endPoint: The end of the segment.
+@return: void
+*/
+{
+
+	this->count(DrawCall::Line);
+	this->tally(2, 1);
+
+	this->captured.lines.push_back(toCore(startPoint));
+	this->captured.lines.push_back(toCore(endPoint));
+
+};
+
+
+void CaptureDrawManager::sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled)
+/**
+Captures a tessellated sphere, filled spheres are captured as triangles and wireframe spheres as lines.
+Filled spheres are also captured as lines while sphere fill is off, see setSphereFill().
+A unit sphere is tessellated once per subdivision count and scaled into place, so repeated captures do not allocate.
+
+@param center: The sphere center.
+@param radius: The sphere radius.
+@param subdivisionsAxis: The number of subdivisions around the axis.
+@param subdivisionsHeight: The number of subdivisions along the axis.
+@param filled: If true the sphere is filled.
+@return: void
+*/
+{
+
+	this->count(DrawCall::Sphere);
+
+	if (subdivisionsAxis != this->unitSphereAxis || subdivisionsHeight != this->unitSphereHeight)
+	{
+
+		Core::Mesh mesh;
+		Core::sphere(Core::VectorD(), 1.0, static_cast<int>(subdivisionsAxis), static_cast<int>(subdivisionsHeight), mesh);
+		Core::getMeshBuffers(mesh, this->unitSphere);
+
+		this->unitSphereAxis = subdivisionsAxis;
+		this->unitSphereHeight = subdivisionsHeight;
+
+	}
+
+	const Core::PointD origin = toCore(center);
+
+	if (filled && this->sphereFill)
+	{
+
+		for (const Core::PointD& point : this->unitSphere.triangles)
+		{
+
+			this->captured.triangles.push_back(origin + (point.asVector() * radius));
+
+		}
+
+		this->captured.normals.insert(this->captured.normals.end(), this->unitSphere.normals.begin(), this->unitSphere.normals.end());
+		this->tally(static_cast<uint32_t>(this->unitSphere.triangles.size()), static_cast<uint32_t>(this->unitSphere.triangles.size() / 3));
+
+	}
+	else
+	{
+
+		for (const Core::PointD& point : this->unitSphere.lines)
+		{
+
+			this->captured.lines.push_back(origin + (point.asVector() * radius));
+
+		}
+
+		this->tally(static_cast<uint32_t>(this->unitSphere.lines.size()), static_cast<uint32_t>(this->unitSphere.lines.size() / 2));
+
+	}
+
+};
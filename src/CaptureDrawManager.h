@@ -0,0 +1,69 @@
+#ifndef _CAPTURE_DRAW_MANAGER
+#define _CAPTURE_DRAW_MANAGER
+//
+// File: CaptureDrawManager.h
+//
+// Author: Ben Singleton
+//
+
+#include "AbstractDrawManager.h"
+#include "Drawable.h"
+
+
+namespace Drawable
+{
+
+	class CaptureDrawManager : public AbstractDrawManager
+	/**
+	Collects the geometry submitted by a drawable into triangle and line lists instead of drawing it.
+	Strips are expanded into lists and spheres are tessellated so the capture can be transformed and batched with other shapes.
+	Text, icons and draw state are counted but not captured.
+	*/
+	{
+
+	public:
+
+							CaptureDrawManager();
+		virtual				~CaptureDrawManager();
+
+		virtual	void		beginDrawable();
+		virtual	void		endDrawable();
+
+		virtual	void		beginDrawInXray();
+		virtual	void		endDrawInXray();
+
+		virtual	void		setColor(const MColor& color);
+		virtual	void		setDepthPriority(unsigned int priority);
+		virtual	void		setLineWidth(float width);
+		virtual	void		setLineStyle(MHWRender::MUIDrawManager::LineStyle style);
+		virtual	void		setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style);
+		virtual	void		setFontSize(unsigned int fontSize);
+
+		virtual	void		mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal = nullptr, const MColorArray* color = nullptr);
+		virtual	void		lineList(const MPointArray& points, bool draw2D);
+		virtual	void		line(const MPoint& startPoint, const MPoint& endPoint);
+		virtual	void		sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled);
+		virtual	void		text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment);
+		virtual	void		icon(const MPoint& position, const MString& name, float scale);
+
+				void		reset();
+				void		setSphereFill(bool fill);
+				void		rewind(size_t numTriangles, size_t numLines);
+
+		const Core::MeshBuffers&	buffers() const;
+
+	protected:
+
+				void		addTriangle(const MPoint& a, const MPoint& b, const MPoint& c, const MVectorArray* normal, unsigned int ia, unsigned int ib, unsigned int ic);
+
+				Core::MeshBuffers	captured;
+				bool				sphereFill;
+
+				Core::MeshBuffers	unitSphere;
+				unsigned int		unitSphereAxis;
+				unsigned int		unitSphereHeight;
+
+	};
+
+};
+#endif
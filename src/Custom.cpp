@@ -11,39 +11,194 @@ Custom::Custom() : Drawable::AbstractDrawable() {};
 Custom::~Custom() {};
 
 
-void Custom::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Custom::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
-Draws a custom shape stored inside the data pointer.
+Prepares to draw the helper's shape file, library shape or connected curves, or else a line through its control points.
+The indexed geometry is read in place from the shared shape and expanded into buffers shared by every helper with the same inputs.
+Helpers whose inputs change between prepares rebuild their own buffers in place instead.
 
-@param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
+@param objPath: The path to the object being drawn.
+@param cameraPath: The path to the camera that is being used to draw.
+@param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	// Check if there are enough points
+	// Check if there is anything to draw
+	//
+	const Drawable::Library::Shape* shape = pointHelperData->libraryShape;
+	const bool isPending = pointHelperData->isShapePending;
+	const bool isControlPoints = !isPending && shape == nullptr && pointHelperData->curveLines == nullptr;
+
+	if (isControlPoints && pointHelperData->controlPoints.length() < 2)
+	{
+
+		this->geometry = nullptr;
+		return;
+
+	}
+
+	// Share the geometry with every helper drawing the same shape with the same object matrix
+	// Keys hold the address of the shape or curves so the geometry holds their owner to keep that address from being reused
+	// Control points are keyed by their generation instead, which is never reused
 	//
-	unsigned int numPoints = pointHelperData->controlPoints.length();
+	Drawable::GeometryKey key(this->id, pointHelperData->objectMatrix);
+	key.variant = isPending ? 1 : (shape != nullptr) ? 2 : (pointHelperData->curveLines != nullptr) ? 3 : 4;
+	key.sources[0] = pointHelperData->customSource();
 
-	if (numPoints < 2) 
+	std::shared_ptr<Drawable::PreparedGeometry> geometry = Drawable::GeometryCache::acquire(key, this->geometry);
+
+	if (geometry == nullptr)
 	{
 
 		return;
 
 	}
 
-	// Draw line through points
+	// Private geometry is rebuilt in place so each branch clears anything it doesn't write
 	//
-	MPoint startPoint, endPoint;
+	const MMatrix& objectMatrix = pointHelperData->objectMatrix;
+
+	geometry->owners[0] = nullptr;
+	geometry->owners[1] = nullptr;
+
+	if (isPending)
+	{
+
+		// Draw the default bounding-box while the shape file loads
+		//
+		Drawable::transform(objectMatrix, Custom::PENDING_LINES, 24, geometry->lines);
+		geometry->triangles.setLength(0);
+		geometry->normals.setLength(0);
+
+	}
+	else if (isControlPoints)
+	{
+
+		// Draw a line through the control points
+		//
+		const MVectorArray& controlPoints = pointHelperData->controlPoints;
+		unsigned int numLines = controlPoints.length() - 1;
 
-	for (unsigned int i = 0; i < (numPoints - 1); i++) 
+		geometry->lines.setLength(numLines * 2);
+
+		for (unsigned int i = 0; i < numLines; i++)
+		{
+
+			geometry->lines[i * 2] = MPoint(controlPoints[i]) * objectMatrix;
+			geometry->lines[(i * 2) + 1] = MPoint(controlPoints[i + 1]) * objectMatrix;
+
+		}
+
+		geometry->triangles.setLength(0);
+		geometry->normals.setLength(0);
+
+	}
+	else if (shape == nullptr)
+	{
+
+		// Connected curves are tessellated by the node so they only need transforming
+		//
+		Drawable::transform(objectMatrix, *pointHelperData->curveLines, geometry->lines);
+		geometry->triangles.setLength(0);
+		geometry->normals.setLength(0);
+		geometry->owners[0] = pointHelperData->curveLines;
+
+	}
+	else
 	{
 
-		startPoint = pointHelperData->controlPoints[i] * pointHelperData->objectMatrix;
-		endPoint = pointHelperData->controlPoints[i + 1] * pointHelperData->objectMatrix;
+		// Expand line indices
+		//
+		const float* point;
+		geometry->lines.setLength(shape->numLineIndices);
+
+		for (uint32_t i = 0; i < shape->numLineIndices; i++)
+		{
+
+			point = shape->points + (3 * shape->lineIndices[i]);
+			geometry->lines[i] = MPoint(point[0], point[1], point[2]) * objectMatrix;
+
+		}
+
+		// Expand triangle indices
+		// Shapes without normals are only filled flat so their normals are left empty
+		//
+		geometry->triangles.setLength(shape->numTriangleIndices);
+
+		for (uint32_t i = 0; i < shape->numTriangleIndices; i++)
+		{
+
+			point = shape->points + (3 * shape->triangleIndices[i]);
+			geometry->triangles[i] = MPoint(point[0], point[1], point[2]) * objectMatrix;
+
+		}
+
+		if (shape->normals != nullptr)
+		{
+
+			MMatrix normalMatrix = objectMatrix.inverse().transpose();
+			const float* normal;
+
+			geometry->normals.setLength(shape->numTriangleIndices);
+
+			for (uint32_t i = 0; i < shape->numTriangleIndices; i++)
+			{
+
+				normal = shape->normals + (3 * shape->triangleIndices[i]);
+				geometry->normals[i] = (MVector(normal[0], normal[1], normal[2]) * normalMatrix).normal();
+
+			}
+
+		}
+		else
+		{
+
+			geometry->normals.setLength(0);
+
+		}
+
+		geometry->owners[0] = pointHelperData->shapeAsset;
+		geometry->owners[1] = pointHelperData->shapeLibrary;
+
+	}
+
+	Drawable::GeometryCache::commit(geometry, this->geometry);
+
+};
+
+
+void Custom::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
+/**
+Draws the helper's shape file, library shape, connected curves or control points.
+
+@param drawManager: Interface used for drawing basic shapes inside the viewport.
+@return: void
+*/
+{
+
+	if (this->geometry == nullptr)
+	{
+
+		return;
+
+	}
+
+	if (pointHelperData->fill && this->geometry->triangles.length() > 0)
+	{
+
+		bool isShaded = pointHelperData->shaded && this->geometry->normals.length() > 0;
+
+		drawManager.setPaintStyle(isShaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, isShaded ? &this->geometry->normals : nullptr);
+
+	}
+
+	if (this->geometry->lines.length() > 0)
+	{
 
-		drawManager.line(startPoint, endPoint);
+		drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
 	}
 
-};
\ No newline at end of file
+};
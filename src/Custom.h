@@ -17,12 +17,26 @@ public:
 							Custom();
 	virtual					~Custom();
 
-	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData) {};
-	virtual	void			draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
-
-protected:
-
-			MVectorArray	points;
+	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void			draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
+
+private:
+
+	const double PENDING_LINES[24][4] = 
+	{
+		{-1.0, -1.0, -1.0, 1.0}, {1.0, -1.0, -1.0, 1.0},
+		{1.0, -1.0, -1.0, 1.0}, {1.0, 1.0, -1.0, 1.0},
+		{1.0, 1.0, -1.0, 1.0}, {-1.0, 1.0, -1.0, 1.0},
+		{-1.0, 1.0, -1.0, 1.0}, {-1.0, -1.0, -1.0, 1.0},
+		{-1.0, -1.0, 1.0, 1.0}, {1.0, -1.0, 1.0, 1.0},
+		{1.0, -1.0, 1.0, 1.0}, {1.0, 1.0, 1.0, 1.0},
+		{1.0, 1.0, 1.0, 1.0}, {-1.0, 1.0, 1.0, 1.0},
+		{-1.0, 1.0, 1.0, 1.0}, {-1.0, -1.0, 1.0, 1.0},
+		{-1.0, -1.0, -1.0, 1.0}, {-1.0, -1.0, 1.0, 1.0},
+		{1.0, -1.0, -1.0, 1.0}, {1.0, -1.0, 1.0, 1.0},
+		{1.0, 1.0, -1.0, 1.0}, {1.0, 1.0, 1.0, 1.0},
+		{-1.0, 1.0, -1.0, 1.0}, {-1.0, 1.0, 1.0, 1.0}
+	};
 
 };
 #endif
\ No newline at end of file
@@ -17,16 +17,16 @@ public:
 							Cylinder();
 	virtual					~Cylinder();
 
-	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData);
-	virtual	void			draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
+	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void			draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
+
+	virtual	size_t			meshDataMemoryUsage();
 
 protected:
 
 	static	MObject			MESH_DATA;
+	static	Drawable::MeshBuffers	MESH_BUFFERS;
 
-			MPointArray		triangles;
-			MVectorArray	normals;
-			MPointArray		lines;
 	
 	static	double			CYLINDER_RADIUS;
 	static	double			CYLINDER_LENGTH;
@@ -8,6 +8,7 @@
 
 
 MObject	Diamond::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Diamond::MESH_BUFFERS = Drawable::MeshBuffers();
 
 
 Diamond::Diamond() : Drawable::AbstractDrawable()
@@ -39,6 +40,11 @@ Constructor.
 		Diamond::MESH_DATA = Drawable::createMeshData(points, polygonCounts, polygonConnects, edgeSmoothings, &status);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Diamond::MESH_DATA, Diamond::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -47,42 +53,29 @@ Constructor.
 Diamond::~Diamond() {};
 
 
-void Diamond::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Diamond::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a diamond.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Diamond::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	status = Drawable::getLines(meshData, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Diamond::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Diamond::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData) 
+void Diamond::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData) 
 /**
 Draws a box.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -93,12 +86,25 @@ Draws a box.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
+
+};
+
 
-};
\ No newline at end of file
+size_t Diamond::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every diamond.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Diamond::MESH_DATA) + Drawable::sizeOf(Diamond::MESH_BUFFERS);
+
+};
@@ -8,6 +8,7 @@
 
 
 MObject		Disc::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Disc::MESH_BUFFERS = Drawable::MeshBuffers();
 MIntArray	Disc::BOUNDARY = MIntArray();
 double		Disc::DISC_RADIUS = 0.5;
 int			Disc::SUBDIVISIONS_AXIS = 32;
@@ -38,6 +39,11 @@ Constructor.
 		status = Drawable::getBoundary(Disc::MESH_DATA, Disc::BOUNDARY);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Disc::MESH_DATA, Disc::BOUNDARY, Disc::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -46,44 +52,29 @@ Constructor.
 Disc::~Disc() {};
 
 
-void Disc::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Disc::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a disc.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Disc::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Get mesh triangles
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Get lines from boundary
-	//
-	status = Drawable::getLines(meshData, Disc::BOUNDARY, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Disc::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Disc::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Disc::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
 /**
 Draws a disc.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -94,12 +85,25 @@ Draws a disc.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
-};
\ No newline at end of file
+};
+
+
+size_t Disc::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every disc.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Disc::MESH_DATA) + Drawable::sizeOf(Disc::BOUNDARY);
+
+};
@@ -7,6 +7,57 @@
 #include "Drawable.h"
 
 
+static const char* SHAPE_NAMES[Drawable::NUM_SHAPES] =
+{
+	"arrow", "axisTripod", "axisView", "box", "centerMarker", "cross", "custom", "cylinder",
+	"diamond", "disc", "notch", "pyramid", "sphere", "square", "tearDrop", "triangle"
+};
+
+
+const char* Drawable::shapeName(Shape shape)
+/**
+Returns the static name of the supplied shape, which is also the name of the attribute that enables it.
+Unknown shapes return "unknown".
+
+@param shape: The shape.
+@return: const char*
+*/
+{
+
+	unsigned int index = static_cast<unsigned int>(shape);
+
+	return (index < NUM_SHAPES) ? SHAPE_NAMES[index] : "unknown";
+
+};
+
+
+Drawable::Shape Drawable::findShape(const MString& name)
+/**
+Returns the shape with the supplied name.
+Unknown names return Shape::Count.
+
+@param name: The shape name.
+@return: Shape
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_SHAPES; i++)
+	{
+
+		if (name == SHAPE_NAMES[i])
+		{
+
+			return static_cast<Shape>(i);
+
+		}
+
+	}
+
+	return Shape::Count;
+
+};
+
+
 unsigned int Drawable::sum(const MIntArray& values)
 /**
 Function similar to the builtin method in python used to add up all of the values inside an array.
@@ -541,6 +592,120 @@ This is an in place multiplication performed on a passed array so the original v
 };
 
 
+void Drawable::transform(const MMatrix& matrix, const MPointArray& points, MPointArray& output)
+/**
+Function used to transform an array of points into a separate array.
+The output is only resized when its length differs so repeated calls with the same input do not reallocate.
+
+@param matrix: Transform matrix.
+@param points: The points to be multiplied.
+@param output: The passed array to populate.
+@return: void
+*/
+{
+
+	unsigned int numPoints = points.length();
+
+	if (output.length() != numPoints)
+	{
+
+		output.setLength(numPoints);
+
+	}
+
+	for (unsigned int i = 0; i < numPoints; i++)
+	{
+
+		output[i] = points[i] * matrix;
+
+	}
+
+};
+
+
+void Drawable::transform(const MMatrix& matrix, const double points[][4], const int numPoints, MPointArray& output)
+/**
+Function used to transform a static array of points into a passed array.
+The output is only resized when its length differs so repeated calls do not reallocate.
+
+@param matrix: Transform matrix.
+@param points: An array of points to be multiplied.
+@param numPoints: Number of points inside the array.
+@param output: The passed array to populate.
+@return: void
+*/
+{
+
+	if (output.length() != static_cast<unsigned int>(numPoints))
+	{
+
+		output.setLength(numPoints);
+
+	}
+
+	for (int i = 0; i < numPoints; i++)
+	{
+
+		output[i] = MPoint(points[i]) * matrix;
+
+	}
+
+};
+
+
+void Drawable::transform(const MMatrix& matrix, const MeshBuffers& buffers, MPointArray& triangles, MVectorArray& normals, MPointArray& lines)
+/**
+Function used to transform a set of object space mesh buffers into the supplied arrays.
+
+@param matrix: Transform matrix.
+@param buffers: The object space buffers.
+@param triangles: The passed triangle array to populate.
+@param normals: The passed normal array to populate.
+@param lines: The passed line array to populate.
+@return: void
+*/
+{
+
+	Drawable::transform(matrix, buffers.triangles, triangles);
+	Drawable::transformNormals(matrix, buffers.normals, normals);
+	Drawable::transform(matrix, buffers.lines, lines);
+
+};
+
+
+void Drawable::transformNormals(const MMatrix& matrix, const MVectorArray& normals, MVectorArray& output)
+/**
+Function used to transform an array of normals into a separate array.
+Normals are multiplied by the inverse transpose so they stay perpendicular under non-uniform scale.
+
+@param matrix: Transform matrix.
+@param normals: The normals to be multiplied.
+@param output: The passed array to populate.
+@return: void
+*/
+{
+
+	unsigned int numNormals = normals.length();
+
+	if (output.length() != numNormals)
+	{
+
+		output.setLength(numNormals);
+
+	}
+
+	MMatrix normalMatrix = matrix.inverse().transpose();
+
+	for (unsigned int i = 0; i < numNormals; i++)
+	{
+
+		output[i] = (normals[i] * normalMatrix).normal();
+
+	}
+
+};
+
+
 MPointArray Drawable::transform(const MMatrix& matrix, const double points[][4], const int numPoints)
 /**
 Function used to transform an array of points using the supplied transform matrix.
@@ -605,41 +770,14 @@ The number of divisions dictates the number of points returned.
 */
 {
 
-	// Derive transform matrix from normal
+	// Generate arc using the geometry core
 	//
-	MQuaternion quat = MVector::xAxis.rotateTo(normal);
-	MMatrix matrix = quat.asMatrix();
-
-	// Iterate through angle range
-	//
-	MPointArray points(numPoints, MPoint::origin);
-
-	double fraction = 1.0 / (numPoints - 1);
-	double step = (endAngle - startAngle) * fraction;
-	double y, z, angle;
-	MPoint point;
-
-	for (int i = 0; i < numPoints; i++)
-	{
+	std::vector<Core::PointD> points = Core::arc(Drawable::toCore(center), Drawable::toCore(normal), radius, startAngle, endAngle, numPoints);
 
-		// Calculate 2D co-ordinates
-		//
-		angle = startAngle + (step * static_cast<double>(i));
-
-		y = radius * sin(angle * (PI / 180.0));
-		z = radius * cos(angle * (PI / 180.0));
-
-		// Convert co-ordinates into 3D space
-		//
-		point = MPoint(0.0, y, z, 1.0);
-		point *= matrix;
-		point += center;
-
-		points[i] = point;
-
-	}
+	MPointArray newPoints;
+	Drawable::fromCore(points, newPoints);
 
-	return points;
+	return newPoints;
 
 };
 
@@ -1370,6 +1508,47 @@ Static function used to populate a point array from a mesh data object.
 };
 
 
+MStatus Drawable::getMeshBuffers(const MObject& meshData, MeshBuffers& buffers)
+/**
+Static function used to extract the triangles, normals and lines from a mesh data object.
+
+@param meshData: Mesh data object to copy points from.
+@param buffers: The passed buffers to populate.
+@return: Status.
+*/
+{
+
+	MStatus status;
+
+	status = Drawable::getTriangles(meshData, buffers.triangles, buffers.normals);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return Drawable::getLines(meshData, buffers.lines);
+
+};
+
+
+MStatus Drawable::getMeshBuffers(const MObject& meshData, MIntArray& boundary, MeshBuffers& buffers)
+/**
+Static function used to extract the triangles, normals and boundary lines from a mesh data object.
+
+@param meshData: Mesh data object to copy points from.
+@param boundary: The edge elements used for lines.
+@param buffers: The passed buffers to populate.
+@return: Status.
+*/
+{
+
+	MStatus status;
+
+	status = Drawable::getTriangles(meshData, buffers.triangles, buffers.normals);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return Drawable::getLines(meshData, boundary, buffers.lines);
+
+};
+
+
 MStatus Drawable::getBoundary(MObject& meshData, MIntArray& boundary)
 /**
 Static function used to populate an element array from a mesh data object.
@@ -1559,4 +1738,327 @@ Auto smooths the edges on the supplied mesh based on a 45 degree angle.
 
 	return MS::kSuccess;
 
+};
+
+
+MStatus Drawable::tessellateCurve(const MObject& curveData, std::vector<Core::PointD>& lines)
+/**
+Adaptively tessellates the supplied nurbs curve into line segments appended to the supplied array as point pairs.
+Linear curves are drawn through their control points, higher degrees are split until they are within CURVE_TOLERANCE of the curve's size.
+
+@param curveData: The nurbs curve data object.
+@param lines: The passed array to append to.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MFnNurbsCurve fnCurve(curveData, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MPointArray controlPoints;
+
+	status = fnCurve.getCVs(controlPoints, MSpace::kObject);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	unsigned int numControlPoints = controlPoints.length();
+
+	if (numControlPoints < 2)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	// Draw linear curves through their control points
+	//
+	if (fnCurve.degree() == 1)
+	{
+
+		for (unsigned int i = 0; i < (numControlPoints - 1); i++)
+		{
+
+			lines.push_back(Drawable::toCore(controlPoints[i]));
+			lines.push_back(Drawable::toCore(controlPoints[i + 1]));
+
+		}
+
+		return MS::kSuccess;
+
+	}
+
+	// Scale the tolerance by the size of the hull
+	//
+	MBoundingBox boundingBox;
+
+	for (unsigned int i = 0; i < numControlPoints; i++)
+	{
+
+		boundingBox.expand(controlPoints[i]);
+
+	}
+
+	double tolerance = std::max(boundingBox.width(), std::max(boundingBox.height(), boundingBox.depth())) * CURVE_TOLERANCE;
+
+	double start, end;
+
+	status = fnCurve.getKnotDomain(start, end);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	auto evaluate = [&fnCurve](const double parameter)
+	{
+
+		MPoint point;
+		fnCurve.getPointAtParam(parameter, point, MSpace::kObject);
+
+		return Drawable::toCore(point);
+
+	};
+
+	size_t numSegments = static_cast<size_t>(std::max(fnCurve.numSpans(), 1)) * 2;
+	Core::tessellateCurve(evaluate, start, end, numSegments, tolerance, CURVE_MAX_DEPTH, lines);
+
+	return MS::kSuccess;
+
+};
+
+
+Drawable::Core::PointD Drawable::toCore(const MPoint& point)
+/**
+Converts the supplied Maya point into a core point.
+
+@param point: The point to convert.
+@return: Core point.
+*/
+{
+
+	return Core::PointD(point.x, point.y, point.z, point.w);
+
+};
+
+
+Drawable::Core::VectorD Drawable::toCore(const MVector& vector)
+/**
+Converts the supplied Maya vector into a core vector.
+
+@param vector: The vector to convert.
+@return: Core vector.
+*/
+{
+
+	return Core::VectorD(vector.x, vector.y, vector.z);
+
+};
+
+
+Drawable::Core::Matrix Drawable::toCore(const MMatrix& matrix)
+/**
+Converts the supplied Maya matrix into a core matrix.
+Both types share the same row-vector convention so this is a straight copy.
+
+@param matrix: The matrix to convert.
+@return: Core matrix.
+*/
+{
+
+	Core::Matrix coreMatrix;
+	matrix.get(coreMatrix.values);
+
+	return coreMatrix;
+
+};
+
+
+void Drawable::toCore(const MPointArray& points, std::vector<Core::PointD>& corePoints)
+/**
+Copies the supplied Maya point array into a core point array.
+The passed array is only resized when the lengths differ.
+
+@param points: The points to convert.
+@param corePoints: The core points to populate.
+@return: void
+*/
+{
+
+	unsigned int numPoints = points.length();
+	corePoints.resize(numPoints);
+
+	for (unsigned int i = 0; i < numPoints; i++)
+	{
+
+		corePoints[i] = Drawable::toCore(points[i]);
+
+	}
+
+};
+
+
+MStatus Drawable::toCore(const MObject& meshData, Core::Mesh& mesh)
+/**
+Copies the supplied mesh data object into a core mesh.
+
+@param meshData: The mesh data to convert.
+@param mesh: The core mesh to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Initialize function set
+	//
+	MFnMesh fnMesh(meshData, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Copy mesh constructors
+	//
+	MPointArray points;
+
+	status = fnMesh.getPoints(points);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MIntArray polygonCounts, polygonConnects;
+
+	status = fnMesh.getVertices(polygonCounts, polygonConnects);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	Drawable::toCore(points, mesh.points);
+
+	mesh.polygonCounts.resize(polygonCounts.length());
+	mesh.polygonConnects.resize(polygonConnects.length());
+
+	status = polygonCounts.get(mesh.polygonCounts.data());
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = polygonConnects.get(mesh.polygonConnects.data());
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return MS::kSuccess;
+
+};
+
+
+MPoint Drawable::fromCore(const Core::PointD& point)
+/**
+Converts the supplied core point into a Maya point.
+
+@param point: The point to convert.
+@return: MPoint
+*/
+{
+
+	return MPoint(point.x, point.y, point.z, point.w);
+
+};
+
+
+MVector Drawable::fromCore(const Core::VectorD& vector)
+/**
+Converts the supplied core vector into a Maya vector.
+
+@param vector: The vector to convert.
+@return: MVector
+*/
+{
+
+	return MVector(vector.x, vector.y, vector.z);
+
+};
+
+
+MMatrix Drawable::fromCore(const Core::Matrix& matrix)
+/**
+Converts the supplied core matrix into a Maya matrix.
+
+@param matrix: The matrix to convert.
+@return: MMatrix
+*/
+{
+
+	return MMatrix(matrix.values);
+
+};
+
+
+void Drawable::fromCore(const std::vector<Core::PointD>& corePoints, MPointArray& points)
+/**
+Copies the supplied core points into a Maya point array.
+The passed array is only resized when the lengths differ.
+
+@param corePoints: The points to convert.
+@param points: The point array to populate.
+@return: void
+*/
+{
+
+	unsigned int numPoints = static_cast<unsigned int>(corePoints.size());
+
+	if (points.length() != numPoints)
+	{
+
+		points.setLength(numPoints);
+
+	}
+
+	for (unsigned int i = 0; i < numPoints; i++)
+	{
+
+		const Core::PointD& point = corePoints[i];
+		points[i] = MPoint(point.x, point.y, point.z, point.w);
+
+	}
+
+};
+
+
+void Drawable::fromCore(const std::vector<Core::VectorD>& coreVectors, MVectorArray& vectors)
+/**
+Copies the supplied core vectors into a Maya vector array.
+The passed array is only resized when the lengths differ.
+
+@param coreVectors: The vectors to convert.
+@param vectors: The vector array to populate.
+@return: void
+*/
+{
+
+	unsigned int numVectors = static_cast<unsigned int>(coreVectors.size());
+
+	if (vectors.length() != numVectors)
+	{
+
+		vectors.setLength(numVectors);
+
+	}
+
+	for (unsigned int i = 0; i < numVectors; i++)
+	{
+
+		const Core::VectorD& vector = coreVectors[i];
+		vectors[i] = MVector(vector.x, vector.y, vector.z);
+
+	}
+
+};
+
+
+MObject Drawable::fromCore(const Core::Mesh& mesh, MStatus* status)
+/**
+Creates a new mesh data object from the supplied core mesh.
+
+@param mesh: The core mesh to convert.
+@param status: Return status.
+@return: MObject
+*/
+{
+
+	MPointArray points;
+	Drawable::fromCore(mesh.points, points);
+
+	MIntArray polygonCounts(mesh.polygonCounts.data(), static_cast<unsigned int>(mesh.polygonCounts.size()));
+	MIntArray polygonConnects(mesh.polygonConnects.data(), static_cast<unsigned int>(mesh.polygonConnects.size()));
+
+	return Drawable::createMeshData(points, polygonCounts, polygonConnects, status);
+
 };
\ No newline at end of file
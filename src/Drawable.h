@@ -6,6 +6,8 @@
 // Author: Ben Singleton
 //
 
+#include "DrawableCore.h"
+
 #include <maya/MObject.h>
 #include <maya/MDagPath.h>
 #include <maya/MPoint.h>
@@ -16,16 +18,19 @@
 #include <maya/MQuaternion.h>
 #include <maya/MEulerRotation.h>
 #include <maya/MMatrix.h>
+#include <maya/MBoundingBox.h>
 
 #include <maya/MFn.h>
 #include <maya/MFnMesh.h>
 #include <maya/MFnMeshData.h>
+#include <maya/MFnNurbsCurve.h>
 #include <maya/MFnSingleIndexedComponent.h>
 
 #include <maya/MItMeshVertex.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MItMeshEdge.h>
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <numeric>
@@ -37,6 +42,51 @@ namespace Drawable
 	constexpr auto	PI = 3.141592653589793238462643383279502884197169399375105820974944592307816406286;
 	constexpr auto	UNIT_SQUARE_RADIUS = 0.70710678118654752440084436210485;
 	constexpr auto	MERGE_THRESHOLD = 1e-3;
+	constexpr auto	CURVE_TOLERANCE = 1e-3;
+	constexpr int	CURVE_MAX_DEPTH = 8;
+
+	enum class Shape : unsigned int
+	{
+
+		Arrow = 0,
+		AxisTripod,
+		AxisView,
+		Box,
+		CenterMarker,
+		Cross,
+		Custom,
+		Cylinder,
+		Diamond,
+		Disc,
+		Notch,
+		Pyramid,
+		Sphere,
+		Square,
+		TearDrop,
+		Triangle,
+		Count
+
+	};
+
+	constexpr unsigned int	NUM_SHAPES = static_cast<unsigned int>(Shape::Count);
+
+
+	struct MeshBuffers
+	/**
+	Object space triangles, normals and lines extracted once from a shared mesh.
+	Drawables transform these into their own arrays instead of copying the mesh every prepare.
+	*/
+	{
+
+		MPointArray		triangles;
+		MVectorArray	normals;
+		MPointArray		lines;
+
+	};
+
+
+	const char*		shapeName(Shape shape);
+	Shape			findShape(const MString& name);
 
 	unsigned int	sum(const MIntArray& values);
 	MIntArray		range(int start, int end, int increment);
@@ -72,6 +122,10 @@ namespace Drawable
 	MMatrix			createScaleMatrix(const MMatrix& matrix);
 
 	void			transform(const MMatrix& matrix, MPointArray& points);
+	void			transform(const MMatrix& matrix, const MPointArray& points, MPointArray& output);
+	void			transform(const MMatrix& matrix, const double points[][4], const int numPoints, MPointArray& output);
+	void			transform(const MMatrix& matrix, const MeshBuffers& buffers, MPointArray& triangles, MVectorArray& normals, MPointArray& lines);
+	void			transformNormals(const MMatrix& matrix, const MVectorArray& normals, MVectorArray& output);
 	MPointArray		transform(const MMatrix& matrix, const double points[][4], const int numPoints);
 	
 	MPointArray		line(const MPoint& start, const MPoint& end);
@@ -97,10 +151,27 @@ namespace Drawable
 	MStatus			getLines(const MObject& meshData, MIntArray& elements, MPointArray& lines);
 	MStatus			getLines(const MObject& meshData, const MObject& component, MPointArray& lines);
 	MStatus			getTriangles(const MObject& meshData, MPointArray& triangles, MVectorArray& normals);
+	MStatus			getMeshBuffers(const MObject& meshData, MeshBuffers& buffers);
+	MStatus			getMeshBuffers(const MObject& meshData, MIntArray& boundary, MeshBuffers& buffers);
 	
 	double			getFaceNormalDifference(const MObject& meshData, const int polygonIndex, const int otherPolygonIndex, MStatus* status);
 	
 	MStatus			autoSmoothEdges(MObject& meshData);
 
+	MStatus			tessellateCurve(const MObject& curveData, std::vector<Core::PointD>& lines);
+
+	Core::PointD	toCore(const MPoint& point);
+	Core::VectorD	toCore(const MVector& vector);
+	Core::Matrix	toCore(const MMatrix& matrix);
+	void			toCore(const MPointArray& points, std::vector<Core::PointD>& corePoints);
+	MStatus			toCore(const MObject& meshData, Core::Mesh& mesh);
+
+	MPoint			fromCore(const Core::PointD& point);
+	MVector			fromCore(const Core::VectorD& vector);
+	MMatrix			fromCore(const Core::Matrix& matrix);
+	void			fromCore(const std::vector<Core::PointD>& corePoints, MPointArray& points);
+	void			fromCore(const std::vector<Core::VectorD>& coreVectors, MVectorArray& vectors);
+	MObject			fromCore(const Core::Mesh& mesh, MStatus* status);
+
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,2072 @@
+#ifndef _POINT_HELPER_DRAWABLE_CORE
+#define _POINT_HELPER_DRAWABLE_CORE
+//
+// File: DrawableCore.h
+//
+// Author: Ben Singleton
+//
+// Header-only geometry core shared by the drawables.
+// Nothing in here depends on the Maya API so it can be compiled, profiled and benchmarked on any machine!
+// See Drawable.h for the adapters that convert to and from Maya types.
+//
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DRAWABLE_CORE_SSE2 1
+#else
+#define DRAWABLE_CORE_SSE2 0
+#endif
+
+
+namespace Drawable
+{
+
+	namespace Core
+	{
+
+		constexpr double	PI = 3.141592653589793238462643383279502884197169399375105820974944592307816406286;
+		constexpr double	UNIT_SQUARE_RADIUS = 0.70710678118654752440084436210485;
+		constexpr double	MERGE_THRESHOLD = 1e-3;
+		constexpr double	SMOOTHING_ANGLE = 45.0;
+
+
+		template<typename T>
+		struct Vector
+		{
+
+			T x = T(0), y = T(0), z = T(0);
+
+			constexpr Vector() = default;
+			constexpr Vector(T x, T y, T z) : x(x), y(y), z(z) {};
+
+			Vector	operator+(const Vector& other) const { return Vector(x + other.x, y + other.y, z + other.z); };
+			Vector	operator-(const Vector& other) const { return Vector(x - other.x, y - other.y, z - other.z); };
+			Vector	operator-() const { return Vector(-x, -y, -z); };
+			Vector	operator*(T scalar) const { return Vector(x * scalar, y * scalar, z * scalar); };
+			Vector&	operator+=(const Vector& other) { x += other.x; y += other.y; z += other.z; return *this; };
+
+			T		dot(const Vector& other) const { return (x * other.x) + (y * other.y) + (z * other.z); };
+			Vector	cross(const Vector& other) const { return Vector((y * other.z) - (z * other.y), (z * other.x) - (x * other.z), (x * other.y) - (y * other.x)); };
+			T		length() const { return std::sqrt(this->dot(*this)); };
+
+			Vector normal() const
+			{
+
+				T magnitude = this->length();
+				return (magnitude > T(0)) ? (*this * (T(1) / magnitude)) : *this;
+
+			};
+
+		};
+
+
+		template<typename T>
+		struct Point
+		{
+
+			T x = T(0), y = T(0), z = T(0), w = T(1);
+
+			constexpr Point() = default;
+			constexpr Point(T x, T y, T z, T w = T(1)) : x(x), y(y), z(z), w(w) {};
+			constexpr Point(const Vector<T>& vector) : x(vector.x), y(vector.y), z(vector.z), w(T(1)) {};
+
+			Point		operator+(const Vector<T>& vector) const { return Point(x + vector.x, y + vector.y, z + vector.z, w); };
+			Point		operator-(const Vector<T>& vector) const { return Point(x - vector.x, y - vector.y, z - vector.z, w); };
+			Vector<T>	operator-(const Point& other) const { return Vector<T>(x - other.x, y - other.y, z - other.z); };
+
+			Vector<T>	asVector() const { return Vector<T>(x, y, z); };
+
+		};
+
+
+		using PointF = Point<float>;
+		using PointD = Point<double>;
+		using VectorF = Vector<float>;
+		using VectorD = Vector<double>;
+
+
+		template<typename T>
+		class Span
+		{
+
+		public:
+
+			constexpr Span() = default;
+			constexpr Span(T* data, size_t size) : first(data), count(size) {};
+
+			template<typename Container>
+			Span(Container& container) : first(container.data()), count(container.size()) {};
+
+			T*			data() const { return first; };
+			size_t		size() const { return count; };
+			bool		empty() const { return count == 0; };
+
+			T*			begin() const { return first; };
+			T*			end() const { return first + count; };
+
+			T&			operator[](size_t index) const { return first[index]; };
+
+			Span		subspan(size_t offset, size_t length) const { return Span(first + offset, length); };
+
+		private:
+
+			T*			first = nullptr;
+			size_t		count = 0;
+
+		};
+
+
+		template<typename T> using PointSpan = Span<Point<T>>;
+		template<typename T> using ConstPointSpan = Span<const Point<T>>;
+
+
+		struct Matrix
+		/**
+		Affine 4x4 matrix using the same row-vector convention as MMatrix.
+		Points are multiplied on the left, so the translation lives in the last row!
+		*/
+		{
+
+			double values[4][4] =
+			{
+				{ 1.0, 0.0, 0.0, 0.0 },
+				{ 0.0, 1.0, 0.0, 0.0 },
+				{ 0.0, 0.0, 1.0, 0.0 },
+				{ 0.0, 0.0, 0.0, 1.0 }
+			};
+
+			static Matrix identity() { return Matrix(); };
+
+			double&	operator()(int row, int column) { return values[row][column]; };
+			double	operator()(int row, int column) const { return values[row][column]; };
+
+			Matrix operator*(const Matrix& other) const
+			{
+
+				Matrix product;
+
+				for (int row = 0; row < 4; row++)
+				{
+
+					for (int column = 0; column < 4; column++)
+					{
+
+						product.values[row][column] =
+							(values[row][0] * other.values[0][column]) +
+							(values[row][1] * other.values[1][column]) +
+							(values[row][2] * other.values[2][column]) +
+							(values[row][3] * other.values[3][column]);
+
+					}
+
+				}
+
+				return product;
+
+			};
+
+			bool operator==(const Matrix& other) const
+			{
+
+				for (int row = 0; row < 4; row++)
+				{
+
+					for (int column = 0; column < 4; column++)
+					{
+
+						if (values[row][column] != other.values[row][column])
+						{
+
+							return false;
+
+						}
+
+					}
+
+				}
+
+				return true;
+
+			};
+
+			bool operator!=(const Matrix& other) const { return !(*this == other); };
+
+		};
+
+
+		template<typename T>
+		inline Point<T> operator*(const Point<T>& point, const Matrix& matrix)
+		/**
+		Multiplies a homogeneous point by the supplied matrix.
+
+		@param point: The point to transform.
+		@param matrix: The transform matrix.
+		@return: The transformed point.
+		*/
+		{
+
+			const double x = point.x, y = point.y, z = point.z, w = point.w;
+
+			return Point<T>(
+				T((x * matrix.values[0][0]) + (y * matrix.values[1][0]) + (z * matrix.values[2][0]) + (w * matrix.values[3][0])),
+				T((x * matrix.values[0][1]) + (y * matrix.values[1][1]) + (z * matrix.values[2][1]) + (w * matrix.values[3][1])),
+				T((x * matrix.values[0][2]) + (y * matrix.values[1][2]) + (z * matrix.values[2][2]) + (w * matrix.values[3][2])),
+				T((x * matrix.values[0][3]) + (y * matrix.values[1][3]) + (z * matrix.values[2][3]) + (w * matrix.values[3][3]))
+			);
+
+		};
+
+
+		template<typename T>
+		inline Vector<T> operator*(const Vector<T>& vector, const Matrix& matrix)
+		/**
+		Multiplies a direction by the supplied matrix, ignoring translation.
+
+		@param vector: The vector to transform.
+		@param matrix: The transform matrix.
+		@return: The transformed vector.
+		*/
+		{
+
+			const double x = vector.x, y = vector.y, z = vector.z;
+
+			return Vector<T>(
+				T((x * matrix.values[0][0]) + (y * matrix.values[1][0]) + (z * matrix.values[2][0])),
+				T((x * matrix.values[0][1]) + (y * matrix.values[1][1]) + (z * matrix.values[2][1])),
+				T((x * matrix.values[0][2]) + (y * matrix.values[1][2]) + (z * matrix.values[2][2]))
+			);
+
+		};
+
+
+		struct Mesh
+		/**
+		Indexed polygon mesh with the same layout as the MFnMesh constructors.
+		*/
+		{
+
+			std::vector<PointD>	points;
+			std::vector<int>	polygonCounts;
+			std::vector<int>	polygonConnects;
+
+			size_t	numPolygons() const { return polygonCounts.size(); };
+			size_t	numVertices() const { return points.size(); };
+
+			void clear()
+			{
+
+				points.clear();
+				polygonCounts.clear();
+				polygonConnects.clear();
+
+			};
+
+			int findOrAddPoint(const PointD& point, const double mergeThreshold)
+			/**
+			Returns the index of an existing vertex within the merge threshold, otherwise the point is appended.
+			This mimics the vertex merging performed by MFnMesh::addPolygon().
+
+			@param point: The point to add.
+			@param mergeThreshold: The distance below which vertices are merged.
+			@return: The vertex index.
+			*/
+			{
+
+				const double thresholdSquared = mergeThreshold * mergeThreshold;
+				const int numPoints = static_cast<int>(points.size());
+
+				for (int i = 0; i < numPoints; i++)
+				{
+
+					VectorD delta = points[i] - point;
+
+					if (delta.dot(delta) <= thresholdSquared)
+					{
+
+						return i;
+
+					}
+
+				}
+
+				points.push_back(point);
+				return numPoints;
+
+			};
+
+			void addPolygon(const PointD* polygon, const size_t count, const double mergeThreshold = MERGE_THRESHOLD)
+			/**
+			Appends a polygon to this mesh, merging any vertices that are within the supplied threshold.
+
+			@param polygon: The polygon vertices.
+			@param count: The number of polygon vertices.
+			@param mergeThreshold: The distance below which vertices are merged.
+			@return: void
+			*/
+			{
+
+				polygonCounts.push_back(static_cast<int>(count));
+
+				for (size_t i = 0; i < count; i++)
+				{
+
+					polygonConnects.push_back(this->findOrAddPoint(polygon[i], mergeThreshold));
+
+				}
+
+			};
+
+		};
+
+
+		struct Edge
+		{
+
+			int		start, end;
+			int		faces[2];
+			int		numFaces;
+
+		};
+
+
+		struct MeshBuffers
+		/**
+		Triangles, normals and lines extracted from a mesh.
+		Shapes extract these once in object space and transform them into reused buffers every frame.
+		*/
+		{
+
+			std::vector<PointD>		triangles;
+			std::vector<VectorD>	normals;
+			std::vector<PointD>		lines;
+
+		};
+
+
+		inline std::vector<PointD> line(const PointD& start, const PointD& end)
+		/**
+		A convenience function used to quickly create a point array for a set of line points.
+
+		@param start: The start point on the line.
+		@param end: The end point on the line.
+		@return: An array of points that make up a line.
+		*/
+		{
+
+			return std::vector<PointD> { start, end };
+
+		};
+
+
+		inline Matrix rotateTo(const VectorD& from, const VectorD& to)
+		/**
+		Returns the rotation matrix that takes one vector onto another.
+		This matches the matrix produced by MVector::rotateTo().asMatrix().
+
+		@param from: The vector to rotate from.
+		@param to: The vector to rotate onto.
+		@return: Rotation matrix.
+		*/
+		{
+
+			VectorD a = from.normal();
+			VectorD b = to.normal();
+
+			double cosine = a.dot(b);
+			VectorD axis = a.cross(b);
+			double sine = axis.length();
+
+			if (sine < 1e-12)
+			{
+
+				if (cosine > 0.0)
+				{
+
+					return Matrix::identity();
+
+				}
+
+				// Vectors are opposed so pick any perpendicular axis
+				//
+				axis = (std::fabs(a.x) < 0.9) ? a.cross(VectorD(1.0, 0.0, 0.0)) : a.cross(VectorD(0.0, 1.0, 0.0));
+				sine = 0.0;
+				cosine = -1.0;
+
+			}
+
+			axis = axis.normal();
+
+			double t = 1.0 - cosine;
+			double x = axis.x, y = axis.y, z = axis.z;
+
+			Matrix matrix;
+			matrix.values[0][0] = (t * x * x) + cosine;
+			matrix.values[0][1] = (t * x * y) + (sine * z);
+			matrix.values[0][2] = (t * x * z) - (sine * y);
+			matrix.values[1][0] = (t * x * y) - (sine * z);
+			matrix.values[1][1] = (t * y * y) + cosine;
+			matrix.values[1][2] = (t * y * z) + (sine * x);
+			matrix.values[2][0] = (t * x * z) + (sine * y);
+			matrix.values[2][1] = (t * y * z) - (sine * x);
+			matrix.values[2][2] = (t * z * z) + cosine;
+
+			return matrix;
+
+		};
+
+
+		inline void arc(const VectorD& center, const VectorD& normal, const double radius, const double startAngle, const double endAngle, PointSpan<double> points)
+		/**
+		Writes an arc into pre-allocated storage so callers can reuse buffers between frames.
+		By default all points are calculated on the yz plane using x as the normal vector.
+
+		@param center: The center of this arc.
+		@param normal: The forward vector for this arc.
+		@param radius: The radius of this arc.
+		@param startAngle: The angle to start iterating from in degrees.
+		@param endAngle: The angle to stop iterating at in degrees.
+		@param points: The storage to populate, the size dictates the number of points.
+		@return: void
+		*/
+		{
+
+			Matrix matrix = rotateTo(VectorD(1.0, 0.0, 0.0), normal);
+
+			const size_t numPoints = points.size();
+			const double fraction = 1.0 / static_cast<double>(numPoints - 1);
+			const double step = (endAngle - startAngle) * fraction;
+
+			for (size_t i = 0; i < numPoints; i++)
+			{
+
+				double angle = (startAngle + (step * static_cast<double>(i))) * (PI / 180.0);
+				PointD point = PointD(0.0, radius * std::sin(angle), radius * std::cos(angle)) * matrix;
+
+				points[i] = point + center;
+
+			}
+
+		};
+
+
+		inline std::vector<PointD> arc(const VectorD& center, const VectorD& normal, const double radius, const double startAngle, const double endAngle, const int numPoints)
+		/**
+		Generates an arc that can be used as a line strip for drawables.
+		The number of divisions dictates the number of points returned.
+
+		@param center: The center of this arc.
+		@param normal: The forward vector for this arc.
+		@param radius: The radius of this arc.
+		@param startAngle: The angle to start iterating from in degrees.
+		@param endAngle: The angle to stop iterating at in degrees.
+		@param numPoints: The number of points that make up this arc.
+		@return: An array of points in object space.
+		*/
+		{
+
+			std::vector<PointD> points(numPoints);
+			arc(center, normal, radius, startAngle, endAngle, PointSpan<double>(points));
+
+			return points;
+
+		};
+
+
+		inline std::vector<PointD> square(const VectorD& center, const VectorD& normal)
+		/**
+		Generates a square for drawables.
+		The diagonal of a unit square is expressed through the square root of 2.
+
+		@param center: The center of this square.
+		@param normal: The forward vector for this square.
+		@return: An array of points in object space.
+		*/
+		{
+
+			return arc(center, normal, UNIT_SQUARE_RADIUS, 45.0, 405.0, 5);
+
+		};
+
+
+		inline std::vector<PointD> circle(const VectorD& center, const VectorD& normal, const double radius, const int numPoints)
+		/**
+		Generates a list of points that make up a circle.
+
+		@param center: The center of this circle.
+		@param normal: The forward vector for this circle.
+		@param radius: The radius of this circle.
+		@param numPoints: The number of vertices for this circle.
+		@return: An array of points in object space.
+		*/
+		{
+
+			return arc(center, normal, radius, 0.0, 360.0, numPoints);
+
+		};
+
+
+		template<typename T>
+		inline size_t stagger(Span<const Point<T>> points, Span<Point<T>> lines)
+		/**
+		Staggers a line strip into a line list inside pre-allocated storage.
+		For example: x[4] = {a, b, c, d}; becomes y[6] = {a, b, b, c, c, d};
+
+		@param points: A series of sequential points.
+		@param lines: The storage to populate, this must hold at least (size - 1) * 2 points.
+		@return: The number of points written.
+		*/
+		{
+
+			const size_t length = points.size();
+
+			if (length < 2)
+			{
+
+				return 0;
+
+			}
+
+			for (size_t i = 0, j = 0; i < (length - 1); i++, j += 2)
+			{
+
+				lines[j] = points[i];
+				lines[j + 1] = points[i + 1];
+
+			}
+
+			return (length - 1) * 2;
+
+		};
+
+
+		template<typename T>
+		inline std::vector<Point<T>> stagger(const std::vector<Point<T>>& points)
+		/**
+		Staggers a line strip into a line list.
+
+		@param points: A series of sequential points.
+		@return: An array of points suitable to pass as a line list.
+		*/
+		{
+
+			std::vector<Point<T>> lines((points.size() < 2) ? 0 : (points.size() - 1) * 2);
+			stagger(Span<const Point<T>>(points.data(), points.size()), Span<Point<T>>(lines));
+
+			return lines;
+
+		};
+
+
+		template<typename T>
+		inline std::vector<Point<T>> chain(const std::vector<std::vector<Point<T>>>& points)
+		/**
+		Takes a 2-dimensional array of points and collapses it into a single array.
+		If you're planning on merging seperate line lists make sure to stagger them before combining!
+
+		@param points: A 2D array of points.
+		@return: A flattened array.
+		*/
+		{
+
+			size_t length = 0;
+
+			for (const std::vector<Point<T>>& items : points)
+			{
+
+				length += items.size();
+
+			}
+
+			std::vector<Point<T>> newPoints;
+			newPoints.reserve(length);
+
+			for (const std::vector<Point<T>>& items : points)
+			{
+
+				newPoints.insert(newPoints.end(), items.begin(), items.end());
+
+			}
+
+			return newPoints;
+
+		};
+
+
+		template<typename T>
+		inline std::vector<Point<T>> stagger(const std::vector<std::vector<Point<T>>>& points)
+		/**
+		Staggers a series of line strips and merges them into a single line list.
+
+		@param points: A series of line strips.
+		@return: An array of points suitable to pass as a line list.
+		*/
+		{
+
+			size_t length = 0;
+
+			for (const std::vector<Point<T>>& items : points)
+			{
+
+				length += (items.size() < 2) ? 0 : (items.size() - 1) * 2;
+
+			}
+
+			std::vector<Point<T>> lines(length);
+			size_t insertAt = 0;
+
+			for (const std::vector<Point<T>>& items : points)
+			{
+
+				insertAt += stagger(Span<const Point<T>>(items.data(), items.size()), Span<Point<T>>(lines.data() + insertAt, length - insertAt));
+
+			}
+
+			return lines;
+
+		};
+
+
+		template<typename T>
+		inline void transform(const Matrix& matrix, Span<Point<T>> points)
+		/**
+		Transforms an array of points in place using the supplied transform matrix.
+		The original values will be lost!
+
+		@param matrix: Transform matrix.
+		@param points: The points to be multiplied.
+		@return: void
+		*/
+		{
+
+			for (Point<T>& point : points)
+			{
+
+				point = point * matrix;
+
+			}
+
+		};
+
+
+		template<typename T, typename U>
+		inline void transform(const Matrix& matrix, Span<const Point<T>> points, Span<Point<U>> output)
+		/**
+		Transforms an array of points into separate storage, which may use a different precision.
+
+		@param matrix: Transform matrix.
+		@param points: The points to be multiplied.
+		@param output: The storage to populate, this must be at least as large as the input.
+		@return: void
+		*/
+		{
+
+			const size_t numPoints = points.size();
+
+			for (size_t i = 0; i < numPoints; i++)
+			{
+
+				const Point<T>& point = points[i];
+				output[i] = Point<U>(point.x, point.y, point.z, point.w) * matrix;
+
+			}
+
+		};
+
+
+		inline std::vector<PointD> transform(const Matrix& matrix, const double points[][4], const int numPoints)
+		/**
+		Transforms a static array of points, returning a brand new array.
+
+		@param matrix: Transform matrix.
+		@param points: An array of points to be multiplied.
+		@param numPoints: Number of points inside the array.
+		@return: The transformed points.
+		*/
+		{
+
+			std::vector<PointD> newPoints(numPoints);
+
+			for (int i = 0; i < numPoints; i++)
+			{
+
+				newPoints[i] = PointD(points[i][0], points[i][1], points[i][2], points[i][3]) * matrix;
+
+			}
+
+			return newPoints;
+
+		};
+
+
+		inline Matrix normalMatrix(const Matrix& matrix)
+		/**
+		Returns the inverse transpose of the upper 3x3 of the supplied matrix.
+		Normals multiplied by this stay perpendicular to their surface under non-uniform scale.
+
+		@param matrix: The transform matrix.
+		@return: Matrix
+		*/
+		{
+
+			const double a = matrix(0, 0), b = matrix(0, 1), c = matrix(0, 2);
+			const double d = matrix(1, 0), e = matrix(1, 1), f = matrix(1, 2);
+			const double g = matrix(2, 0), h = matrix(2, 1), i = matrix(2, 2);
+
+			const double determinant = (a * ((e * i) - (f * h))) - (b * ((d * i) - (f * g))) + (c * ((d * h) - (e * g)));
+			const double scale = (determinant != 0.0) ? (1.0 / determinant) : 0.0;
+
+			// The inverse transpose is the cofactor matrix divided by the determinant
+			//
+			Matrix result;
+			result(0, 0) = ((e * i) - (f * h)) * scale;
+			result(0, 1) = ((f * g) - (d * i)) * scale;
+			result(0, 2) = ((d * h) - (e * g)) * scale;
+			result(1, 0) = ((c * h) - (b * i)) * scale;
+			result(1, 1) = ((a * i) - (c * g)) * scale;
+			result(1, 2) = ((b * g) - (a * h)) * scale;
+			result(2, 0) = ((b * f) - (c * e)) * scale;
+			result(2, 1) = ((c * d) - (a * f)) * scale;
+			result(2, 2) = ((a * e) - (b * d)) * scale;
+
+			return result;
+
+		};
+
+
+		template<typename T>
+		inline void transformNormals(const Matrix& matrix, Span<const Vector<T>> normals, Span<Vector<T>> output)
+		/**
+		Transforms an array of normals into separate storage using the inverse transpose of the supplied matrix.
+
+		@param matrix: Transform matrix, not the normal matrix.
+		@param normals: The normals to be multiplied.
+		@param output: The storage to populate, this must be at least as large as the input.
+		@return: void
+		*/
+		{
+
+			const Matrix inverseTranspose = normalMatrix(matrix);
+			const size_t numNormals = normals.size();
+
+			for (size_t i = 0; i < numNormals; i++)
+			{
+
+				output[i] = (normals[i] * inverseTranspose).normal();
+
+			}
+
+		};
+
+
+		inline void transform(const Matrix& matrix, const MeshBuffers& buffers, MeshBuffers& output)
+		/**
+		Transforms object space mesh buffers into reused output buffers.
+		The output is only resized when the input sizes change, so repeated calls for the same shape do not allocate.
+
+		@param matrix: Transform matrix.
+		@param buffers: The object space buffers.
+		@param output: The buffers to populate.
+		@return: void
+		*/
+		{
+
+			output.triangles.resize(buffers.triangles.size());
+			output.normals.resize(buffers.normals.size());
+			output.lines.resize(buffers.lines.size());
+
+			transform(matrix, ConstPointSpan<double>(buffers.triangles.data(), buffers.triangles.size()), PointSpan<double>(output.triangles));
+			transformNormals(matrix, Span<const VectorD>(buffers.normals.data(), buffers.normals.size()), Span<VectorD>(output.normals));
+			transform(matrix, ConstPointSpan<double>(buffers.lines.data(), buffers.lines.size()), PointSpan<double>(output.lines));
+
+		};
+
+
+		inline void transform(const Matrix& matrix, const double points[][4], const int numPoints, std::vector<PointD>& output)
+		/**
+		Transforms a static array of points into a reused array.
+
+		@param matrix: Transform matrix.
+		@param points: An array of points to be multiplied.
+		@param numPoints: Number of points inside the array.
+		@param output: The array to populate, this is only resized when the number of points changes.
+		@return: void
+		*/
+		{
+
+			output.resize(numPoints);
+
+			for (int i = 0; i < numPoints; i++)
+			{
+
+				output[i] = PointD(points[i][0], points[i][1], points[i][2], points[i][3]) * matrix;
+
+			}
+
+		};
+
+
+		inline Matrix createPositionMatrix(const double x, const double y, const double z)
+		/**
+		Returns a position matrix from the supplied x, y and z values.
+
+		@param x: The x value.
+		@param y: The y value.
+		@param z: The z value.
+		@return: The position matrix.
+		*/
+		{
+
+			Matrix matrix;
+			matrix.values[3][0] = x;
+			matrix.values[3][1] = y;
+			matrix.values[3][2] = z;
+
+			return matrix;
+
+		};
+
+
+		inline Matrix createScaleMatrix(const double x, const double y, const double z)
+		/**
+		Returns a scale matrix from the supplied x, y and z values.
+
+		@param x: The x value.
+		@param y: The y value.
+		@param z: The z value.
+		@return: The scale matrix.
+		*/
+		{
+
+			Matrix matrix;
+			matrix.values[0][0] = x;
+			matrix.values[1][1] = y;
+			matrix.values[2][2] = z;
+
+			return matrix;
+
+		};
+
+
+		inline Matrix createRotationMatrix(const double x, const double y, const double z)
+		/**
+		Returns a rotation matrix from the supplied radians using an XYZ rotation order.
+		This matches MEulerRotation(x, y, z, kXYZ).asMatrix().
+
+		@param x: The x angle in radians.
+		@param y: The y angle in radians.
+		@param z: The z angle in radians.
+		@return: The rotation matrix.
+		*/
+		{
+
+			const double cx = std::cos(x), sx = std::sin(x);
+			const double cy = std::cos(y), sy = std::sin(y);
+			const double cz = std::cos(z), sz = std::sin(z);
+
+			Matrix rotateX, rotateY, rotateZ;
+
+			rotateX.values[1][1] = cx; rotateX.values[1][2] = sx;
+			rotateX.values[2][1] = -sx; rotateX.values[2][2] = cx;
+
+			rotateY.values[0][0] = cy; rotateY.values[0][2] = -sy;
+			rotateY.values[2][0] = sy; rotateY.values[2][2] = cy;
+
+			rotateZ.values[0][0] = cz; rotateZ.values[0][1] = sz;
+			rotateZ.values[1][0] = -sz; rotateZ.values[1][1] = cz;
+
+			return rotateX * rotateY * rotateZ;
+
+		};
+
+
+		inline Matrix composeMatrix(const VectorD& center, const VectorD& normal, const VectorD& up, const VectorD& scale)
+		/**
+		Returns a transformation matrix using a position, forward/up vector and scale.
+
+		@param center: Center of transform.
+		@param normal: Vector assigned to x-axis.
+		@param up: Secondary vector used in cross product.
+		@param scale: Local space scale.
+		@return: The transform matrix.
+		*/
+		{
+
+			VectorD xAxis = normal.normal() * scale.x;
+			VectorD zAxis = normal.cross(up).normal() * scale.y;
+			VectorD yAxis = zAxis.cross(xAxis).normal() * scale.z;
+
+			Matrix matrix;
+			matrix.values[0][0] = xAxis.x; matrix.values[0][1] = xAxis.y; matrix.values[0][2] = xAxis.z;
+			matrix.values[1][0] = yAxis.x; matrix.values[1][1] = yAxis.y; matrix.values[1][2] = yAxis.z;
+			matrix.values[2][0] = zAxis.x; matrix.values[2][1] = zAxis.y; matrix.values[2][2] = zAxis.z;
+			matrix.values[3][0] = center.x; matrix.values[3][1] = center.y; matrix.values[3][2] = center.z;
+
+			return matrix;
+
+		};
+
+
+		inline void sphere(const VectorD& center, const double radius, const int subdivisionAxis, const int subdivisionHeight, Mesh& mesh)
+		/**
+		Appends a sphere primitive to the supplied mesh.
+
+		@param center: The center of the sphere.
+		@param radius: The radius of the sphere.
+		@param subdivisionAxis: The number of faces around the x-axis.
+		@param subdivisionHeight: The number of faces along the x-axis.
+		@param mesh: The mesh to append to.
+		@return: void
+		*/
+		{
+
+			const double fraction = 1.0 / static_cast<double>(subdivisionHeight);
+			const double endAngle = 360.0 - (360.0 / static_cast<double>(subdivisionAxis));
+			const VectorD xAxis(1.0, 0.0, 0.0);
+
+			std::vector<PointD> p1(subdivisionAxis), p2(subdivisionAxis);
+			PointD polygon[4];
+
+			for (int i = 0; i < subdivisionHeight; i++)
+			{
+
+				// Get center and radius of edge loops
+				//
+				double x1 = radius * std::cos((fraction * static_cast<double>(i)) * PI);
+				double y1 = radius * std::sin((fraction * static_cast<double>(i)) * PI);
+
+				double x2 = radius * std::cos((fraction * static_cast<double>(i + 1)) * PI);
+				double y2 = radius * std::sin((fraction * static_cast<double>(i + 1)) * PI);
+
+				arc(VectorD(center.x + x1, center.y, center.z), xAxis, y1, 0.0, endAngle, PointSpan<double>(p1));
+				arc(VectorD(center.x + x2, center.y, center.z), xAxis, y2, 0.0, endAngle, PointSpan<double>(p2));
+
+				for (int j = 0; j < subdivisionAxis; j++)
+				{
+
+					int startIndex = j;
+					int endIndex = (j < (subdivisionAxis - 1)) ? (startIndex + 1) : 0;
+
+					if (i == 0)
+					{
+
+						polygon[0] = p1[startIndex];
+						polygon[1] = p2[endIndex];
+						polygon[2] = p2[startIndex];
+
+						mesh.addPolygon(polygon, 3);
+
+					}
+					else if (i < (subdivisionHeight - 1))
+					{
+
+						polygon[0] = p1[startIndex];
+						polygon[1] = p1[endIndex];
+						polygon[2] = p2[endIndex];
+						polygon[3] = p2[startIndex];
+
+						mesh.addPolygon(polygon, 4);
+
+					}
+					else
+					{
+
+						polygon[0] = p1[startIndex];
+						polygon[1] = p1[endIndex];
+						polygon[2] = p2[startIndex];
+
+						mesh.addPolygon(polygon, 3);
+
+					}
+
+				}
+
+			}
+
+		};
+
+
+		inline void sector(const VectorD& center, const VectorD& normal, const double radius, const double startAngle, const double endAngle, const int subdivisionAxis, Mesh& mesh)
+		/**
+		Appends a sector to the supplied mesh.
+		This is essentially a disc but with a start and end angle.
+
+		@param center: The center of this sector.
+		@param normal: The forward vector for this sector.
+		@param radius: The radius of this sector.
+		@param startAngle: The start angle of this sector.
+		@param endAngle: The end angle of this sector.
+		@param subdivisionAxis: The number of faces around the x-axis.
+		@param mesh: The mesh to append to.
+		@return: void
+		*/
+		{
+
+			std::vector<PointD> points = arc(center, normal, radius, startAngle, endAngle, subdivisionAxis + 1);
+			PointD polygon[3];
+
+			for (size_t i = 0; i < (points.size() - 1); i++)
+			{
+
+				polygon[0] = points[i];
+				polygon[1] = points[i + 1];
+				polygon[2] = PointD(center);
+
+				mesh.addPolygon(polygon, 3);
+
+			}
+
+		};
+
+
+		inline void disc(const VectorD& center, const VectorD& normal, const double radius, const int subdivisionAxis, Mesh& mesh)
+		/**
+		Appends a disc to the supplied mesh.
+
+		@param center: The center of this disc.
+		@param normal: The forward vector for this disc.
+		@param radius: The radius of this disc.
+		@param subdivisionAxis: The number of faces around the x-axis.
+		@param mesh: The mesh to append to.
+		@return: void
+		*/
+		{
+
+			sector(center, normal, radius, 0.0, 360.0, subdivisionAxis, mesh);
+
+		};
+
+
+		inline void cylinder(const VectorD& center, const VectorD& normal, const double radius, const double length, const int subdivisionAxis, Mesh& mesh)
+		/**
+		Appends a cylinder to the supplied mesh.
+
+		@param center: The center of this cylinder.
+		@param normal: The forward vector for this cylinder.
+		@param radius: The radius of this cylinder.
+		@param length: The length of this cylinder.
+		@param subdivisionAxis: The number of faces around the x-axis.
+		@param mesh: The mesh to append to.
+		@return: void
+		*/
+		{
+
+			std::vector<PointD> points = circle(center, normal, radius, subdivisionAxis + 1);
+
+			VectorD offset = normal * (length * 0.5);
+			PointD polygon[4];
+
+			for (size_t i = 0; i < (points.size() - 1); i++)
+			{
+
+				// Add front cap segment
+				//
+				polygon[0] = points[i] + offset;
+				polygon[1] = points[i + 1] + offset;
+				polygon[2] = PointD(center + offset);
+
+				mesh.addPolygon(polygon, 3);
+
+				// Add back cap segment
+				//
+				polygon[0] = points[i] - offset;
+				polygon[1] = points[i + 1] - offset;
+				polygon[2] = PointD(center - offset);
+
+				mesh.addPolygon(polygon, 3);
+
+				// Bridge caps
+				//
+				polygon[0] = points[i] + offset;
+				polygon[1] = points[i + 1] + offset;
+				polygon[2] = points[i + 1] - offset;
+				polygon[3] = points[i] - offset;
+
+				mesh.addPolygon(polygon, 4);
+
+			}
+
+		};
+
+
+		inline VectorD getPolygonNormal(const Mesh& mesh, const int* connects, const int count)
+		/**
+		Returns the normal of a polygon using Newell's method.
+
+		@param mesh: The mesh the polygon belongs to.
+		@param connects: The polygon's vertex indices.
+		@param count: The number of polygon vertices.
+		@return: The polygon normal.
+		*/
+		{
+
+			VectorD normal;
+
+			for (int i = 0; i < count; i++)
+			{
+
+				const PointD& current = mesh.points[connects[i]];
+				const PointD& next = mesh.points[connects[(i + 1) % count]];
+
+				normal.x += (current.y - next.y) * (current.z + next.z);
+				normal.y += (current.z - next.z) * (current.x + next.x);
+				normal.z += (current.x - next.x) * (current.y + next.y);
+
+			}
+
+			return normal.normal();
+
+		};
+
+
+		inline std::vector<Edge> getEdges(const Mesh& mesh)
+		/**
+		Returns the unique edges of the supplied mesh along with their connected faces.
+
+		@param mesh: The mesh to query.
+		@return: An array of edges.
+		*/
+		{
+
+			std::vector<Edge> edges;
+			std::unordered_map<uint64_t, size_t> lookup;
+
+			const size_t numPolygons = mesh.numPolygons();
+			size_t offset = 0;
+
+			for (size_t polygonIndex = 0; polygonIndex < numPolygons; polygonIndex++)
+			{
+
+				const int count = mesh.polygonCounts[polygonIndex];
+
+				for (int i = 0; i < count; i++)
+				{
+
+					int start = mesh.polygonConnects[offset + i];
+					int end = mesh.polygonConnects[offset + ((i + 1) % count)];
+
+					uint64_t key = (start < end) ? ((uint64_t(start) << 32) | uint32_t(end)) : ((uint64_t(end) << 32) | uint32_t(start));
+					auto found = lookup.find(key);
+
+					if (found == lookup.end())
+					{
+
+						lookup.emplace(key, edges.size());
+						edges.push_back(Edge{ start, end, { static_cast<int>(polygonIndex), -1 }, 1 });
+
+					}
+					else
+					{
+
+						Edge& edge = edges[found->second];
+
+						if (edge.numFaces < 2)
+						{
+
+							edge.faces[edge.numFaces] = static_cast<int>(polygonIndex);
+
+						}
+
+						edge.numFaces++;
+
+					}
+
+				}
+
+				offset += count;
+
+			}
+
+			return edges;
+
+		};
+
+
+		inline std::vector<int> getBoundary(const std::vector<Edge>& edges)
+		/**
+		Returns the indices of all edges that only belong to a single face.
+
+		@param edges: The edges to query.
+		@return: An array of edge indices.
+		*/
+		{
+
+			std::vector<int> boundary;
+
+			for (size_t i = 0; i < edges.size(); i++)
+			{
+
+				if (edges[i].numFaces == 1)
+				{
+
+					boundary.push_back(static_cast<int>(i));
+
+				}
+
+			}
+
+			return boundary;
+
+		};
+
+
+		inline void getLines(const Mesh& mesh, const std::vector<Edge>& edges, const std::vector<int>& elements, std::vector<PointD>& lines)
+		/**
+		Populates a line list from a set of edge indices.
+
+		@param mesh: The mesh the edges belong to.
+		@param edges: The mesh edges.
+		@param elements: The edge indices to extract.
+		@param lines: The line list to populate.
+		@return: void
+		*/
+		{
+
+			lines.resize(elements.size() * 2);
+
+			for (size_t i = 0; i < elements.size(); i++)
+			{
+
+				const Edge& edge = edges[elements[i]];
+
+				lines[(i * 2)] = mesh.points[edge.start];
+				lines[(i * 2) + 1] = mesh.points[edge.end];
+
+			}
+
+		};
+
+
+		inline void getLines(const Mesh& mesh, std::vector<PointD>& lines)
+		/**
+		Populates a line list from every edge on the supplied mesh.
+
+		@param mesh: The mesh to query.
+		@param lines: The line list to populate.
+		@return: void
+		*/
+		{
+
+			std::vector<Edge> edges = getEdges(mesh);
+			lines.resize(edges.size() * 2);
+
+			for (size_t i = 0; i < edges.size(); i++)
+			{
+
+				lines[(i * 2)] = mesh.points[edges[i].start];
+				lines[(i * 2) + 1] = mesh.points[edges[i].end];
+
+			}
+
+		};
+
+
+		inline void getTriangles(const Mesh& mesh, std::vector<PointD>& triangles, std::vector<VectorD>& normals, const double smoothingAngle = SMOOTHING_ANGLE)
+		/**
+		Triangulates the supplied mesh into a flat triangle list with face-vertex normals.
+		Adjacent faces that meet below the smoothing angle share their normals, a smoothing angle of zero produces hard edges.
+
+		@param mesh: The mesh to triangulate.
+		@param triangles: The triangle list to populate.
+		@param normals: The normal list to populate.
+		@param smoothingAngle: The angle in degrees below which faces are smoothed.
+		@return: void
+		*/
+		{
+
+			const size_t numPolygons = mesh.numPolygons();
+
+			// Calculate face normals and collect the faces around each vertex
+			//
+			std::vector<VectorD> faceNormals(numPolygons);
+			std::vector<std::vector<int>> vertexFaces(mesh.numVertices());
+
+			size_t numTriangles = 0, offset = 0;
+
+			for (size_t polygonIndex = 0; polygonIndex < numPolygons; polygonIndex++)
+			{
+
+				const int count = mesh.polygonCounts[polygonIndex];
+				faceNormals[polygonIndex] = getPolygonNormal(mesh, &mesh.polygonConnects[offset], count);
+
+				for (int i = 0; i < count; i++)
+				{
+
+					vertexFaces[mesh.polygonConnects[offset + i]].push_back(static_cast<int>(polygonIndex));
+
+				}
+
+				numTriangles += (count > 2) ? (count - 2) : 0;
+				offset += count;
+
+			}
+
+			// Fan triangulate each polygon
+			//
+			const double threshold = std::cos(smoothingAngle * (PI / 180.0));
+			const bool smooth = smoothingAngle > 0.0;
+
+			triangles.resize(numTriangles * 3);
+			normals.resize(numTriangles * 3);
+
+			size_t insertAt = 0;
+			offset = 0;
+
+			auto vertexNormal = [&](const int vertexIndex, const size_t polygonIndex) -> VectorD
+			{
+
+				const VectorD& faceNormal = faceNormals[polygonIndex];
+
+				if (!smooth)
+				{
+
+					return faceNormal;
+
+				}
+
+				VectorD sum;
+
+				for (int otherIndex : vertexFaces[vertexIndex])
+				{
+
+					const VectorD& otherNormal = faceNormals[otherIndex];
+
+					if (faceNormal.dot(otherNormal) >= threshold)
+					{
+
+						sum += otherNormal;
+
+					}
+
+				}
+
+				return sum.normal();
+
+			};
+
+			for (size_t polygonIndex = 0; polygonIndex < numPolygons; polygonIndex++)
+			{
+
+				const int count = mesh.polygonCounts[polygonIndex];
+				const int* connects = &mesh.polygonConnects[offset];
+
+				for (int i = 1; i < (count - 1); i++)
+				{
+
+					const int indices[3] = { connects[0], connects[i], connects[i + 1] };
+
+					for (int j = 0; j < 3; j++)
+					{
+
+						triangles[insertAt] = mesh.points[indices[j]];
+						normals[insertAt] = vertexNormal(indices[j], polygonIndex);
+
+						insertAt++;
+
+					}
+
+				}
+
+				offset += count;
+
+			}
+
+		};
+
+
+		inline void getMeshBuffers(const Mesh& mesh, MeshBuffers& buffers)
+		/**
+		Extracts the triangles, normals and edge lines from the supplied mesh.
+
+		@param mesh: The mesh to extract from.
+		@param buffers: The buffers to populate.
+		@return: void
+		*/
+		{
+
+			getTriangles(mesh, buffers.triangles, buffers.normals);
+			getLines(mesh, buffers.lines);
+
+		};
+
+
+
+		inline void transformAffine(const Matrix& matrix, ConstPointSpan<double> points, PointSpan<double> output)
+		/**
+		Transforms points with w = 1 by an affine matrix into separate storage.
+		On SSE2 targets each point is processed as two pairs of lanes, otherwise this falls back to the scalar product.
+
+		@param matrix: Affine transform matrix.
+		@param points: The points to be multiplied.
+		@param output: The storage to populate, this must be at least as large as the input.
+		@return: void
+		*/
+		{
+
+			const size_t numPoints = points.size();
+
+#if DRAWABLE_CORE_SSE2
+
+			const __m128d row0xy = _mm_loadu_pd(&matrix.values[0][0]), row0zw = _mm_loadu_pd(&matrix.values[0][2]);
+			const __m128d row1xy = _mm_loadu_pd(&matrix.values[1][0]), row1zw = _mm_loadu_pd(&matrix.values[1][2]);
+			const __m128d row2xy = _mm_loadu_pd(&matrix.values[2][0]), row2zw = _mm_loadu_pd(&matrix.values[2][2]);
+			const __m128d row3xy = _mm_loadu_pd(&matrix.values[3][0]), row3zw = _mm_loadu_pd(&matrix.values[3][2]);
+
+			for (size_t i = 0; i < numPoints; i++)
+			{
+
+				const __m128d x = _mm_set1_pd(points[i].x);
+				const __m128d y = _mm_set1_pd(points[i].y);
+				const __m128d z = _mm_set1_pd(points[i].z);
+
+				const __m128d xy = _mm_add_pd(_mm_add_pd(_mm_mul_pd(x, row0xy), _mm_mul_pd(y, row1xy)), _mm_add_pd(_mm_mul_pd(z, row2xy), row3xy));
+				const __m128d zw = _mm_add_pd(_mm_add_pd(_mm_mul_pd(x, row0zw), _mm_mul_pd(y, row1zw)), _mm_add_pd(_mm_mul_pd(z, row2zw), row3zw));
+
+				_mm_storeu_pd(&output[i].x, xy);
+				_mm_storeu_pd(&output[i].z, zw);
+
+			}
+
+#else
+
+			for (size_t i = 0; i < numPoints; i++)
+			{
+
+				output[i] = PointD(points[i].x, points[i].y, points[i].z, 1.0) * matrix;
+
+			}
+
+#endif
+
+		};
+
+
+		struct Plane
+		/**
+		A plane stored as ax + by + cz + d = 0, where points with a positive distance are inside.
+		*/
+		{
+
+			double a = 0.0, b = 0.0, c = 0.0, d = 0.0;
+
+			double distance(const PointD& point) const { return (a * point.x) + (b * point.y) + (c * point.z) + d; };
+
+		};
+
+
+		inline void frustumPlanes(const Matrix& viewProjection, Plane planes[6])
+		/**
+		Extracts the left, right, bottom, top, near and far planes from a view projection matrix.
+		With the row-vector convention each clip coordinate is a column, so every plane is the w column plus or minus another column.
+		Planes are normalized so distances are in world units.
+
+		@param viewProjection: The world to clip space matrix.
+		@param planes: The passed array to populate.
+		@return: void
+		*/
+		{
+
+			for (int i = 0; i < 6; i++)
+			{
+
+				const int column = i / 2;
+				const double sign = (i % 2 == 0) ? 1.0 : -1.0;
+
+				Plane& plane = planes[i];
+				plane.a = viewProjection(0, 3) + (sign * viewProjection(0, column));
+				plane.b = viewProjection(1, 3) + (sign * viewProjection(1, column));
+				plane.c = viewProjection(2, 3) + (sign * viewProjection(2, column));
+				plane.d = viewProjection(3, 3) + (sign * viewProjection(3, column));
+
+				const double length = std::sqrt((plane.a * plane.a) + (plane.b * plane.b) + (plane.c * plane.c));
+
+				if (length > 0.0)
+				{
+
+					plane.a /= length;
+					plane.b /= length;
+					plane.c /= length;
+					plane.d /= length;
+
+				}
+
+			}
+
+		};
+
+
+		inline bool isSphereVisible(const Plane planes[6], const PointD& center, const double radius)
+		/**
+		Evaluates if a bounding sphere intersects the frustum described by the supplied planes.
+		This is conservative, so spheres near a frustum corner may be reported as visible.
+
+		@param planes: The frustum planes.
+		@param center: The sphere center.
+		@param radius: The sphere radius.
+		@return: bool
+		*/
+		{
+
+			for (int i = 0; i < 6; i++)
+			{
+
+				if (planes[i].distance(center) < -radius)
+				{
+
+					return false;
+
+				}
+
+			}
+
+			return true;
+
+		};
+
+
+		inline double boundingRadius(const Matrix& matrix, const double radius)
+		/**
+		Returns the radius of a sphere, centered on the matrix's translation, that encloses a local sphere of the supplied radius.
+
+		@param matrix: The transform matrix.
+		@param radius: The local radius.
+		@return: double
+		*/
+		{
+
+			double maxScale = 0.0;
+
+			for (int row = 0; row < 3; row++)
+			{
+
+				const double scale = std::sqrt((matrix(row, 0) * matrix(row, 0)) + (matrix(row, 1) * matrix(row, 1)) + (matrix(row, 2) * matrix(row, 2)));
+				maxScale = (scale > maxScale) ? scale : maxScale;
+
+			}
+
+			return radius * maxScale;
+
+		};
+
+
+		inline void appendInstance(const Matrix& matrix, const MeshBuffers& shape, const bool includeTriangles, MeshBuffers& batch)
+		/**
+		Transforms an object space shape and appends it to a batch shared by many instances.
+		Clearing the batch between frames keeps its capacity, so a steady number of instances does not allocate.
+
+		@param matrix: The instance's affine transform matrix.
+		@param shape: The object space shape.
+		@param includeTriangles: If false only the lines are appended.
+		@param batch: The buffers to append to.
+		@return: void
+		*/
+		{
+
+			if (includeTriangles && !shape.triangles.empty())
+			{
+
+				const size_t numTriangles = batch.triangles.size();
+				const size_t numNormals = batch.normals.size();
+
+				batch.triangles.resize(numTriangles + shape.triangles.size());
+				batch.normals.resize(numNormals + shape.normals.size());
+
+				transformAffine(matrix, ConstPointSpan<double>(shape.triangles.data(), shape.triangles.size()), PointSpan<double>(batch.triangles.data() + numTriangles, shape.triangles.size()));
+				transformNormals(matrix, Span<const VectorD>(shape.normals.data(), shape.normals.size()), Span<VectorD>(batch.normals.data() + numNormals, shape.normals.size()));
+
+			}
+
+			if (!shape.lines.empty())
+			{
+
+				const size_t numLines = batch.lines.size();
+				batch.lines.resize(numLines + shape.lines.size());
+
+				transformAffine(matrix, ConstPointSpan<double>(shape.lines.data(), shape.lines.size()), PointSpan<double>(batch.lines.data() + numLines, shape.lines.size()));
+
+			}
+
+		};
+
+
+
+		template<typename Evaluate>
+		inline void tessellateCurve(Evaluate evaluate, const double start, const double end, const size_t numSegments, const double tolerance, const int maxDepth, std::vector<PointD>& lines)
+		/**
+		Adaptively tessellates a parametric curve into line segments appended to the supplied array as point pairs.
+		The domain is split into even segments, each of which is halved until its midpoint lies within the tolerance of its chord.
+		Segments are processed with an explicit stack so points are emitted in order without recursion.
+
+		@param evaluate: A callable returning the PointD at a parameter.
+		@param start: The start of the curve's domain.
+		@param end: The end of the curve's domain.
+		@param numSegments: The number of even segments to start from, at least one per span keeps inflections from being skipped.
+		@param tolerance: The maximum distance between the curve and its line segments.
+		@param maxDepth: The maximum number of times a segment is halved.
+		@param lines: The passed array to append to.
+		@return: void
+		*/
+		{
+
+			struct Segment
+			{
+
+				double	start;
+				PointD	startPoint;
+				double	end;
+				PointD	endPoint;
+				int		depth;
+
+			};
+
+			const size_t count = (numSegments > 0) ? numSegments : 1;
+			const double step = (end - start) / static_cast<double>(count);
+
+			std::vector<Segment> stack;
+			PointD previous = evaluate(start);
+
+			for (size_t i = 0; i < count; i++)
+			{
+
+				const double segmentEnd = (i + 1 == count) ? end : start + (step * static_cast<double>(i + 1));
+				stack.push_back(Segment{ start + (step * static_cast<double>(i)), previous, segmentEnd, evaluate(segmentEnd), 0 });
+
+				while (!stack.empty())
+				{
+
+					const Segment segment = stack.back();
+					stack.pop_back();
+
+					const double middle = (segment.start + segment.end) * 0.5;
+					const PointD middlePoint = evaluate(middle);
+					const PointD chordPoint((segment.startPoint.x + segment.endPoint.x) * 0.5, (segment.startPoint.y + segment.endPoint.y) * 0.5, (segment.startPoint.z + segment.endPoint.z) * 0.5);
+
+					if (segment.depth < maxDepth && (middlePoint - chordPoint).length() > tolerance)
+					{
+
+						// The second half is pushed first so the first half is emitted first
+						//
+						stack.push_back(Segment{ middle, middlePoint, segment.end, segment.endPoint, segment.depth + 1 });
+						stack.push_back(Segment{ segment.start, segment.startPoint, middle, middlePoint, segment.depth + 1 });
+
+					}
+					else
+					{
+
+						lines.push_back(segment.startPoint);
+						lines.push_back(segment.endPoint);
+
+					}
+
+				}
+
+				previous = lines.back();
+
+			}
+
+		};
+
+		inline uint64_t hashBytes(const void* data, const size_t size, const uint64_t seed = 14695981039346656037ull)
+		/**
+		Returns the 64-bit FNV-1a hash of the supplied bytes.
+		The seed can be a previous hash to combine several ranges.
+
+		@param data: The bytes to hash.
+		@param size: The number of bytes.
+		@param seed: The hash to start from.
+		@return: uint64_t
+		*/
+		{
+
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			uint64_t hash = seed;
+
+			for (size_t i = 0; i < size; i++)
+			{
+
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+
+			}
+
+			return hash;
+
+		};
+
+
+		struct IndexedBuffers
+		/**
+		Welded float vertices with separate line and triangle index lists, laid out for persistent GPU vertex and index buffers.
+		Lines and triangles share one vertex list, line vertices reuse any triangle vertex at the same position.
+		*/
+		{
+
+			std::vector<float>		positions;
+			std::vector<float>		normals;
+			std::vector<uint32_t>	lineIndices;
+			std::vector<uint32_t>	triangleIndices;
+
+			size_t numVertices() const { return positions.size() / 3; };
+
+			void clear()
+			{
+
+				positions.clear();
+				normals.clear();
+				lineIndices.clear();
+				triangleIndices.clear();
+
+			};
+
+		};
+
+
+		inline void buildIndexedBuffers(const MeshBuffers& source, IndexedBuffers& output)
+		/**
+		Welds the triangle and line lists of the supplied buffers into indexed float buffers.
+		Triangle vertices are only shared when both their position and normal match exactly, so hard edges keep their normals.
+		Triangles without normals are given a zero normal.
+
+		@param source: The triangle and line lists to weld.
+		@param output: The passed buffers to populate.
+		@return: void
+		*/
+		{
+
+			output.clear();
+
+			struct VertexKey
+			{
+
+				float	values[6];
+
+				bool operator==(const VertexKey& other) const
+				{
+
+					for (int i = 0; i < 6; i++)
+					{
+
+						if (values[i] != other.values[i])
+						{
+
+							return false;
+
+						}
+
+					}
+
+					return true;
+
+				};
+
+			};
+
+			struct VertexKeyHash
+			{
+
+				size_t operator()(const VertexKey& key) const
+				{
+
+					return static_cast<size_t>(hashBytes(key.values, sizeof(key.values)));
+
+				};
+
+			};
+
+			std::unordered_map<VertexKey, uint32_t, VertexKeyHash> vertices;
+			std::unordered_map<VertexKey, uint32_t, VertexKeyHash> positions;
+
+			auto addVertex = [&output, &vertices, &positions](const PointD& point, const VectorD* normal)
+			{
+
+				VertexKey position = {{ static_cast<float>(point.x), static_cast<float>(point.y), static_cast<float>(point.z), 0.0f, 0.0f, 0.0f }};
+				VertexKey key = position;
+
+				if (normal != nullptr)
+				{
+
+					key.values[3] = static_cast<float>(normal->x);
+					key.values[4] = static_cast<float>(normal->y);
+					key.values[5] = static_cast<float>(normal->z);
+
+				}
+				else
+				{
+
+					// Line vertices can use any vertex at the same position
+					//
+					auto found = positions.find(position);
+
+					if (found != positions.end())
+					{
+
+						return found->second;
+
+					}
+
+				}
+
+				auto inserted = vertices.emplace(key, static_cast<uint32_t>(output.positions.size() / 3));
+
+				if (inserted.second)
+				{
+
+					output.positions.insert(output.positions.end(), key.values, key.values + 3);
+					output.normals.insert(output.normals.end(), key.values + 3, key.values + 6);
+
+					positions.emplace(position, inserted.first->second);
+
+				}
+
+				return inserted.first->second;
+
+			};
+
+			const bool hasNormals = (source.normals.size() == source.triangles.size());
+
+			output.triangleIndices.reserve(source.triangles.size());
+
+			for (size_t i = 0; i < source.triangles.size(); i++)
+			{
+
+				output.triangleIndices.push_back(addVertex(source.triangles[i], hasNormals ? &source.normals[i] : nullptr));
+
+			}
+
+			output.lineIndices.reserve(source.lines.size());
+
+			for (size_t i = 0; i < source.lines.size(); i++)
+			{
+
+				output.lineIndices.push_back(addVertex(source.lines[i], nullptr));
+
+			}
+
+		};
+
+
+		template<typename Key, typename Value, typename Hash>
+		class SharedCache
+		/**
+		A thread safe cache of immutable values keyed by the inputs they were built from, so equal inputs share one value.
+		Values are reference counted, callers keep a value alive for as long as they hold it even after it is evicted.
+		Once the cache holds more than its capacity, the least recently used values that nothing else holds are evicted first.
+		Values that are still held are never evicted, so the capacity only bounds the idle values kept for reuse.
+		*/
+		{
+
+		public:
+
+			explicit SharedCache(const size_t capacity) : capacity(capacity) {};
+
+			std::shared_ptr<const Value> find(const Key& key)
+			/**
+			Returns the value built from the supplied key, or a null pointer if there is none.
+			A found value becomes the most recently used.
+
+			@param key: The key to look up.
+			@return: std::shared_ptr<const Value>
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+
+				auto found = this->entries.find(key);
+
+				if (found == this->entries.end())
+				{
+
+					this->misses++;
+					return nullptr;
+
+				}
+
+				this->order.splice(this->order.begin(), this->order, found->second);
+				this->hits++;
+
+				return found->second->second;
+
+			};
+
+			std::shared_ptr<const Value> insert(const Key& key, std::shared_ptr<const Value> value)
+			/**
+			Adds a value built from the supplied key and returns the shared value.
+			If another caller inserted the same key first, its value is returned instead so both share it.
+
+			@param key: The key the value was built from.
+			@param value: The value to add.
+			@return: std::shared_ptr<const Value>
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+
+				auto found = this->entries.find(key);
+
+				if (found != this->entries.end())
+				{
+
+					this->order.splice(this->order.begin(), this->order, found->second);
+					return found->second->second;
+
+				}
+
+				this->order.emplace_front(key, value);
+				this->entries.emplace(key, this->order.begin());
+
+				this->evict();
+
+				return value;
+
+			};
+
+			void setCapacity(const size_t capacity)
+			/**
+			Updates the number of values to keep and evicts any idle values over it.
+
+			@param capacity: The new capacity.
+			@return: void
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+
+				this->capacity = capacity;
+				this->evict();
+
+			};
+
+			void clear()
+			/**
+			Releases every value, callers that still hold one keep it.
+
+			@return: void
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+
+				this->entries.clear();
+				this->order.clear();
+
+			};
+
+			size_t size()
+			/**
+			Returns the number of values in the cache.
+
+			@return: size_t
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+				return this->entries.size();
+
+			};
+
+			uint64_t hitCount()
+			/**
+			Returns the number of lookups that found a value.
+
+			@return: uint64_t
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+				return this->hits;
+
+			};
+
+			uint64_t missCount()
+			/**
+			Returns the number of lookups that found nothing.
+
+			@return: uint64_t
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+				return this->misses;
+
+			};
+
+			template<typename Visit>
+			void forEach(Visit visit)
+			/**
+			Calls the supplied function with every value in the cache, from the most to the least recently used.
+
+			@param visit: A callable taking a const Value&.
+			@return: void
+			*/
+			{
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+
+				for (const auto& entry : this->order)
+				{
+
+					visit(*entry.second);
+
+				}
+
+			};
+
+		protected:
+
+			void evict()
+			{
+
+				// Release from the least recently used end until the cache is back under capacity
+				// Values that are still held are stepped over where they are, at most MAX_EVICTION_STEPS of them per insert so the walk stays bounded
+				//
+				auto iter = this->order.end();
+				size_t numSkipped = 0;
+
+				while (this->entries.size() > this->capacity && iter != this->order.begin() && numSkipped < MAX_EVICTION_STEPS)
+				{
+
+					--iter;
+
+					if (iter->second.use_count() > 1)
+					{
+
+						numSkipped++;
+						continue;
+
+					}
+
+					this->entries.erase(iter->first);
+					iter = this->order.erase(iter);
+
+				}
+
+			};
+
+			static const size_t MAX_EVICTION_STEPS = 64;
+
+			using Entry = std::pair<Key, std::shared_ptr<const Value>>;
+
+			size_t														capacity;
+			std::list<Entry>											order;
+			std::unordered_map<Key, typename std::list<Entry>::iterator, Hash>	entries;
+			uint64_t													hits = 0;
+			uint64_t													misses = 0;
+			std::mutex													mutex;
+
+		};
+
+
+	};
+
+};
+#endif
@@ -0,0 +1,1127 @@
+#ifndef _POINT_HELPER_DRAWABLE_IO
+#define _POINT_HELPER_DRAWABLE_IO
+//
+// File: DrawableIO.h
+//
+// Author: Ben Singleton
+//
+// Header-only readers and writers for helper data exchanged with other tools.
+// Like DrawableCore.h nothing in here depends on the Maya API so it can be benchmarked on any machine!
+// Files are streamed in fixed-size chunks so their contents are never held in memory as a whole.
+//
+
+#include "DrawableCore.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace Drawable
+{
+
+	namespace IO
+	{
+
+		constexpr size_t	DEFAULT_CHUNK_SIZE = 16 * 1024 * 1024;
+		constexpr size_t	MIN_PARALLEL_RECORDS = 4096;
+
+		constexpr char		EXPORT_MAGIC[4] = { 'P', 'H', 'E', 'X' };
+		constexpr uint32_t	EXPORT_VERSION = 1;
+		constexpr size_t	EXPORT_HEADER_SIZE = 32;
+
+
+		enum class RecordLayout
+		{
+
+			Matrix44d = 0,
+			Matrix44f,
+			TRSd,
+			TRSf
+
+		};
+
+
+		struct RecordFormat
+		/**
+		Describes one fixed-size binary record.
+		A record holds a row-major 4x4 matrix, or translate, rotate and scale triples with rotations in radians applied in XYZ order.
+		Optional fields follow it, an int32 shape mask and then three float32 color channels.
+		Every value is little-endian.
+		*/
+		{
+
+			RecordLayout	layout = RecordLayout::Matrix44d;
+			bool			shapes = false;
+			bool			colors = false;
+
+			size_t transformSize() const
+			{
+
+				switch (layout)
+				{
+
+				case RecordLayout::Matrix44d: return 16 * sizeof(double);
+				case RecordLayout::Matrix44f: return 16 * sizeof(float);
+				case RecordLayout::TRSd: return 9 * sizeof(double);
+				case RecordLayout::TRSf: return 9 * sizeof(float);
+				default: return 0;
+
+				}
+
+			};
+
+			size_t recordSize() const { return transformSize() + (shapes ? sizeof(int32_t) : 0) + (colors ? 3 * sizeof(float) : 0); };
+
+		};
+
+
+		struct HelperRecords
+		/**
+		Decoded helper records stored as parallel arrays.
+		The shape and color arrays are empty when the source did not supply them.
+		*/
+		{
+
+			std::vector<Core::Matrix>	matrices;
+			std::vector<int32_t>		shapeMasks;
+			std::vector<Core::VectorD>	colors;
+
+			size_t size() const { return matrices.size(); };
+
+			void clear()
+			{
+
+				matrices.clear();
+				shapeMasks.clear();
+				colors.clear();
+
+			};
+
+		};
+
+
+		inline bool parseRecordLayout(const std::string& name, RecordLayout& layout)
+		/**
+		Looks up a record layout by name: "m44d", "m44f", "trsd" or "trsf".
+
+		@param name: The layout name.
+		@param layout: The passed layout to update.
+		@return: bool
+		*/
+		{
+
+			const char* names[] = { "m44d", "m44f", "trsd", "trsf" };
+
+			for (int i = 0; i < 4; i++)
+			{
+
+				if (name == names[i])
+				{
+
+					layout = static_cast<RecordLayout>(i);
+					return true;
+
+				}
+
+			}
+
+			return false;
+
+		};
+
+
+		inline unsigned int threadCount(const size_t numItems)
+		/**
+		Returns the number of threads worth using for the supplied number of items.
+
+		@param numItems: The number of items to process.
+		@return: unsigned int
+		*/
+		{
+
+			const unsigned int numThreads = std::max(1u, std::thread::hardware_concurrency());
+			const size_t wanted = std::max(size_t(1), numItems / MIN_PARALLEL_RECORDS);
+
+			return static_cast<unsigned int>(std::min(size_t(numThreads), wanted));
+
+		};
+
+
+		template<typename Function>
+		inline void parallelFor(const size_t numItems, const unsigned int numThreads, const Function& function)
+		/**
+		Splits the supplied range into contiguous blocks and calls the function once per block.
+		The calling thread processes the last block, so a single thread never spawns.
+
+		@param numItems: The number of items.
+		@param numThreads: The number of blocks.
+		@param function: Callable taking the begin and end items of a block.
+		@return: void
+		*/
+		{
+
+			const unsigned int numBlocks = std::max(1u, numThreads);
+			const size_t blockSize = (numItems + numBlocks - 1) / numBlocks;
+
+			std::vector<std::thread> threads;
+			threads.reserve(numBlocks - 1);
+
+			for (unsigned int i = 0; i + 1 < numBlocks; i++)
+			{
+
+				const size_t begin = std::min(numItems, i * blockSize);
+				const size_t end = std::min(numItems, begin + blockSize);
+
+				threads.emplace_back(function, begin, end);
+
+			}
+
+			function(std::min(numItems, (numBlocks - 1) * blockSize), numItems);
+
+			for (std::thread& thread : threads)
+			{
+
+				thread.join();
+
+			}
+
+		};
+
+
+		template<typename T>
+		inline T readLittleEndian(const char* data)
+		/**
+		Reads a little-endian value from unaligned storage.
+
+		@param data: The bytes to read.
+		@return: T
+		*/
+		{
+
+			unsigned char bytes[sizeof(T)];
+			std::memcpy(bytes, data, sizeof(T));
+
+			const uint16_t probe = 1;
+
+			if (*reinterpret_cast<const unsigned char*>(&probe) != 1)
+			{
+
+				std::reverse(bytes, bytes + sizeof(T));
+
+			}
+
+			T value;
+			std::memcpy(&value, bytes, sizeof(T));
+
+			return value;
+
+		};
+
+
+		inline Core::Matrix composeTRS(const double values[9])
+		/**
+		Returns a matrix from translate, rotate and scale triples, rotations are in radians and applied in XYZ order.
+
+		@param values: The translate, rotate and scale values.
+		@return: Core::Matrix
+		*/
+		{
+
+			return Core::createScaleMatrix(values[6], values[7], values[8]) * Core::createRotationMatrix(values[3], values[4], values[5]) * Core::createPositionMatrix(values[0], values[1], values[2]);
+
+		};
+
+
+		inline void decodeRecords(const RecordFormat& format, const char* data, const size_t numRecords, Core::Matrix* matrices, int32_t* shapeMasks, Core::VectorD* colors)
+		/**
+		Decodes consecutive binary records into the supplied storage.
+
+		@param format: The record format.
+		@param data: The encoded records.
+		@param numRecords: The number of records to decode.
+		@param matrices: The storage for the matrices.
+		@param shapeMasks: The storage for the shape masks, ignored if the format has none.
+		@param colors: The storage for the colors, ignored if the format has none.
+		@return: void
+		*/
+		{
+
+			const size_t recordSize = format.recordSize();
+			const size_t transformSize = format.transformSize();
+
+			for (size_t i = 0; i < numRecords; i++)
+			{
+
+				const char* record = data + (i * recordSize);
+
+				switch (format.layout)
+				{
+
+				case RecordLayout::Matrix44d:
+				case RecordLayout::Matrix44f:
+				{
+
+					for (int j = 0; j < 16; j++)
+					{
+
+						matrices[i].values[j / 4][j % 4] = (format.layout == RecordLayout::Matrix44d) ? readLittleEndian<double>(record + (j * sizeof(double))) : double(readLittleEndian<float>(record + (j * sizeof(float))));
+
+					}
+
+					break;
+
+				}
+
+				case RecordLayout::TRSd:
+				case RecordLayout::TRSf:
+				{
+
+					double values[9];
+
+					for (int j = 0; j < 9; j++)
+					{
+
+						values[j] = (format.layout == RecordLayout::TRSd) ? readLittleEndian<double>(record + (j * sizeof(double))) : double(readLittleEndian<float>(record + (j * sizeof(float))));
+
+					}
+
+					matrices[i] = composeTRS(values);
+					break;
+
+				}
+
+				}
+
+				const char* fields = record + transformSize;
+
+				if (format.shapes)
+				{
+
+					shapeMasks[i] = readLittleEndian<int32_t>(fields);
+					fields += sizeof(int32_t);
+
+				}
+
+				if (format.colors)
+				{
+
+					colors[i] = Core::VectorD(readLittleEndian<float>(fields), readLittleEndian<float>(fields + sizeof(float)), readLittleEndian<float>(fields + (2 * sizeof(float))));
+
+				}
+
+			}
+
+		};
+
+
+		template<typename Consumer>
+		inline bool readBinaryRecords(std::istream& stream, const RecordFormat& format, size_t chunkSize, const Consumer& consume, std::string& error)
+		/**
+		Streams fixed-size binary records in chunks and decodes each chunk in parallel.
+		Only one chunk of encoded and decoded records is held at a time, each decoded chunk is handed to the consumer in file order.
+
+		@param stream: The binary input stream.
+		@param format: The record format.
+		@param chunkSize: The approximate number of bytes read per chunk.
+		@param consume: Callable taking the decoded records of one chunk.
+		@param error: The passed string to populate if reading fails.
+		@return: bool
+		*/
+		{
+
+			const size_t recordSize = format.recordSize();
+
+			if (recordSize == 0)
+			{
+
+				error = "Unknown record layout!";
+				return false;
+
+			}
+
+			const size_t recordsPerChunk = std::max(size_t(1), chunkSize / recordSize);
+			std::vector<char> chunk(recordsPerChunk * recordSize);
+
+			HelperRecords records;
+
+			while (stream)
+			{
+
+				stream.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+				const size_t numBytes = static_cast<size_t>(stream.gcount());
+
+				if (numBytes == 0)
+				{
+
+					break;
+
+				}
+
+				if (numBytes % recordSize != 0)
+				{
+
+					error = "File ends with a partial record, check the record layout!";
+					return false;
+
+				}
+
+				// Decode the chunk, the records keep their capacity between chunks
+				//
+				const size_t numRecords = numBytes / recordSize;
+
+				records.matrices.resize(numRecords);
+				records.shapeMasks.resize(format.shapes ? numRecords : 0);
+				records.colors.resize(format.colors ? numRecords : 0);
+
+				parallelFor(numRecords, threadCount(numRecords), [&](size_t begin, size_t end)
+				{
+
+					decodeRecords(
+						format,
+						chunk.data() + (begin * recordSize),
+						end - begin,
+						records.matrices.data() + begin,
+						format.shapes ? records.shapeMasks.data() + begin : nullptr,
+						format.colors ? records.colors.data() + begin : nullptr
+					);
+
+				});
+
+				consume(static_cast<const HelperRecords&>(records));
+
+			}
+
+			return true;
+
+		};
+
+
+		struct CsvColumns
+		/**
+		Column indices resolved from a CSV header, -1 marks a missing column.
+		The transform comes from either m00 to m33, or tx, ty, tz, rx, ry, rz, sx, sy and sz with rotations in degrees.
+		*/
+		{
+
+			int		matrix[16];
+			int		trs[9];
+			int		shapes = -1;
+			int		color[3] = { -1, -1, -1 };
+			bool	hasMatrix = false;
+			bool	hasColor = false;
+			int		numColumns = 0;
+
+		};
+
+
+		inline bool parseCsvHeader(const std::string& line, CsvColumns& columns, std::string& error)
+		/**
+		Resolves the column indices from a CSV header row.
+		Names are case sensitive and unknown columns are ignored.
+
+		@param line: The header row.
+		@param columns: The passed columns to populate.
+		@param error: The passed string to populate if the header is invalid.
+		@return: bool
+		*/
+		{
+
+			const char* trsNames[9] = { "tx", "ty", "tz", "rx", "ry", "rz", "sx", "sy", "sz" };
+			const char* colorNames[3] = { "r", "g", "b" };
+
+			std::fill(columns.matrix, columns.matrix + 16, -1);
+			std::fill(columns.trs, columns.trs + 9, -1);
+
+			int column = 0;
+			size_t start = 0;
+
+			while (start <= line.size())
+			{
+
+				size_t end = line.find(',', start);
+				end = (end == std::string::npos) ? line.size() : end;
+
+				std::string name = line.substr(start, end - start);
+				name.erase(0, name.find_first_not_of(" \t\r"));
+				name.erase(name.find_last_not_of(" \t\r") + 1);
+
+				if (name.size() == 3 && name[0] == 'm' && name[1] >= '0' && name[1] <= '3' && name[2] >= '0' && name[2] <= '3')
+				{
+
+					columns.matrix[((name[1] - '0') * 4) + (name[2] - '0')] = column;
+
+				}
+
+				for (int i = 0; i < 9; i++)
+				{
+
+					if (name == trsNames[i])
+					{
+
+						columns.trs[i] = column;
+
+					}
+
+				}
+
+				for (int i = 0; i < 3; i++)
+				{
+
+					if (name == colorNames[i])
+					{
+
+						columns.color[i] = column;
+
+					}
+
+				}
+
+				if (name == "shapes")
+				{
+
+					columns.shapes = column;
+
+				}
+
+				column++;
+				start = end + 1;
+
+			}
+
+			columns.numColumns = column;
+			columns.hasMatrix = std::count(columns.matrix, columns.matrix + 16, -1) == 0;
+			columns.hasColor = std::count(columns.color, columns.color + 3, -1) == 0;
+
+			if (!columns.hasMatrix && std::count(columns.trs, columns.trs + 3, -1) != 0)
+			{
+
+				error = "CSV header requires m00 to m33, or at least tx, ty and tz!";
+				return false;
+
+			}
+
+			return true;
+
+		};
+
+
+		inline size_t parseCsvRows(const char* begin, const char* end, const CsvColumns& columns, HelperRecords& records)
+		/**
+		Parses complete CSV rows into the supplied records.
+		Empty fields and missing TRS columns fall back to zero translation and rotation and unit scale.
+		The range must be followed by a character that stops number parsing, such as a newline or null.
+
+		@param begin: The first character of the first row.
+		@param end: One past the last row's newline.
+		@param columns: The resolved columns.
+		@param records: The passed records to append to.
+		@return: The number of rows that could not be parsed.
+		*/
+		{
+
+			std::vector<double> fields(columns.numColumns);
+			size_t numErrors = 0;
+
+			const char* cursor = begin;
+
+			while (cursor < end)
+			{
+
+				const char* lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+				lineEnd = (lineEnd == nullptr) ? end : lineEnd;
+
+				// Skip blank lines
+				//
+				if (lineEnd == cursor || (lineEnd == cursor + 1 && *cursor == '\r'))
+				{
+
+					cursor = lineEnd + 1;
+					continue;
+
+				}
+
+				// Parse every field, empty fields are NaN so defaults can be applied
+				//
+				std::fill(fields.begin(), fields.end(), std::nan(""));
+
+				const char* field = cursor;
+				bool isValid = true;
+
+				for (int i = 0; i < columns.numColumns; i++)
+				{
+
+					const char* comma = static_cast<const char*>(std::memchr(field, ',', lineEnd - field));
+					const char* limit = (comma == nullptr) ? lineEnd : comma;
+
+					// Numbers that run past the field are treated as empty, strtod() skips newlines as whitespace
+					//
+					char* number = nullptr;
+					const double value = std::strtod(field, &number);
+					const char* fieldEnd = (number > field && number <= limit) ? number : field;
+
+					if (fieldEnd != field)
+					{
+
+						fields[i] = value;
+
+					}
+
+					// Anything but whitespace after the number is an error
+					//
+					for (const char* character = fieldEnd; character < limit; character++)
+					{
+
+						isValid &= (*character == ' ' || *character == '\t' || *character == '\r');
+
+					}
+
+					if (comma == nullptr)
+					{
+
+						break;
+
+					}
+
+					field = comma + 1;
+
+				}
+
+				cursor = lineEnd + 1;
+
+				if (!isValid)
+				{
+
+					numErrors++;
+					continue;
+
+				}
+
+				// Build the transform
+				//
+				Core::Matrix matrix;
+
+				if (columns.hasMatrix)
+				{
+
+					for (int i = 0; i < 16; i++)
+					{
+
+						const double value = fields[columns.matrix[i]];
+						matrix.values[i / 4][i % 4] = std::isnan(value) ? Core::Matrix().values[i / 4][i % 4] : value;
+
+					}
+
+				}
+				else
+				{
+
+					const double defaults[9] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 };
+					double values[9];
+
+					for (int i = 0; i < 9; i++)
+					{
+
+						const double value = (columns.trs[i] >= 0) ? fields[columns.trs[i]] : std::nan("");
+						values[i] = std::isnan(value) ? defaults[i] : value;
+
+					}
+
+					for (int i = 3; i < 6; i++)
+					{
+
+						values[i] *= Core::PI / 180.0;
+
+					}
+
+					matrix = composeTRS(values);
+
+				}
+
+				records.matrices.push_back(matrix);
+
+				if (columns.shapes >= 0)
+				{
+
+					const double value = fields[columns.shapes];
+					records.shapeMasks.push_back(std::isnan(value) ? 0 : static_cast<int32_t>(value));
+
+				}
+
+				if (columns.hasColor)
+				{
+
+					const double r = fields[columns.color[0]], g = fields[columns.color[1]], b = fields[columns.color[2]];
+					records.colors.push_back(Core::VectorD(std::isnan(r) ? 1.0 : r, std::isnan(g) ? 1.0 : g, std::isnan(b) ? 1.0 : b));
+
+				}
+
+			}
+
+			return numErrors;
+
+		};
+
+
+		template<typename Consumer>
+		inline bool readCsvRecords(std::istream& stream, size_t chunkSize, const Consumer& consume, size_t& numErrors, std::string& error)
+		/**
+		Streams a CSV file with a header row in chunks and parses each chunk in parallel.
+		Each chunk is cut at its last newline and the remainder is carried into the next one, so only one chunk of text is held at a time.
+		Parsed rows are handed to the consumer in file order, in one or more batches per chunk.
+
+		@param stream: The text input stream.
+		@param chunkSize: The approximate number of bytes read per chunk.
+		@param consume: Callable taking a batch of parsed records.
+		@param numErrors: The passed counter to increment for every row that could not be parsed.
+		@param error: The passed string to populate if reading fails.
+		@return: bool
+		*/
+		{
+
+			// Read header
+			//
+			std::string header;
+
+			if (!std::getline(stream, header))
+			{
+
+				error = "CSV file is empty!";
+				return false;
+
+			}
+
+			CsvColumns columns;
+
+			if (!parseCsvHeader(header, columns, error))
+			{
+
+				return false;
+
+			}
+
+			// Stream rows
+			//
+			chunkSize = std::max(chunkSize, size_t(4096));
+
+			std::vector<char> chunk;
+			chunk.reserve(chunkSize + 1);
+
+			std::vector<HelperRecords> blocks;
+			std::vector<size_t> blockErrors;
+
+			while (true)
+			{
+
+				// Append the next chunk after the carried remainder
+				//
+				const size_t carried = chunk.size();
+				chunk.resize(carried + chunkSize);
+
+				stream.read(chunk.data() + carried, static_cast<std::streamsize>(chunkSize));
+				const size_t numBytes = static_cast<size_t>(stream.gcount());
+				const bool isLast = (numBytes < chunkSize);
+
+				chunk.resize(carried + numBytes);
+
+				// Cut at the last newline unless this is the end of the file
+				//
+				size_t cut = chunk.size();
+
+				if (!isLast)
+				{
+
+					while (cut > 0 && chunk[cut - 1] != '\n')
+					{
+
+						cut--;
+
+					}
+
+					if (cut == 0)
+					{
+
+						error = "CSV row is longer than the chunk size!";
+						return false;
+
+					}
+
+				}
+
+				// Split the complete rows into newline aligned blocks and parse them in parallel
+				//
+				const unsigned int numThreads = threadCount(cut / 64);
+				std::vector<size_t> bounds(numThreads + 1, cut);
+				bounds[0] = 0;
+
+				for (unsigned int i = 1; i < numThreads; i++)
+				{
+
+					size_t bound = std::max(bounds[i - 1], (cut * i) / numThreads);
+
+					while (bound < cut && chunk[bound - 1] != '\n')
+					{
+
+						bound++;
+
+					}
+
+					bounds[i] = bound;
+
+				}
+
+				chunk.push_back('\0');
+
+				blocks.resize(numThreads);
+				blockErrors.assign(numThreads, 0);
+
+				parallelFor(numThreads, numThreads, [&](size_t begin, size_t end)
+				{
+
+					for (size_t i = begin; i < end; i++)
+					{
+
+						blocks[i].clear();
+						blockErrors[i] = parseCsvRows(chunk.data() + bounds[i], chunk.data() + bounds[i + 1], columns, blocks[i]);
+
+					}
+
+				});
+
+				for (unsigned int i = 0; i < numThreads; i++)
+				{
+
+					consume(static_cast<const HelperRecords&>(blocks[i]));
+					numErrors += blockErrors[i];
+
+				}
+
+				if (isLast)
+				{
+
+					break;
+
+				}
+
+				// Carry the incomplete row into the next chunk
+				//
+				chunk.pop_back();
+				chunk.erase(chunk.begin(), chunk.begin() + cut);
+
+			}
+
+			return true;
+
+		};
+
+
+
+		template<typename T>
+		inline void storeLittleEndian(char* destination, const T value)
+		/**
+		Stores a value at the supplied address in little-endian byte order.
+
+		@param destination: The address to store to.
+		@param value: The value to store.
+		@return: void
+		*/
+		{
+
+			std::memcpy(destination, &value, sizeof(T));
+
+			const uint16_t probe = 1;
+
+			if (*reinterpret_cast<const unsigned char*>(&probe) != 1)
+			{
+
+				std::reverse(destination, destination + sizeof(T));
+
+			}
+
+		};
+
+
+		template<typename T>
+		inline void appendLittleEndian(std::vector<char>& buffer, const T value)
+		/**
+		Appends a value to the supplied buffer in little-endian byte order.
+
+		@param buffer: The buffer to append to.
+		@param value: The value to append.
+		@return: void
+		*/
+		{
+
+			const size_t size = buffer.size();
+
+			buffer.resize(size + sizeof(T));
+			storeLittleEndian<T>(buffer.data() + size, value);
+
+		};
+
+
+		template<typename T>
+		inline void appendPoints(std::vector<char>& buffer, const std::vector<T>& points, const size_t count)
+		/**
+		Appends the first count points to the supplied buffer as little-endian float triples.
+
+		@param buffer: The buffer to append to.
+		@param points: The points to append.
+		@param count: The number of points to append.
+		@return: void
+		*/
+		{
+
+			const size_t size = buffer.size();
+			buffer.resize(size + (count * 3 * sizeof(float)));
+
+			char* destination = buffer.data() + size;
+
+			for (size_t i = 0; i < count; i++)
+			{
+
+				storeLittleEndian<float>(destination, static_cast<float>(points[i].x));
+				storeLittleEndian<float>(destination + sizeof(float), static_cast<float>(points[i].y));
+				storeLittleEndian<float>(destination + (2 * sizeof(float)), static_cast<float>(points[i].z));
+
+				destination += 3 * sizeof(float);
+
+			}
+
+		};
+
+
+		struct ExportRecord
+		/**
+		One helper at one frame.
+		Geometry is in the helper's object space, so it is positioned by the world matrix.
+		*/
+		{
+
+			uint32_t					helper = 0;
+			double						frame = 0.0;
+			Core::Matrix				worldMatrix;
+			uint32_t					shapeFlags = 0;
+			double						size = 0.0;
+			float						color[3] = { 0.0f, 0.0f, 0.0f };
+			const Core::MeshBuffers*	geometry = nullptr;
+
+		};
+
+
+		class ExportWriter
+		/**
+		Streams helper records to a compact little-endian binary file.
+		Records are staged in a fixed-size chunk that is written out whenever it fills, so memory stays bounded by the chunk and the index.
+
+		The file starts with a 32 byte header:
+			char[4] magic "PHEX", uint32 version, uint32 helper count, uint64 record count, uint64 index offset, uint32 reserved.
+		Each record is:
+			uint32 helper, float64 frame, float64[16] row-major world matrix, uint32 shape flags, float64 size, float32[3] color,
+			uint32 triangle vertex count, uint32 line vertex count,
+			float32[3] per triangle vertex, float32[3] per triangle normal, float32[3] per line vertex.
+		The index at the index offset holds every helper name as a uint32 length and its bytes,
+		followed by one uint32 helper, float64 frame and uint64 file offset per record.
+		*/
+		{
+
+		public:
+
+			ExportWriter(std::ostream& stream, const size_t chunkSize = DEFAULT_CHUNK_SIZE) : stream(stream), chunkSize(chunkSize)
+			{
+
+				this->chunk.reserve(chunkSize);
+
+			};
+
+			uint32_t addHelper(const std::string& name)
+			/**
+			Adds a helper name to the index.
+
+			@param name: The helper's name.
+			@return: The helper's index, used by its records.
+			*/
+			{
+
+				this->names.push_back(name);
+				return static_cast<uint32_t>(this->names.size() - 1);
+
+			};
+
+			bool begin()
+			/**
+			Writes a placeholder header that is completed by finish().
+
+			@return: bool
+			*/
+			{
+
+				this->chunk.assign(EXPORT_HEADER_SIZE, '\0');
+				this->offset = 0;
+				this->index.clear();
+
+				return this->flush();
+
+			};
+
+			bool write(const ExportRecord& record)
+			/**
+			Stages a record, the chunk is written out once it is full.
+
+			@param record: The record to write.
+			@return: bool
+			*/
+			{
+
+				this->index.push_back(IndexEntry{ record.helper, record.frame, this->offset + this->chunk.size() });
+
+				appendLittleEndian<uint32_t>(this->chunk, record.helper);
+				appendLittleEndian<double>(this->chunk, record.frame);
+
+				for (int i = 0; i < 16; i++)
+				{
+
+					appendLittleEndian<double>(this->chunk, record.worldMatrix.values[i / 4][i % 4]);
+
+				}
+
+				appendLittleEndian<uint32_t>(this->chunk, record.shapeFlags);
+				appendLittleEndian<double>(this->chunk, record.size);
+
+				for (int i = 0; i < 3; i++)
+				{
+
+					appendLittleEndian<float>(this->chunk, record.color[i]);
+
+				}
+
+				const bool hasGeometry = (record.geometry != nullptr);
+				const size_t numTriangles = hasGeometry ? std::min(record.geometry->triangles.size(), record.geometry->normals.size()) : 0;
+				const size_t numLines = hasGeometry ? record.geometry->lines.size() : 0;
+
+				appendLittleEndian<uint32_t>(this->chunk, static_cast<uint32_t>(numTriangles));
+				appendLittleEndian<uint32_t>(this->chunk, static_cast<uint32_t>(numLines));
+
+				if (hasGeometry)
+				{
+
+					appendPoints(this->chunk, record.geometry->triangles, numTriangles);
+					appendPoints(this->chunk, record.geometry->normals, numTriangles);
+					appendPoints(this->chunk, record.geometry->lines, numLines);
+
+				}
+
+				return (this->chunk.size() < this->chunkSize) || this->flush();
+
+			};
+
+			bool finish()
+			/**
+			Writes the remaining records and the index, then completes the header.
+
+			@return: bool
+			*/
+			{
+
+				const uint64_t indexOffset = this->offset + this->chunk.size();
+
+				for (const std::string& name : this->names)
+				{
+
+					appendLittleEndian<uint32_t>(this->chunk, static_cast<uint32_t>(name.size()));
+					this->chunk.insert(this->chunk.end(), name.begin(), name.end());
+
+					if (this->chunk.size() >= this->chunkSize && !this->flush())
+					{
+
+						return false;
+
+					}
+
+				}
+
+				for (const IndexEntry& entry : this->index)
+				{
+
+					appendLittleEndian<uint32_t>(this->chunk, entry.helper);
+					appendLittleEndian<double>(this->chunk, entry.frame);
+					appendLittleEndian<uint64_t>(this->chunk, entry.offset);
+
+					if (this->chunk.size() >= this->chunkSize && !this->flush())
+					{
+
+						return false;
+
+					}
+
+				}
+
+				if (!this->flush())
+				{
+
+					return false;
+
+				}
+
+				// Complete the header
+				//
+				this->chunk.clear();
+				this->chunk.insert(this->chunk.end(), EXPORT_MAGIC, EXPORT_MAGIC + 4);
+
+				appendLittleEndian<uint32_t>(this->chunk, EXPORT_VERSION);
+				appendLittleEndian<uint32_t>(this->chunk, static_cast<uint32_t>(this->names.size()));
+				appendLittleEndian<uint64_t>(this->chunk, static_cast<uint64_t>(this->index.size()));
+				appendLittleEndian<uint64_t>(this->chunk, indexOffset);
+				appendLittleEndian<uint32_t>(this->chunk, 0);
+
+				this->stream.seekp(0);
+				this->stream.write(this->chunk.data(), static_cast<std::streamsize>(this->chunk.size()));
+				this->stream.seekp(0, std::ios::end);
+				this->chunk.clear();
+
+				return this->stream.good();
+
+			};
+
+			size_t recordCount() const { return this->index.size(); };
+
+		protected:
+
+			struct IndexEntry
+			{
+
+				uint32_t	helper;
+				double		frame;
+				uint64_t	offset;
+
+			};
+
+			bool flush()
+			{
+
+				this->stream.write(this->chunk.data(), static_cast<std::streamsize>(this->chunk.size()));
+				this->offset += this->chunk.size();
+				this->chunk.clear();
+
+				return this->stream.good();
+
+			};
+
+			std::ostream&				stream;
+			size_t						chunkSize;
+			std::vector<char>			chunk;
+			uint64_t					offset = 0;
+			std::vector<std::string>	names;
+			std::vector<IndexEntry>		index;
+
+		};
+
+	};
+
+};
+#endif
@@ -0,0 +1,2243 @@
+#ifndef _POINT_HELPER_DRAWABLE_LIBRARY
+#define _POINT_HELPER_DRAWABLE_LIBRARY
+//
+// File: DrawableLibrary.h
+//
+// Author: Ben Singleton
+//
+// Header-only reader and writer for .phshape libraries of prebaked helper shapes.
+// Like DrawableCore.h nothing in here depends on the Maya API so it can be benchmarked on any machine!
+// A library is memory-mapped once per process and every helper that references it reads the same pages.
+// OBJ files are parsed into the same shape views on a worker thread, and cached by path and modification time.
+//
+
+#include "DrawableCore.h"
+#include "DrawableIO.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace Drawable
+{
+
+	namespace Library
+	{
+
+		constexpr char		MAGIC[4] = { 'P', 'H', 'S', 'H' };
+		constexpr uint32_t	VERSION = 1;
+		constexpr size_t	HEADER_SIZE = 32;
+		constexpr size_t	ENTRY_SIZE = 80;
+
+
+		struct Shape
+		/**
+		A view of one shape inside a mapped library, nothing is copied.
+		Points and normals are float32 triples, normals are per point and may be missing.
+		Lines are index pairs and triangles are index triples into the points.
+		*/
+		{
+
+			const char*		name = nullptr;
+			uint32_t		nameLength = 0;
+
+			const float*	points = nullptr;
+			const float*	normals = nullptr;
+			uint32_t		numPoints = 0;
+
+			const uint32_t*	lineIndices = nullptr;
+			uint32_t		numLineIndices = 0;
+
+			const uint32_t*	triangleIndices = nullptr;
+			uint32_t		numTriangleIndices = 0;
+
+			float			min[3] = { 0.0f, 0.0f, 0.0f };
+			float			max[3] = { 0.0f, 0.0f, 0.0f };
+
+			int compare(const char* other, const size_t otherLength) const
+			{
+
+				const int result = std::memcmp(name, other, std::min(static_cast<size_t>(nameLength), otherLength));
+				return (result != 0) ? result : ((nameLength < otherLength) ? -1 : ((nameLength > otherLength) ? 1 : 0));
+
+			};
+
+		};
+
+
+		class MappedFile
+		/**
+		A read-only memory mapping of a whole file.
+		*/
+		{
+
+		public:
+
+			MappedFile() {};
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			~MappedFile()
+			{
+
+				this->close();
+
+			};
+
+			bool open(const std::string& path)
+			/**
+			Maps the supplied file into memory.
+
+			@param path: The file to map.
+			@return: bool
+			*/
+			{
+
+				this->close();
+
+#ifdef _WIN32
+				this->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+				if (this->file == INVALID_HANDLE_VALUE)
+				{
+
+					return false;
+
+				}
+
+				LARGE_INTEGER fileSize;
+
+				if (!GetFileSizeEx(this->file, &fileSize) || fileSize.QuadPart == 0)
+				{
+
+					this->close();
+					return false;
+
+				}
+
+				this->mapping = CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				if (this->mapping == nullptr)
+				{
+
+					this->close();
+					return false;
+
+				}
+
+				this->bytes = static_cast<const char*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+				this->numBytes = static_cast<size_t>(fileSize.QuadPart);
+#else
+				const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+				if (descriptor < 0)
+				{
+
+					return false;
+
+				}
+
+				struct stat info;
+
+				if (fstat(descriptor, &info) != 0 || info.st_size == 0)
+				{
+
+					::close(descriptor);
+					return false;
+
+				}
+
+				void* address = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+				::close(descriptor);
+
+				if (address == MAP_FAILED)
+				{
+
+					return false;
+
+				}
+
+				this->bytes = static_cast<const char*>(address);
+				this->numBytes = static_cast<size_t>(info.st_size);
+#endif
+
+				if (this->bytes == nullptr)
+				{
+
+					this->close();
+					return false;
+
+				}
+
+				return true;
+
+			};
+
+			void close()
+			/**
+			Unmaps the file.
+
+			@return: void
+			*/
+			{
+
+#ifdef _WIN32
+				if (this->bytes != nullptr)
+				{
+
+					UnmapViewOfFile(this->bytes);
+
+				}
+
+				if (this->mapping != nullptr)
+				{
+
+					CloseHandle(this->mapping);
+					this->mapping = nullptr;
+
+				}
+
+				if (this->file != INVALID_HANDLE_VALUE)
+				{
+
+					CloseHandle(this->file);
+					this->file = INVALID_HANDLE_VALUE;
+
+				}
+#else
+				if (this->bytes != nullptr)
+				{
+
+					munmap(const_cast<char*>(this->bytes), this->numBytes);
+
+				}
+#endif
+
+				this->bytes = nullptr;
+				this->numBytes = 0;
+
+			};
+
+			const char* data() const { return this->bytes; };
+			size_t size() const { return this->numBytes; };
+
+		protected:
+
+			const char*	bytes = nullptr;
+			size_t		numBytes = 0;
+
+#ifdef _WIN32
+			HANDLE		file = INVALID_HANDLE_VALUE;
+			HANDLE		mapping = nullptr;
+#endif
+
+		};
+
+
+		class ShapeLibrary
+		/**
+		A mapped .phshape library.
+
+		The file starts with a 32 byte header:
+			char[4] magic "PHSH", uint32 version, uint32 shape count, uint32 reserved, uint64 table offset, uint64 reserved.
+		The table holds one 80 byte entry per shape, sorted by name:
+			uint64 name offset, uint32 name length, uint32 point count, uint64 points offset, uint64 normals offset (0 if none),
+			uint64 line indices offset, uint32 line index count, uint32 triangle index count, uint64 triangle indices offset,
+			float32[3] bounds minimum, float32[3] bounds maximum.
+		Every value is little-endian and every array offset is 4 byte aligned so it can be read in place.
+		*/
+		{
+
+		public:
+
+			ShapeLibrary() {};
+			ShapeLibrary(const ShapeLibrary&) = delete;
+			ShapeLibrary& operator=(const ShapeLibrary&) = delete;
+
+			bool open(const std::string& path, std::string& error)
+			/**
+			Maps and validates the supplied library.
+			Every offset and index is checked here so shapes can be drawn without further checks.
+
+			@param path: The library to open.
+			@param error: The passed string to populate on failure.
+			@return: bool
+			*/
+			{
+
+				this->shapes.clear();
+
+				const uint16_t probe = 1;
+
+				if (*reinterpret_cast<const unsigned char*>(&probe) != 1)
+				{
+
+					error = "shape libraries can only be mapped on little-endian hosts";
+					return false;
+
+				}
+
+				if (!this->file.open(path))
+				{
+
+					error = "unable to map " + path;
+					return false;
+
+				}
+
+				const char* bytes = this->file.data();
+				const size_t numBytes = this->file.size();
+
+				if (numBytes < HEADER_SIZE || std::memcmp(bytes, MAGIC, 4) != 0)
+				{
+
+					error = path + " is not a shape library";
+					return false;
+
+				}
+
+				const uint32_t version = this->read<uint32_t>(4);
+				const uint32_t numShapes = this->read<uint32_t>(8);
+				const uint64_t tableOffset = this->read<uint64_t>(16);
+
+				if (version != VERSION)
+				{
+
+					error = path + " has unsupported version " + std::to_string(version);
+					return false;
+
+				}
+
+				if (tableOffset > numBytes || (numBytes - tableOffset) / ENTRY_SIZE < numShapes)
+				{
+
+					error = path + " has a truncated shape table";
+					return false;
+
+				}
+
+				this->shapes.resize(numShapes);
+
+				for (uint32_t i = 0; i < numShapes; i++)
+				{
+
+					const size_t entry = static_cast<size_t>(tableOffset) + (i * ENTRY_SIZE);
+					Shape& shape = this->shapes[i];
+
+					const uint64_t nameOffset = this->read<uint64_t>(entry);
+					const uint64_t pointsOffset = this->read<uint64_t>(entry + 16);
+					const uint64_t normalsOffset = this->read<uint64_t>(entry + 24);
+					const uint64_t lineIndicesOffset = this->read<uint64_t>(entry + 32);
+					const uint64_t triangleIndicesOffset = this->read<uint64_t>(entry + 48);
+
+					shape.nameLength = this->read<uint32_t>(entry + 8);
+					shape.numPoints = this->read<uint32_t>(entry + 12);
+					shape.numLineIndices = this->read<uint32_t>(entry + 40);
+					shape.numTriangleIndices = this->read<uint32_t>(entry + 44);
+
+					std::memcpy(shape.min, bytes + entry + 56, 3 * sizeof(float));
+					std::memcpy(shape.max, bytes + entry + 68, 3 * sizeof(float));
+
+					const bool isValid = this->contains(nameOffset, shape.nameLength, 1)
+						&& this->contains(pointsOffset, shape.numPoints, 3 * sizeof(float))
+						&& (normalsOffset == 0 || this->contains(normalsOffset, shape.numPoints, 3 * sizeof(float)))
+						&& this->contains(lineIndicesOffset, shape.numLineIndices, sizeof(uint32_t))
+						&& this->contains(triangleIndicesOffset, shape.numTriangleIndices, sizeof(uint32_t))
+						&& (shape.numLineIndices % 2) == 0
+						&& (shape.numTriangleIndices % 3) == 0;
+
+					if (!isValid)
+					{
+
+						error = path + " has an invalid entry for shape " + std::to_string(i);
+						this->shapes.clear();
+
+						return false;
+
+					}
+
+					shape.name = bytes + nameOffset;
+					shape.points = reinterpret_cast<const float*>(bytes + pointsOffset);
+					shape.normals = (normalsOffset != 0) ? reinterpret_cast<const float*>(bytes + normalsOffset) : nullptr;
+					shape.lineIndices = reinterpret_cast<const uint32_t*>(bytes + lineIndicesOffset);
+					shape.triangleIndices = reinterpret_cast<const uint32_t*>(bytes + triangleIndicesOffset);
+
+					const bool inRange = ShapeLibrary::inRange(shape.lineIndices, shape.numLineIndices, shape.numPoints)
+						&& ShapeLibrary::inRange(shape.triangleIndices, shape.numTriangleIndices, shape.numPoints);
+
+					const bool isSorted = (i == 0) || (this->shapes[i - 1].compare(shape.name, shape.nameLength) < 0);
+
+					if (!inRange || !isSorted)
+					{
+
+						error = path + (inRange ? " is not sorted by name" : " has an index out of range for shape " + std::to_string(i));
+						this->shapes.clear();
+
+						return false;
+
+					}
+
+				}
+
+				this->path = path;
+
+				return true;
+
+			};
+
+			const Shape* find(const std::string& name) const
+			/**
+			Returns the named shape, or a null pointer if the library does not hold it.
+
+			@param name: The shape's name.
+			@return: const Shape*
+			*/
+			{
+
+				auto found = std::lower_bound(
+					this->shapes.begin(),
+					this->shapes.end(),
+					name,
+					[](const Shape& shape, const std::string& value)
+					{
+
+						return shape.compare(value.data(), value.size()) < 0;
+
+					}
+				);
+
+				if (found == this->shapes.end() || found->compare(name.data(), name.size()) != 0)
+				{
+
+					return nullptr;
+
+				}
+
+				return &(*found);
+
+			};
+
+			static bool inRange(const uint32_t* indices, const size_t numIndices, const size_t numPoints)
+			/**
+			Evaluates if every index refers to one of the points.
+
+			@param indices: The indices to check.
+			@param numIndices: The number of indices.
+			@param numPoints: The number of points.
+			@return: bool
+			*/
+			{
+
+				for (size_t i = 0; i < numIndices; i++)
+				{
+
+					if (indices[i] >= numPoints)
+					{
+
+						return false;
+
+					}
+
+				}
+
+				return true;
+
+			};
+
+			size_t numShapes() const { return this->shapes.size(); };
+			const Shape& shape(const size_t index) const { return this->shapes[index]; };
+			size_t mappedBytes() const { return this->file.size(); };
+			const std::string& filePath() const { return this->path; };
+
+		protected:
+
+			template<typename T>
+			T read(const size_t offset) const
+			{
+
+				T value;
+				std::memcpy(&value, this->file.data() + offset, sizeof(T));
+
+				return value;
+
+			};
+
+			bool contains(const uint64_t offset, const uint64_t count, const uint64_t stride) const
+			{
+
+				const uint64_t numBytes = static_cast<uint64_t>(this->file.size());
+				const bool isAligned = (stride == 1) || (offset % sizeof(uint32_t)) == 0;
+
+				return isAligned && (count == 0 || (offset <= numBytes && count <= (numBytes - offset) / stride));
+
+			};
+
+			MappedFile			file;
+			std::vector<Shape>	shapes;
+			std::string			path;
+
+		};
+
+
+		inline std::shared_ptr<const ShapeLibrary> acquire(const std::string& path, std::string& error)
+		/**
+		Returns the library mapped from the supplied file, mapping it if no one else holds it.
+		Libraries are shared by path and unmapped once the last holder releases them.
+
+		@param path: The library to open.
+		@param error: The passed string to populate on failure.
+		@return: std::shared_ptr<const ShapeLibrary>
+		*/
+		{
+
+			static std::mutex mutex;
+			static std::unordered_map<std::string, std::weak_ptr<const ShapeLibrary>> libraries;
+
+			std::lock_guard<std::mutex> lock(mutex);
+
+			std::shared_ptr<const ShapeLibrary> library = libraries[path].lock();
+
+			if (library != nullptr)
+			{
+
+				return library;
+
+			}
+
+			std::shared_ptr<ShapeLibrary> opened = std::make_shared<ShapeLibrary>();
+
+			if (!opened->open(path, error))
+			{
+
+				libraries.erase(path);
+				return nullptr;
+
+			}
+
+			libraries[path] = opened;
+
+			return opened;
+
+		};
+
+
+		struct ShapeSource
+		/**
+		One shape to be written to a library.
+		Normals are optional, if supplied there must be one per point.
+		*/
+		{
+
+			std::string					name;
+			std::vector<Core::PointD>	points;
+			std::vector<Core::VectorD>	normals;
+			std::vector<uint32_t>		lineIndices;
+			std::vector<uint32_t>		triangleIndices;
+
+		};
+
+
+		inline bool writeLibrary(std::ostream& stream, std::vector<ShapeSource> sources, std::string& error)
+		/**
+		Writes the supplied shapes to a library, see ShapeLibrary for the layout.
+		Shapes are sorted by name and their bounds are computed from their points.
+
+		@param stream: The binary stream to write to.
+		@param sources: The shapes to write.
+		@param error: The passed string to populate on failure.
+		@return: bool
+		*/
+		{
+
+			std::sort(
+				sources.begin(),
+				sources.end(),
+				[](const ShapeSource& a, const ShapeSource& b)
+				{
+
+					return a.name < b.name;
+
+				}
+			);
+
+			for (size_t i = 0; i < sources.size(); i++)
+			{
+
+				const ShapeSource& source = sources[i];
+
+				if (i > 0 && sources[i - 1].name == source.name)
+				{
+
+					error = "duplicate shape name " + source.name;
+					return false;
+
+				}
+
+				if (!source.normals.empty() && source.normals.size() != source.points.size())
+				{
+
+					error = "shape " + source.name + " must have one normal per point";
+					return false;
+
+				}
+
+				const size_t numPoints = source.points.size();
+
+				const bool inRange = ShapeLibrary::inRange(source.lineIndices.data(), source.lineIndices.size(), numPoints)
+					&& ShapeLibrary::inRange(source.triangleIndices.data(), source.triangleIndices.size(), numPoints);
+
+				if (!inRange || (source.lineIndices.size() % 2) != 0 || (source.triangleIndices.size() % 3) != 0)
+				{
+
+					error = "shape " + source.name + " has invalid indices";
+					return false;
+
+				}
+
+			}
+
+			// Arrays follow the header, the table goes last once every offset is known
+			//
+			std::vector<char> buffer(HEADER_SIZE, '\0');
+			std::vector<char> table;
+
+			auto align = [&buffer]()
+			{
+
+				buffer.resize((buffer.size() + 3) & ~size_t(3), '\0');
+				return static_cast<uint64_t>(buffer.size());
+
+			};
+
+			for (const ShapeSource& source : sources)
+			{
+
+				const uint64_t nameOffset = align();
+				buffer.insert(buffer.end(), source.name.begin(), source.name.end());
+
+				const uint64_t pointsOffset = align();
+				IO::appendPoints(buffer, source.points, source.points.size());
+
+				const uint64_t normalsOffset = source.normals.empty() ? 0 : align();
+				IO::appendPoints(buffer, source.normals, source.normals.size());
+
+				const uint64_t lineIndicesOffset = align();
+
+				for (const uint32_t index : source.lineIndices)
+				{
+
+					IO::appendLittleEndian<uint32_t>(buffer, index);
+
+				}
+
+				const uint64_t triangleIndicesOffset = align();
+
+				for (const uint32_t index : source.triangleIndices)
+				{
+
+					IO::appendLittleEndian<uint32_t>(buffer, index);
+
+				}
+
+				float min[3] = { 0.0f, 0.0f, 0.0f };
+				float max[3] = { 0.0f, 0.0f, 0.0f };
+
+				for (size_t i = 0; i < source.points.size(); i++)
+				{
+
+					const float point[3] = { static_cast<float>(source.points[i].x), static_cast<float>(source.points[i].y), static_cast<float>(source.points[i].z) };
+
+					for (int j = 0; j < 3; j++)
+					{
+
+						min[j] = (i == 0) ? point[j] : std::min(min[j], point[j]);
+						max[j] = (i == 0) ? point[j] : std::max(max[j], point[j]);
+
+					}
+
+				}
+
+				IO::appendLittleEndian<uint64_t>(table, nameOffset);
+				IO::appendLittleEndian<uint32_t>(table, static_cast<uint32_t>(source.name.size()));
+				IO::appendLittleEndian<uint32_t>(table, static_cast<uint32_t>(source.points.size()));
+				IO::appendLittleEndian<uint64_t>(table, pointsOffset);
+				IO::appendLittleEndian<uint64_t>(table, normalsOffset);
+				IO::appendLittleEndian<uint64_t>(table, lineIndicesOffset);
+				IO::appendLittleEndian<uint32_t>(table, static_cast<uint32_t>(source.lineIndices.size()));
+				IO::appendLittleEndian<uint32_t>(table, static_cast<uint32_t>(source.triangleIndices.size()));
+				IO::appendLittleEndian<uint64_t>(table, triangleIndicesOffset);
+
+				for (int j = 0; j < 3; j++)
+				{
+
+					IO::appendLittleEndian<float>(table, min[j]);
+
+				}
+
+				for (int j = 0; j < 3; j++)
+				{
+
+					IO::appendLittleEndian<float>(table, max[j]);
+
+				}
+
+			}
+
+			const uint64_t tableOffset = align();
+			buffer.insert(buffer.end(), table.begin(), table.end());
+
+			// Complete the header
+			//
+			std::memcpy(buffer.data(), MAGIC, 4);
+			IO::storeLittleEndian<uint32_t>(buffer.data() + 4, VERSION);
+			IO::storeLittleEndian<uint32_t>(buffer.data() + 8, static_cast<uint32_t>(sources.size()));
+			IO::storeLittleEndian<uint64_t>(buffer.data() + 16, tableOffset);
+
+			stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+			if (!stream.good())
+			{
+
+				error = "unable to write shape library";
+				return false;
+
+			}
+
+			return true;
+
+		};
+
+
+
+		constexpr std::chrono::milliseconds	ASSET_CHECK_INTERVAL(1000);
+		constexpr double					SVG_TOLERANCE = 1e-3;
+		constexpr int						SVG_MAX_DEPTH = 8;
+
+
+		enum class AssetState
+		{
+
+			None = 0,
+			Pending,
+			Ready,
+			Failed
+
+		};
+
+
+		struct ShapeAsset
+		/**
+		A shape parsed from a file into buffers it owns.
+		The shape view points into these buffers so it can be drawn exactly like a library shape.
+		*/
+		{
+
+			std::vector<float>		points;
+			std::vector<float>		normals;
+			std::vector<uint32_t>	lineIndices;
+			std::vector<uint32_t>	triangleIndices;
+			std::string				name;
+			Shape					shape;
+
+			void bind()
+			/**
+			Points the shape view at this asset's buffers and computes its bounds.
+
+			@return: void
+			*/
+			{
+
+				shape.name = name.data();
+				shape.nameLength = static_cast<uint32_t>(name.size());
+				shape.points = points.data();
+				shape.normals = normals.empty() ? nullptr : normals.data();
+				shape.numPoints = static_cast<uint32_t>(points.size() / 3);
+				shape.lineIndices = lineIndices.data();
+				shape.numLineIndices = static_cast<uint32_t>(lineIndices.size());
+				shape.triangleIndices = triangleIndices.data();
+				shape.numTriangleIndices = static_cast<uint32_t>(triangleIndices.size());
+
+				for (uint32_t i = 0; i < shape.numPoints; i++)
+				{
+
+					for (int j = 0; j < 3; j++)
+					{
+
+						shape.min[j] = (i == 0) ? points[(3 * i) + j] : std::min(shape.min[j], points[(3 * i) + j]);
+						shape.max[j] = (i == 0) ? points[(3 * i) + j] : std::max(shape.max[j], points[(3 * i) + j]);
+
+					}
+
+				}
+
+			};
+
+		};
+
+
+		inline bool parseObjIndex(const char* token, const size_t numPoints, uint32_t& index)
+		/**
+		Parses the vertex index from an OBJ face or line token such as "3", "3/1" or "-1//2".
+		Negative indices are relative to the points read so far.
+
+		@param token: The token to parse.
+		@param numPoints: The number of points read so far.
+		@param index: The passed zero-based index to populate.
+		@return: bool
+		*/
+		{
+
+			char* end = nullptr;
+			const long value = std::strtol(token, &end, 10);
+
+			if (end == token || value == 0)
+			{
+
+				return false;
+
+			}
+
+			const long resolved = (value > 0) ? (value - 1) : (static_cast<long>(numPoints) + value);
+
+			if (resolved < 0 || resolved >= static_cast<long>(numPoints))
+			{
+
+				return false;
+
+			}
+
+			index = static_cast<uint32_t>(resolved);
+
+			return true;
+
+		};
+
+
+		inline bool parseObj(std::istream& stream, ShapeAsset& asset, std::string& error)
+		/**
+		Parses the points, faces and lines of an OBJ file into indexed buffers.
+		Faces are fan triangulated and their edges are drawn as lines along with any line elements, shared edges are only kept once.
+		Normals are averaged per point from the triangles they belong to, OBJ normals and texture coordinates are ignored.
+
+		@param stream: The stream to read.
+		@param asset: The passed asset to populate.
+		@param error: The passed string to populate on failure.
+		@return: bool
+		*/
+		{
+
+			asset.points.clear();
+			asset.normals.clear();
+			asset.lineIndices.clear();
+			asset.triangleIndices.clear();
+
+			std::unordered_set<uint64_t> edges;
+			std::vector<uint32_t> element;
+			std::string line;
+			size_t lineNumber = 0;
+
+			auto addEdge = [&asset, &edges](const uint32_t a, const uint32_t b)
+			{
+
+				const uint64_t key = (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+
+				if (a != b && edges.insert(key).second)
+				{
+
+					asset.lineIndices.push_back(a);
+					asset.lineIndices.push_back(b);
+
+				}
+
+			};
+
+			while (std::getline(stream, line))
+			{
+
+				lineNumber++;
+
+				const char* cursor = line.c_str();
+
+				while (*cursor == ' ' || *cursor == '\t')
+				{
+
+					cursor++;
+
+				}
+
+				const bool isPoint = (cursor[0] == 'v' && (cursor[1] == ' ' || cursor[1] == '\t'));
+				const bool isFace = (cursor[0] == 'f' && (cursor[1] == ' ' || cursor[1] == '\t'));
+				const bool isLine = (cursor[0] == 'l' && (cursor[1] == ' ' || cursor[1] == '\t'));
+
+				if (isPoint)
+				{
+
+					char* end = nullptr;
+					cursor += 2;
+
+					for (int i = 0; i < 3; i++)
+					{
+
+						const float value = std::strtof(cursor, &end);
+
+						if (end == cursor)
+						{
+
+							error = "invalid point on line " + std::to_string(lineNumber);
+							return false;
+
+						}
+
+						asset.points.push_back(value);
+						cursor = end;
+
+					}
+
+					continue;
+
+				}
+
+				if (!isFace && !isLine)
+				{
+
+					continue;
+
+				}
+
+				// Collect element indices
+				//
+				const size_t numPoints = asset.points.size() / 3;
+				element.clear();
+				cursor += 2;
+
+				while (*cursor != '\0')
+				{
+
+					while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')
+					{
+
+						cursor++;
+
+					}
+
+					if (*cursor == '\0')
+					{
+
+						break;
+
+					}
+
+					uint32_t index = 0;
+
+					if (!parseObjIndex(cursor, numPoints, index))
+					{
+
+						error = "invalid index on line " + std::to_string(lineNumber);
+						return false;
+
+					}
+
+					element.push_back(index);
+
+					while (*cursor != '\0' && *cursor != ' ' && *cursor != '\t' && *cursor != '\r')
+					{
+
+						cursor++;
+
+					}
+
+				}
+
+				if (element.size() < (isFace ? 3u : 2u))
+				{
+
+					error = "too few indices on line " + std::to_string(lineNumber);
+					return false;
+
+				}
+
+				for (size_t i = 0; i + 1 < element.size(); i++)
+				{
+
+					addEdge(element[i], element[i + 1]);
+
+				}
+
+				if (isFace)
+				{
+
+					addEdge(element.back(), element.front());
+
+					for (size_t i = 1; i + 1 < element.size(); i++)
+					{
+
+						asset.triangleIndices.push_back(element[0]);
+						asset.triangleIndices.push_back(element[i]);
+						asset.triangleIndices.push_back(element[i + 1]);
+
+					}
+
+				}
+
+			}
+
+			// Average triangle normals per point, weighted by area
+			//
+			if (!asset.triangleIndices.empty())
+			{
+
+				std::vector<double> sums(asset.points.size(), 0.0);
+
+				for (size_t i = 0; i < asset.triangleIndices.size(); i += 3)
+				{
+
+					const float* a = &asset.points[3 * asset.triangleIndices[i]];
+					const float* b = &asset.points[3 * asset.triangleIndices[i + 1]];
+					const float* c = &asset.points[3 * asset.triangleIndices[i + 2]];
+
+					const Core::VectorD ab(b[0] - a[0], b[1] - a[1], b[2] - a[2]);
+					const Core::VectorD ac(c[0] - a[0], c[1] - a[1], c[2] - a[2]);
+					const Core::VectorD normal = ab.cross(ac);
+
+					for (size_t j = 0; j < 3; j++)
+					{
+
+						const size_t point = 3 * asset.triangleIndices[i + j];
+
+						sums[point] += normal.x;
+						sums[point + 1] += normal.y;
+						sums[point + 2] += normal.z;
+
+					}
+
+				}
+
+				asset.normals.resize(asset.points.size());
+
+				for (size_t i = 0; i < sums.size(); i += 3)
+				{
+
+					const Core::VectorD normal = Core::VectorD(sums[i], sums[i + 1], sums[i + 2]).normal();
+
+					asset.normals[i] = static_cast<float>(normal.x);
+					asset.normals[i + 1] = static_cast<float>(normal.y);
+					asset.normals[i + 2] = static_cast<float>(normal.z);
+
+				}
+
+			}
+
+			asset.bind();
+
+			return true;
+
+		};
+
+
+		enum class SvgSegmentType
+		{
+
+			Line = 0,
+			Quadratic,
+			Cubic,
+			Arc
+
+		};
+
+
+		struct SvgSegment
+		/**
+		A single segment of an SVG path in absolute coordinates.
+		Lines and curves store their control points from start to end, arcs store their center parameterization.
+		*/
+		{
+
+			SvgSegmentType	type = SvgSegmentType::Line;
+			double			points[4][2] = {};
+			double			center[2] = {};
+			double			radii[2] = {};
+			double			rotation = 0.0;
+			double			startAngle = 0.0;
+			double			sweepAngle = 0.0;
+
+			Core::PointD evaluate(const double t) const
+			/**
+			Returns the point at the supplied parameter, from 0 at the start of the segment to 1 at its end.
+
+			@param t: The parameter to evaluate.
+			@return: Core::PointD
+			*/
+			{
+
+				const double s = 1.0 - t;
+
+				switch (type)
+				{
+
+					case SvgSegmentType::Quadratic:
+					{
+
+						const double a = s * s, b = 2.0 * s * t, c = t * t;
+						return Core::PointD((a * points[0][0]) + (b * points[1][0]) + (c * points[2][0]), (a * points[0][1]) + (b * points[1][1]) + (c * points[2][1]), 0.0);
+
+					}
+
+					case SvgSegmentType::Cubic:
+					{
+
+						const double a = s * s * s, b = 3.0 * s * s * t, c = 3.0 * s * t * t, d = t * t * t;
+						return Core::PointD((a * points[0][0]) + (b * points[1][0]) + (c * points[2][0]) + (d * points[3][0]), (a * points[0][1]) + (b * points[1][1]) + (c * points[2][1]) + (d * points[3][1]), 0.0);
+
+					}
+
+					case SvgSegmentType::Arc:
+					{
+
+						const double angle = startAngle + (t * sweepAngle);
+						const double x = radii[0] * std::cos(angle);
+						const double y = radii[1] * std::sin(angle);
+
+						return Core::PointD(center[0] + (x * std::cos(rotation)) - (y * std::sin(rotation)), center[1] + (x * std::sin(rotation)) + (y * std::cos(rotation)), 0.0);
+
+					}
+
+					default:
+					{
+
+						return Core::PointD((s * points[0][0]) + (t * points[1][0]), (s * points[0][1]) + (t * points[1][1]), 0.0);
+
+					}
+
+				}
+
+			};
+
+			void expand(double min[2], double max[2]) const
+			/**
+			Expands the supplied bounds to contain this segment.
+			Curves are contained by their control points, and arcs by their ellipse.
+
+			@param min: The passed minimum to expand.
+			@param max: The passed maximum to expand.
+			@return: void
+			*/
+			{
+
+				const int numPoints = (type == SvgSegmentType::Cubic) ? 4 : (type == SvgSegmentType::Quadratic) ? 3 : 2;
+
+				for (int i = 0; i < numPoints; i++)
+				{
+
+					for (int j = 0; j < 2; j++)
+					{
+
+						min[j] = std::min(min[j], points[i][j]);
+						max[j] = std::max(max[j], points[i][j]);
+
+					}
+
+				}
+
+				if (type == SvgSegmentType::Arc)
+				{
+
+					const double radius = std::max(radii[0], radii[1]);
+
+					for (int j = 0; j < 2; j++)
+					{
+
+						min[j] = std::min(min[j], center[j] - radius);
+						max[j] = std::max(max[j], center[j] + radius);
+
+					}
+
+				}
+
+			};
+
+		};
+
+
+		struct SvgSubpath
+		/**
+		A run of connected segments started by a move command.
+		*/
+		{
+
+			double					start[2] = {};
+			std::vector<SvgSegment>	segments;
+			bool					closed = false;
+			bool					fill = true;
+
+		};
+
+
+		inline bool parseSvgPath(const char* data, std::vector<SvgSubpath>& subpaths, std::string& error)
+		/**
+		Parses SVG path data into subpaths of absolute segments, appending them to the supplied array.
+		Supports the move, line, horizontal, vertical, cubic, smooth cubic, quadratic, smooth quadratic, arc and close commands in both their absolute and relative forms.
+
+		@param data: The path data to parse, from a path element's "d" attribute.
+		@param subpaths: The passed array to append to.
+		@param error: The passed string to populate on failure.
+		@return: bool
+		*/
+		{
+
+			const char* cursor = data;
+			char command = '\0';
+			char previous = '\0';
+
+			double current[2] = { 0.0, 0.0 };
+			double start[2] = { 0.0, 0.0 };
+			double control[2] = { 0.0, 0.0 };
+			bool isOpen = false;
+
+			auto skip = [&cursor]()
+			{
+
+				while (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r' || *cursor == ',')
+				{
+
+					cursor++;
+
+				}
+
+			};
+
+			auto readNumber = [&cursor, &skip](double& value)
+			{
+
+				skip();
+
+				char* end = nullptr;
+				value = std::strtod(cursor, &end);
+
+				if (end == cursor)
+				{
+
+					return false;
+
+				}
+
+				cursor = end;
+				return true;
+
+			};
+
+			auto readFlag = [&cursor, &skip](bool& value)
+			{
+
+				skip();
+
+				if (*cursor != '0' && *cursor != '1')
+				{
+
+					return false;
+
+				}
+
+				value = (*cursor == '1');
+				cursor++;
+
+				return true;
+
+			};
+
+			auto addSegment = [&subpaths, &current, &isOpen](SvgSegment& segment, const double end[2])
+			{
+
+				// Drawing after a close starts a new subpath from the same point
+				//
+				if (!isOpen)
+				{
+
+					SvgSubpath subpath;
+					subpath.start[0] = current[0];
+					subpath.start[1] = current[1];
+
+					subpaths.push_back(subpath);
+					isOpen = true;
+
+				}
+
+				segment.points[0][0] = current[0];
+				segment.points[0][1] = current[1];
+
+				subpaths.back().segments.push_back(segment);
+
+				current[0] = end[0];
+				current[1] = end[1];
+
+			};
+
+			while (true)
+			{
+
+				skip();
+
+				if (*cursor == '\0')
+				{
+
+					break;
+
+				}
+
+				if (std::isalpha(static_cast<unsigned char>(*cursor)))
+				{
+
+					command = *cursor;
+					cursor++;
+
+				}
+				else if (command == '\0')
+				{
+
+					error = "expected a path command at \"" + std::string(cursor).substr(0, 16) + "\"";
+					return false;
+
+				}
+
+				const char type = static_cast<char>(std::toupper(static_cast<unsigned char>(command)));
+				const bool isRelative = (command != type);
+				const double origin[2] = { isRelative ? current[0] : 0.0, isRelative ? current[1] : 0.0 };
+
+				double values[7] = {};
+				const int numValues = (type == 'M' || type == 'L' || type == 'T') ? 2 : (type == 'H' || type == 'V') ? 1 : (type == 'C') ? 6 : (type == 'S' || type == 'Q') ? 4 : (type == 'A') ? 7 : 0;
+
+				if (type != 'Z' && numValues == 0)
+				{
+
+					error = std::string("unsupported path command '") + command + "'";
+					return false;
+
+				}
+
+				for (int i = 0; i < numValues; i++)
+				{
+
+					bool flag = false;
+					const bool isFlag = (type == 'A' && (i == 3 || i == 4));
+					const bool isValid = isFlag ? readFlag(flag) : readNumber(values[i]);
+
+					if (!isValid)
+					{
+
+						error = std::string("expected a number after '") + command + "'";
+						return false;
+
+					}
+
+					if (isFlag)
+					{
+
+						values[i] = flag ? 1.0 : 0.0;
+
+					}
+
+				}
+
+				SvgSegment segment;
+				const bool hasEnd = (numValues >= 2);
+				double end[2] = { hasEnd ? origin[0] + values[numValues - 2] : current[0], hasEnd ? origin[1] + values[numValues - 1] : current[1] };
+
+				switch (type)
+				{
+
+					case 'M':
+					{
+
+						SvgSubpath subpath;
+						subpath.start[0] = start[0] = current[0] = end[0];
+						subpath.start[1] = start[1] = current[1] = end[1];
+
+						subpaths.push_back(subpath);
+						isOpen = true;
+
+						// Further coordinate pairs are implicit lines
+						//
+						command = isRelative ? 'l' : 'L';
+						break;
+
+					}
+
+					case 'Z':
+					{
+
+						if (isOpen)
+						{
+
+							subpaths.back().closed = true;
+							isOpen = false;
+
+						}
+
+						current[0] = start[0];
+						current[1] = start[1];
+						command = '\0';
+						break;
+
+					}
+
+					case 'L':
+					case 'H':
+					case 'V':
+					{
+
+						end[0] = (type == 'V') ? current[0] : (type == 'H') ? origin[0] + values[0] : end[0];
+						end[1] = (type == 'H') ? current[1] : (type == 'V') ? origin[1] + values[0] : end[1];
+
+						segment.type = SvgSegmentType::Line;
+						segment.points[1][0] = end[0];
+						segment.points[1][1] = end[1];
+
+						addSegment(segment, end);
+						break;
+
+					}
+
+					case 'C':
+					case 'S':
+					{
+
+						// Smooth curves reflect the previous curve's last control point
+						//
+						const bool isSmooth = (type == 'S');
+						const bool reflect = (previous == 'C' || previous == 'S');
+
+						segment.type = SvgSegmentType::Cubic;
+						segment.points[1][0] = isSmooth ? (reflect ? (2.0 * current[0]) - control[0] : current[0]) : origin[0] + values[0];
+						segment.points[1][1] = isSmooth ? (reflect ? (2.0 * current[1]) - control[1] : current[1]) : origin[1] + values[1];
+						segment.points[2][0] = origin[0] + values[isSmooth ? 0 : 2];
+						segment.points[2][1] = origin[1] + values[isSmooth ? 1 : 3];
+						segment.points[3][0] = end[0];
+						segment.points[3][1] = end[1];
+
+						control[0] = segment.points[2][0];
+						control[1] = segment.points[2][1];
+
+						addSegment(segment, end);
+						break;
+
+					}
+
+					case 'Q':
+					case 'T':
+					{
+
+						const bool isSmooth = (type == 'T');
+						const bool reflect = (previous == 'Q' || previous == 'T');
+
+						segment.type = SvgSegmentType::Quadratic;
+						segment.points[1][0] = isSmooth ? (reflect ? (2.0 * current[0]) - control[0] : current[0]) : origin[0] + values[0];
+						segment.points[1][1] = isSmooth ? (reflect ? (2.0 * current[1]) - control[1] : current[1]) : origin[1] + values[1];
+						segment.points[2][0] = end[0];
+						segment.points[2][1] = end[1];
+
+						control[0] = segment.points[1][0];
+						control[1] = segment.points[1][1];
+
+						addSegment(segment, end);
+						break;
+
+					}
+
+					case 'A':
+					{
+
+						// Endpoint arcs are converted to their center parameterization, see the SVG implementation notes
+						//
+						double rx = std::abs(values[0]);
+						double ry = std::abs(values[1]);
+
+						if (end[0] == current[0] && end[1] == current[1])
+						{
+
+							break;
+
+						}
+
+						segment.type = SvgSegmentType::Line;
+						segment.points[1][0] = end[0];
+						segment.points[1][1] = end[1];
+
+						if (rx > 0.0 && ry > 0.0)
+						{
+
+							const double phi = values[2] * (Core::PI / 180.0);
+							const double cosPhi = std::cos(phi);
+							const double sinPhi = std::sin(phi);
+
+							const double dx = (current[0] - end[0]) * 0.5;
+							const double dy = (current[1] - end[1]) * 0.5;
+							const double x1 = (cosPhi * dx) + (sinPhi * dy);
+							const double y1 = (-sinPhi * dx) + (cosPhi * dy);
+
+							const double lambda = ((x1 * x1) / (rx * rx)) + ((y1 * y1) / (ry * ry));
+
+							if (lambda > 1.0)
+							{
+
+								rx *= std::sqrt(lambda);
+								ry *= std::sqrt(lambda);
+
+							}
+
+							const double numerator = (rx * rx * ry * ry) - (rx * rx * y1 * y1) - (ry * ry * x1 * x1);
+							const double denominator = (rx * rx * y1 * y1) + (ry * ry * x1 * x1);
+							const double sign = ((values[3] != 0.0) == (values[4] != 0.0)) ? -1.0 : 1.0;
+							const double coefficient = sign * std::sqrt(std::max(0.0, numerator / denominator));
+
+							const double cx = coefficient * ((rx * y1) / ry);
+							const double cy = coefficient * -((ry * x1) / rx);
+
+							const double startAngle = std::atan2((y1 - cy) / ry, (x1 - cx) / rx);
+							double sweepAngle = std::atan2((-y1 - cy) / ry, (-x1 - cx) / rx) - startAngle;
+
+							if (values[4] == 0.0 && sweepAngle > 0.0)
+							{
+
+								sweepAngle -= 2.0 * Core::PI;
+
+							}
+							else if (values[4] != 0.0 && sweepAngle < 0.0)
+							{
+
+								sweepAngle += 2.0 * Core::PI;
+
+							}
+
+							segment.type = SvgSegmentType::Arc;
+							segment.center[0] = (cosPhi * cx) - (sinPhi * cy) + ((current[0] + end[0]) * 0.5);
+							segment.center[1] = (sinPhi * cx) + (cosPhi * cy) + ((current[1] + end[1]) * 0.5);
+							segment.radii[0] = rx;
+							segment.radii[1] = ry;
+							segment.rotation = phi;
+							segment.startAngle = startAngle;
+							segment.sweepAngle = sweepAngle;
+
+						}
+
+						addSegment(segment, end);
+						break;
+
+					}
+
+				}
+
+				previous = type;
+
+			}
+
+			return true;
+
+		};
+
+
+		inline bool findSvgAttribute(const std::string& element, const char* name, std::string& value)
+		/**
+		Finds the value of the named attribute inside the supplied element's start tag.
+
+		@param element: The start tag, from its '<' to its '>'.
+		@param name: The attribute name.
+		@param value: The passed string to populate.
+		@return: bool
+		*/
+		{
+
+			size_t position = element.find_first_of(" \t\r\n");
+
+			while (position != std::string::npos && position < element.size())
+			{
+
+				position = element.find_first_not_of(" \t\r\n", position);
+
+				if (position == std::string::npos || element[position] == '>' || element[position] == '/')
+				{
+
+					break;
+
+				}
+
+				const size_t nameEnd = element.find_first_of(" \t\r\n=/>", position);
+
+				if (nameEnd == std::string::npos)
+				{
+
+					break;
+
+				}
+
+				const std::string attribute = element.substr(position, nameEnd - position);
+				position = element.find_first_not_of(" \t\r\n", nameEnd);
+
+				if (position == std::string::npos || element[position] != '=')
+				{
+
+					continue;
+
+				}
+
+				position = element.find_first_not_of(" \t\r\n", position + 1);
+
+				if (position == std::string::npos || (element[position] != '"' && element[position] != '\''))
+				{
+
+					break;
+
+				}
+
+				const size_t valueEnd = element.find(element[position], position + 1);
+
+				if (valueEnd == std::string::npos)
+				{
+
+					break;
+
+				}
+
+				if (attribute == name)
+				{
+
+					value = element.substr(position + 1, valueEnd - position - 1);
+					return true;
+
+				}
+
+				position = valueEnd + 1;
+
+			}
+
+			return false;
+
+		};
+
+
+		inline void triangulateOutline(const std::vector<Core::PointD>& outline, const uint32_t offset, std::vector<uint32_t>& triangles)
+		/**
+		Ear clips a simple planar outline in the XY plane, appending counter-clockwise triangles to the supplied indices.
+
+		@param outline: The outline's points, in order.
+		@param offset: The index of the outline's first point.
+		@param triangles: The passed indices to append to.
+		@return: void
+		*/
+		{
+
+			const size_t numPoints = outline.size();
+
+			if (numPoints < 3)
+			{
+
+				return;
+
+			}
+
+			double area = 0.0;
+
+			for (size_t i = 0; i < numPoints; i++)
+			{
+
+				const Core::PointD& a = outline[i];
+				const Core::PointD& b = outline[(i + 1) % numPoints];
+
+				area += (a.x * b.y) - (b.x * a.y);
+
+			}
+
+			const double orientation = (area >= 0.0) ? 1.0 : -1.0;
+
+			auto cross = [&outline, orientation](const size_t a, const size_t b, const Core::PointD& c)
+			{
+
+				return (((outline[b].x - outline[a].x) * (c.y - outline[a].y)) - ((outline[b].y - outline[a].y) * (c.x - outline[a].x))) * orientation;
+
+			};
+
+			auto addTriangle = [&triangles, offset, orientation](const size_t a, const size_t b, const size_t c)
+			{
+
+				triangles.push_back(offset + static_cast<uint32_t>(a));
+				triangles.push_back(offset + static_cast<uint32_t>(orientation > 0.0 ? b : c));
+				triangles.push_back(offset + static_cast<uint32_t>(orientation > 0.0 ? c : b));
+
+			};
+
+			std::vector<size_t> remaining(numPoints);
+
+			for (size_t i = 0; i < numPoints; i++)
+			{
+
+				remaining[i] = i;
+
+			}
+
+			size_t current = 0;
+			size_t attempts = 0;
+
+			while (remaining.size() > 3 && attempts < remaining.size())
+			{
+
+				const size_t count = remaining.size();
+				const size_t a = remaining[(current + count - 1) % count];
+				const size_t b = remaining[current];
+				const size_t c = remaining[(current + 1) % count];
+
+				// An ear is convex and contains no other point
+				//
+				bool isEar = cross(a, b, outline[c]) > 0.0;
+
+				for (size_t i = 0; isEar && i < count; i++)
+				{
+
+					const size_t index = remaining[i];
+
+					if (index != a && index != b && index != c)
+					{
+
+						const Core::PointD& point = outline[index];
+						isEar = !(cross(a, b, point) >= 0.0 && cross(b, c, point) >= 0.0 && cross(c, a, point) >= 0.0);
+
+					}
+
+				}
+
+				if (isEar)
+				{
+
+					addTriangle(a, b, c);
+					remaining.erase(remaining.begin() + current);
+
+					current = (current < remaining.size()) ? current : 0;
+					attempts = 0;
+
+				}
+				else
+				{
+
+					current = (current + 1) % count;
+					attempts++;
+
+				}
+
+			}
+
+			if (remaining.size() == 3)
+			{
+
+				addTriangle(remaining[0], remaining[1], remaining[2]);
+
+			}
+
+		};
+
+
+		inline bool parseSvg(std::istream& stream, ShapeAsset& asset, std::string& error)
+		/**
+		Parses the path elements of an SVG file and flattens them into indexed line segments, and triangles for filled paths.
+		Curves and arcs are flattened adaptively to within SVG_TOLERANCE of the drawing's size.
+		The drawing is centered and scaled to fit a 2 unit square in the XY plane, facing +Z, with SVG's downward Y flipped up.
+		Transforms, styles other than "fill" and elements other than paths are ignored, and each subpath is filled on its own.
+
+		@param stream: The stream to read.
+		@param asset: The passed asset to populate.
+		@param error: The passed string to populate on failure.
+		@return: bool
+		*/
+		{
+
+			asset.points.clear();
+			asset.normals.clear();
+			asset.lineIndices.clear();
+			asset.triangleIndices.clear();
+
+			const std::string text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+			// Collect the subpaths of every path element
+			//
+			std::vector<SvgSubpath> subpaths;
+			std::string data, fill, style;
+			size_t position = 0;
+
+			while ((position = text.find("<path", position)) != std::string::npos)
+			{
+
+				const size_t end = text.find('>', position);
+
+				if (end == std::string::npos)
+				{
+
+					error = "unterminated path element";
+					return false;
+
+				}
+
+				const std::string element = text.substr(position, end - position + 1);
+				position = end;
+
+				if (!std::isspace(static_cast<unsigned char>(element[5])) || !findSvgAttribute(element, "d", data))
+				{
+
+					continue;
+
+				}
+
+				const size_t first = subpaths.size();
+
+				if (!parseSvgPath(data.c_str(), subpaths, error))
+				{
+
+					return false;
+
+				}
+
+				fill.clear();
+				style.clear();
+
+				findSvgAttribute(element, "fill", fill);
+				findSvgAttribute(element, "style", style);
+				style.erase(std::remove(style.begin(), style.end(), ' '), style.end());
+
+				const bool isFilled = (fill != "none" && style.find("fill:none") == std::string::npos);
+
+				for (size_t i = first; i < subpaths.size(); i++)
+				{
+
+					subpaths[i].fill = isFilled;
+
+				}
+
+			}
+
+			// Fit the drawing to a 2 unit square
+			//
+			double min[2] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+			double max[2] = { std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest() };
+
+			for (const SvgSubpath& subpath : subpaths)
+			{
+
+				for (const SvgSegment& segment : subpath.segments)
+				{
+
+					segment.expand(min, max);
+
+				}
+
+			}
+
+			if (min[0] > max[0])
+			{
+
+				error = "no path data";
+				return false;
+
+			}
+
+			const double extent = std::max(max[0] - min[0], max[1] - min[1]);
+			const double size = (extent > 0.0) ? extent : 1.0;
+			const double scale = 2.0 / size;
+			const double tolerance = SVG_TOLERANCE * size;
+			const double center[2] = { (min[0] + max[0]) * 0.5, (min[1] + max[1]) * 0.5 };
+
+			// Flatten each subpath into an outline
+			//
+			std::vector<Core::PointD> outline;
+			std::vector<Core::PointD> lines;
+
+			for (const SvgSubpath& subpath : subpaths)
+			{
+
+				outline.clear();
+				outline.emplace_back(subpath.start[0], subpath.start[1], 0.0);
+
+				for (const SvgSegment& segment : subpath.segments)
+				{
+
+					if (segment.type == SvgSegmentType::Line)
+					{
+
+						outline.emplace_back(segment.points[1][0], segment.points[1][1], 0.0);
+						continue;
+
+					}
+
+					// Arcs start from one segment per quarter turn
+					//
+					const size_t numSegments = (segment.type == SvgSegmentType::Arc) ? static_cast<size_t>(std::ceil(std::abs(segment.sweepAngle) / (Core::PI * 0.5))) * 2 : 2;
+
+					auto evaluate = [&segment](const double t)
+					{
+
+						return segment.evaluate(t);
+
+					};
+
+					lines.clear();
+					Core::tessellateCurve(evaluate, 0.0, 1.0, numSegments, tolerance, SVG_MAX_DEPTH, lines);
+
+					for (size_t i = 1; i < lines.size(); i += 2)
+					{
+
+						outline.push_back(lines[i]);
+
+					}
+
+				}
+
+				// Drop repeated points so the outline is simple enough to ear clip
+				//
+				size_t numPoints = 0;
+
+				for (size_t i = 0; i < outline.size(); i++)
+				{
+
+					if (numPoints == 0 || (outline[i] - outline[numPoints - 1]).length() > (tolerance * 1e-3))
+					{
+
+						outline[numPoints++] = outline[i];
+
+					}
+
+				}
+
+				outline.resize(numPoints);
+
+				const bool isClosed = subpath.closed || subpath.fill;
+
+				if (isClosed && numPoints > 1 && (outline.back() - outline.front()).length() <= (tolerance * 1e-3))
+				{
+
+					outline.pop_back();
+					numPoints--;
+
+				}
+
+				if (numPoints < 2)
+				{
+
+					continue;
+
+				}
+
+				const uint32_t offset = static_cast<uint32_t>(asset.points.size() / 3);
+
+				for (Core::PointD& point : outline)
+				{
+
+					point = Core::PointD((point.x - center[0]) * scale, (center[1] - point.y) * scale, 0.0);
+
+					asset.points.push_back(static_cast<float>(point.x));
+					asset.points.push_back(static_cast<float>(point.y));
+					asset.points.push_back(0.0f);
+
+				}
+
+				for (size_t i = 0; i + 1 < numPoints; i++)
+				{
+
+					asset.lineIndices.push_back(offset + static_cast<uint32_t>(i));
+					asset.lineIndices.push_back(offset + static_cast<uint32_t>(i + 1));
+
+				}
+
+				if (subpath.closed && numPoints > 2)
+				{
+
+					asset.lineIndices.push_back(offset + static_cast<uint32_t>(numPoints - 1));
+					asset.lineIndices.push_back(offset);
+
+				}
+
+				if (subpath.fill)
+				{
+
+					triangulateOutline(outline, offset, asset.triangleIndices);
+
+				}
+
+			}
+
+			// Every point faces the viewer
+			//
+			if (!asset.triangleIndices.empty())
+			{
+
+				asset.normals.resize(asset.points.size(), 0.0f);
+
+				for (size_t i = 2; i < asset.normals.size(); i += 3)
+				{
+
+					asset.normals[i] = 1.0f;
+
+				}
+
+			}
+
+			asset.bind();
+
+			return true;
+
+		};
+
+
+		class AssetCache
+		/**
+		A process-wide cache of shapes parsed from files, keyed by path and modification time.
+		Each file is parsed once on a worker thread and every helper that references it shares the result.
+		Modification times are checked at most once per ASSET_CHECK_INTERVAL so requests stay cheap enough to make every frame.
+		*/
+		{
+
+		public:
+
+			static AssetState request(const std::string& path, std::shared_ptr<const ShapeAsset>& asset, std::string& error)
+			/**
+			Returns the state of the supplied file's shape, and the shape once it is ready.
+			The first request for a file, or for a file that has changed, starts parsing it and returns pending.
+
+			@param path: The file to load.
+			@param asset: The passed pointer to populate once the shape is ready.
+			@param error: The passed string to populate if the file could not be parsed.
+			@return: AssetState
+			*/
+			{
+
+				asset = nullptr;
+
+				if (path.empty())
+				{
+
+					return AssetState::None;
+
+				}
+
+				AssetCache& cache = AssetCache::instance();
+				std::lock_guard<std::mutex> lock(cache.mutex);
+
+				Entry& entry = cache.entries[path];
+				const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+				// Collect a finished parse
+				//
+				if (entry.state == AssetState::Pending)
+				{
+
+					if (entry.future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+					{
+
+						return AssetState::Pending;
+
+					}
+
+					LoadResult result = entry.future.get();
+
+					entry.asset = result.asset;
+					entry.error = result.error;
+					entry.state = (entry.asset != nullptr) ? AssetState::Ready : AssetState::Failed;
+
+				}
+
+				// Reparse when the file changes
+				//
+				if (entry.state == AssetState::None || (now - entry.checked) >= ASSET_CHECK_INTERVAL)
+				{
+
+					entry.checked = now;
+
+					std::error_code errorCode;
+					const std::filesystem::file_time_type modified = std::filesystem::last_write_time(std::filesystem::u8path(path), errorCode);
+
+					if (errorCode)
+					{
+
+						entry.state = AssetState::Failed;
+						entry.asset = nullptr;
+						entry.error = "unable to open " + path;
+						entry.hasModified = false;
+
+					}
+					else if (!entry.hasModified || modified != entry.modified)
+					{
+
+						entry.modified = modified;
+						entry.hasModified = true;
+						entry.state = AssetState::Pending;
+						entry.future = std::async(std::launch::async, &AssetCache::load, path);
+
+						return AssetState::Pending;
+
+					}
+
+				}
+
+				asset = entry.asset;
+				error = entry.error;
+
+				return entry.state;
+
+			};
+
+			static void clear()
+			/**
+			Waits for any pending parses and releases every cached shape.
+			Helpers that still hold a shape keep it until they release it.
+
+			@return: void
+			*/
+			{
+
+				AssetCache& cache = AssetCache::instance();
+				std::lock_guard<std::mutex> lock(cache.mutex);
+
+				cache.entries.clear();
+
+			};
+
+			static size_t memoryUsage()
+			/**
+			Returns the bytes held by the cached shapes.
+
+			@return: size_t
+			*/
+			{
+
+				AssetCache& cache = AssetCache::instance();
+				std::lock_guard<std::mutex> lock(cache.mutex);
+
+				size_t bytes = 0;
+
+				for (const auto& pair : cache.entries)
+				{
+
+					const std::shared_ptr<const ShapeAsset>& asset = pair.second.asset;
+
+					if (asset != nullptr)
+					{
+
+						bytes += sizeof(ShapeAsset) + (asset->points.capacity() * sizeof(float)) + (asset->normals.capacity() * sizeof(float));
+						bytes += (asset->lineIndices.capacity() + asset->triangleIndices.capacity()) * sizeof(uint32_t);
+
+					}
+
+				}
+
+				return bytes;
+
+			};
+
+		protected:
+
+			struct LoadResult
+			{
+
+				std::shared_ptr<const ShapeAsset>	asset;
+				std::string							error;
+
+			};
+
+			struct Entry
+			{
+
+				AssetState									state = AssetState::None;
+				std::shared_ptr<const ShapeAsset>			asset;
+				std::future<LoadResult>						future;
+				std::filesystem::file_time_type				modified;
+				bool										hasModified = false;
+				std::chrono::steady_clock::time_point		checked;
+				std::string									error;
+
+			};
+
+			static AssetCache& instance()
+			{
+
+				static AssetCache cache;
+				return cache;
+
+			};
+
+			static LoadResult load(const std::string path)
+			{
+
+				LoadResult result;
+				std::ifstream stream(std::filesystem::u8path(path));
+
+				if (!stream.is_open())
+				{
+
+					result.error = "unable to open " + path;
+					return result;
+
+				}
+
+				std::shared_ptr<ShapeAsset> asset = std::make_shared<ShapeAsset>();
+				asset->name = path;
+
+				// Pick a parser from the file's extension
+				//
+				std::string extension = std::filesystem::u8path(path).extension().string();
+				for (char& character : extension)
+				{
+
+					character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+
+				}
+
+				const bool isParsed = (extension == ".svg") ? parseSvg(stream, *asset, result.error) : parseObj(stream, *asset, result.error);
+
+				if (!isParsed)
+				{
+
+					result.error = path + ": " + result.error;
+					return result;
+
+				}
+
+				result.asset = asset;
+
+				return result;
+
+			};
+
+			std::mutex								mutex;
+			std::unordered_map<std::string, Entry>	entries;
+
+		};
+
+	};
+
+};
+#endif
@@ -0,0 +1,367 @@
+//
+// File: GeometryCache.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "GeometryCache.h"
+
+#include <cstring>
+
+using namespace Drawable;
+
+
+const size_t GeometryCache::DEFAULT_CAPACITY = 1024;
+
+
+GeometryKey::GeometryKey(unsigned int drawable, const MMatrix& matrix)
+/**
+Constructor.
+
+@param drawable: The id of the drawable the geometry belongs to.
+@param matrix: The object matrix the geometry is transformed by.
+*/
+{
+
+	this->drawable = drawable;
+	matrix.get(this->matrix);
+
+};
+
+
+bool GeometryKey::operator==(const GeometryKey& other) const
+/**
+Equality operator.
+Matrices are compared bitwise so keys only match when their geometry would be identical.
+
+@param other: The key to compare against.
+@return: bool
+*/
+{
+
+	return this->drawable == other.drawable && this->variant == other.variant && std::memcmp(this->matrix, other.matrix, sizeof(this->matrix)) == 0 && this->sources[0] == other.sources[0] && this->sources[1] == other.sources[1];
+
+};
+
+
+size_t GeometryKeyHash::operator()(const GeometryKey& key) const
+/**
+Returns the hash of the supplied key.
+
+@param key: The key to hash.
+@return: size_t
+*/
+{
+
+	uint64_t hash = Core::hashBytes(&key.drawable, sizeof(key.drawable));
+	hash = Core::hashBytes(&key.variant, sizeof(key.variant), hash);
+	hash = Core::hashBytes(key.matrix, sizeof(key.matrix), hash);
+	hash = Core::hashBytes(key.sources, sizeof(key.sources), hash);
+
+	return static_cast<size_t>(hash);
+
+};
+
+
+GeometryCache::Cache& GeometryCache::instance()
+/**
+Returns the cache shared by every helper.
+
+@return: Cache
+*/
+{
+
+	static Cache cache(GeometryCache::DEFAULT_CAPACITY);
+	return cache;
+
+};
+
+
+std::shared_ptr<const PreparedGeometry> GeometryCache::find(const GeometryKey& key)
+/**
+Returns the geometry prepared for the supplied key, or a null pointer if there is none.
+
+@param key: The inputs to look up.
+@return: std::shared_ptr<const PreparedGeometry>
+*/
+{
+
+	return GeometryCache::instance().find(key);
+
+};
+
+
+std::shared_ptr<const PreparedGeometry> GeometryCache::insert(const GeometryKey& key, std::shared_ptr<const PreparedGeometry> geometry)
+/**
+Shares the geometry prepared for the supplied key with every other helper.
+If the same key was inserted meanwhile the existing geometry is returned instead.
+
+@param key: The inputs the geometry was prepared from.
+@param geometry: The prepared geometry.
+@return: std::shared_ptr<const PreparedGeometry>
+*/
+{
+
+	return GeometryCache::instance().insert(key, geometry);
+
+};
+
+
+std::shared_ptr<PreparedGeometry> GeometryCache::acquire(const GeometryKey& key, std::shared_ptr<const PreparedGeometry>& geometry)
+/**
+Returns the geometry a drawable should build for the supplied key, or a null pointer if its current geometry is already up to date.
+A drawable without geometry looks for one shared by another helper first, and builds a new one to share if there is none.
+A drawable whose inputs changed since its last prepare is treated as animated, it rebuilds its own geometry in place when nothing else holds it and never publishes it.
+Pass the returned geometry to commit() once it has been built.
+
+@param key: The inputs the geometry is built from.
+@param geometry: The drawable's current geometry, updated when a shared geometry is found.
+@return: std::shared_ptr<PreparedGeometry>
+*/
+{
+
+	// Check if the current geometry was built from the same inputs
+	//
+	if (geometry != nullptr && geometry->key == key)
+	{
+
+		return nullptr;
+
+	}
+
+	// Share static geometry with every helper that has the same inputs
+	//
+	if (geometry == nullptr)
+	{
+
+		geometry = GeometryCache::find(key);
+
+		if (geometry != nullptr)
+		{
+
+			return nullptr;
+
+		}
+
+		std::shared_ptr<PreparedGeometry> prepared = std::make_shared<PreparedGeometry>();
+		prepared->key = key;
+		prepared->isShared = true;
+
+		return prepared;
+
+	}
+
+	// Rebuild private geometry in place, a shared geometry is swapped for a private one once
+	//
+	std::shared_ptr<PreparedGeometry> prepared;
+
+	if (!geometry->isShared && geometry.use_count() == 1)
+	{
+
+		prepared = std::const_pointer_cast<PreparedGeometry>(geometry);
+
+	}
+	else
+	{
+
+		prepared = std::make_shared<PreparedGeometry>();
+
+	}
+
+	prepared->key = key;
+	prepared->isShared = false;
+
+	return prepared;
+
+};
+
+
+void GeometryCache::commit(std::shared_ptr<PreparedGeometry> prepared, std::shared_ptr<const PreparedGeometry>& geometry)
+/**
+Hands the geometry returned by acquire() back to the drawable once it has been built.
+Shared geometry is inserted into the cache, and if another helper inserted the same key meanwhile its geometry is used instead.
+
+@param prepared: The built geometry.
+@param geometry: The drawable's geometry to update.
+@return: void
+*/
+{
+
+	if (prepared == nullptr)
+	{
+
+		return;
+
+	}
+
+	if (prepared->isShared)
+	{
+
+		geometry = GeometryCache::insert(prepared->key, prepared);
+
+	}
+	else
+	{
+
+		geometry = prepared;
+
+	}
+
+};
+
+
+void GeometryCache::prepare(const GeometryKey& key, const MeshBuffers& buffers, std::shared_ptr<const PreparedGeometry>& geometry)
+/**
+Updates a drawable's geometry to the supplied shared buffers transformed by the key's matrix, see acquire().
+
+@param key: The inputs the geometry is built from.
+@param buffers: The object space buffers to transform.
+@param geometry: The drawable's geometry to update.
+@return: void
+*/
+{
+
+	std::shared_ptr<PreparedGeometry> prepared = GeometryCache::acquire(key, geometry);
+
+	if (prepared == nullptr)
+	{
+
+		return;
+
+	}
+
+	Drawable::transform(MMatrix(key.matrix), buffers, prepared->triangles, prepared->normals, prepared->lines);
+	GeometryCache::commit(prepared, geometry);
+
+};
+
+
+void GeometryCache::prepare(const GeometryKey& key, const double points[][4], const int numPoints, std::shared_ptr<const PreparedGeometry>& geometry)
+/**
+Updates a drawable's geometry to the supplied line points transformed by the key's matrix, see acquire().
+
+@param key: The inputs the geometry is built from.
+@param points: The object space line points to transform.
+@param numPoints: The number of points.
+@param geometry: The drawable's geometry to update.
+@return: void
+*/
+{
+
+	std::shared_ptr<PreparedGeometry> prepared = GeometryCache::acquire(key, geometry);
+
+	if (prepared == nullptr)
+	{
+
+		return;
+
+	}
+
+	Drawable::transform(MMatrix(key.matrix), points, numPoints, prepared->lines);
+	GeometryCache::commit(prepared, geometry);
+
+};
+
+
+void GeometryCache::setCapacity(size_t capacity)
+/**
+Updates the number of prepared geometries to keep, idle geometry over it is evicted least recently used first.
+
+@param capacity: The new capacity.
+@return: void
+*/
+{
+
+	GeometryCache::instance().setCapacity(capacity);
+
+};
+
+
+void GeometryCache::clear()
+/**
+Releases every cached geometry, helpers that still hold one keep it until they prepare again.
+
+@return: void
+*/
+{
+
+	GeometryCache::instance().clear();
+
+};
+
+
+size_t GeometryCache::size()
+/**
+Returns the number of distinct geometries in the cache.
+
+@return: size_t
+*/
+{
+
+	return GeometryCache::instance().size();
+
+};
+
+
+void GeometryCache::memoryUsage(MemoryUsage& usage)
+/**
+Adds the bytes held by the cached geometry to the supplied usage.
+
+@param usage: The usage to add to.
+@return: void
+*/
+{
+
+	GeometryCache::instance().forEach(
+		[&usage](const PreparedGeometry& geometry)
+		{
+
+			GeometryCache::memoryUsage(geometry, usage);
+
+		}
+	);
+
+};
+
+
+void GeometryCache::memoryUsage(const PreparedGeometry& geometry, MemoryUsage& usage)
+/**
+Adds the bytes held by the supplied geometry to the supplied usage.
+
+@param geometry: The geometry to measure.
+@param usage: The usage to add to.
+@return: void
+*/
+{
+
+	usage.add(Buffer::Triangles, Drawable::sizeOf(geometry.triangles));
+	usage.add(Buffer::Normals, Drawable::sizeOf(geometry.normals));
+	usage.add(Buffer::Lines, Drawable::sizeOf(geometry.lines));
+
+};
+
+
+uint64_t GeometryCache::hitCount()
+/**
+Returns the number of prepares that reused another helper's geometry.
+
+@return: uint64_t
+*/
+{
+
+	return GeometryCache::instance().hitCount();
+
+};
+
+
+uint64_t GeometryCache::missCount()
+/**
+Returns the number of prepares that had to build their geometry.
+
+@return: uint64_t
+*/
+{
+
+	return GeometryCache::instance().missCount();
+
+};
@@ -0,0 +1,107 @@
+#ifndef _GEOMETRY_CACHE
+#define _GEOMETRY_CACHE
+//
+// File: GeometryCache.h
+//
+// Author: Ben Singleton
+//
+
+#include "Drawable.h"
+#include "DrawableCore.h"
+#include "MemoryUsage.h"
+
+#include <maya/MMatrix.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
+
+#include <memory>
+
+
+namespace Drawable
+{
+
+	struct GeometryKey
+	/**
+	The inputs a drawable's prepared geometry is built from.
+	Helpers with equal keys draw identical geometry so they share one set of buffers.
+	*/
+	{
+
+		unsigned int	drawable = 0;
+		unsigned int	variant = 0;
+		double			matrix[4][4] = {};
+		const void*		sources[2] = { nullptr, nullptr };
+
+						GeometryKey() {};
+						GeometryKey(unsigned int drawable, const MMatrix& matrix);
+
+		bool			operator==(const GeometryKey& other) const;
+
+	};
+
+
+	struct GeometryKeyHash
+	{
+
+		size_t			operator()(const GeometryKey& key) const;
+
+	};
+
+
+	struct PreparedGeometry : public MeshBuffers
+	/**
+	Object space triangles, normals and lines ready to draw.
+	Keys may point at shared inputs, such as library shapes, so the geometry holds those inputs to keep their addresses from being reused.
+	Geometry that is not shared is owned by a single drawable, which rebuilds it in place whenever its inputs change.
+	A helper's batch of merged drawables also records, by drawable id, the drawables that were left out of it.
+	*/
+	{
+
+		GeometryKey					key;
+		bool						isShared = false;
+		unsigned int				unbatched = 0;
+		std::shared_ptr<const void>	owners[2];
+
+	};
+
+
+	class GeometryCache
+	/**
+	A plugin-wide, content-addressed cache of prepared geometry.
+	Memory and prepare cost scale with the number of distinct looks in the scene rather than the number of helpers.
+	Only static inputs are shared, a drawable whose inputs change between prepares rebuilds its own geometry in place without locking the cache.
+	*/
+	{
+
+	public:
+
+		static	std::shared_ptr<const PreparedGeometry>	find(const GeometryKey& key);
+		static	std::shared_ptr<const PreparedGeometry>	insert(const GeometryKey& key, std::shared_ptr<const PreparedGeometry> geometry);
+
+		static	std::shared_ptr<PreparedGeometry>		acquire(const GeometryKey& key, std::shared_ptr<const PreparedGeometry>& geometry);
+		static	void			commit(std::shared_ptr<PreparedGeometry> prepared, std::shared_ptr<const PreparedGeometry>& geometry);
+
+		static	void			prepare(const GeometryKey& key, const MeshBuffers& buffers, std::shared_ptr<const PreparedGeometry>& geometry);
+		static	void			prepare(const GeometryKey& key, const double points[][4], const int numPoints, std::shared_ptr<const PreparedGeometry>& geometry);
+
+		static	void			setCapacity(size_t capacity);
+		static	void			clear();
+
+		static	size_t			size();
+		static	void			memoryUsage(MemoryUsage& usage);
+		static	void			memoryUsage(const PreparedGeometry& geometry, MemoryUsage& usage);
+		static	uint64_t		hitCount();
+		static	uint64_t		missCount();
+
+		static	const size_t	DEFAULT_CAPACITY;
+
+	protected:
+
+		typedef Core::SharedCache<GeometryKey, PreparedGeometry, GeometryKeyHash> Cache;
+
+		static	Cache&			instance();
+
+	};
+
+};
+#endif
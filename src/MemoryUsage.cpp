@@ -0,0 +1,255 @@
+//
+// File: MemoryUsage.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "MemoryUsage.h"
+#include "Drawable.h"
+
+#include <maya/MFnMesh.h>
+
+using namespace Drawable;
+
+
+MemoryUsage::MemoryUsage()
+/**
+Constructor.
+*/
+{
+
+	this->clear();
+
+};
+
+
+MemoryUsage::~MemoryUsage() {};
+
+
+void MemoryUsage::add(Buffer buffer, size_t bytes)
+/**
+Adds the supplied number of bytes to a buffer type.
+
+@param buffer: The buffer type.
+@param bytes: The number of bytes.
+@return: void
+*/
+{
+
+	this->bytes[static_cast<unsigned int>(buffer)] += bytes;
+
+};
+
+
+size_t MemoryUsage::get(Buffer buffer) const
+/**
+Returns the number of bytes held by a buffer type.
+
+@param buffer: The buffer type.
+@return: size_t
+*/
+{
+
+	return this->bytes[static_cast<unsigned int>(buffer)];
+
+};
+
+
+size_t MemoryUsage::total() const
+/**
+Returns the number of bytes held by all buffer types.
+
+@return: size_t
+*/
+{
+
+	size_t total = 0;
+
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++)
+	{
+
+		total += this->bytes[i];
+
+	}
+
+	return total;
+
+};
+
+
+void MemoryUsage::clear()
+/**
+Resets every buffer type to zero bytes.
+
+@return: void
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++)
+	{
+
+		this->bytes[i] = 0;
+
+	}
+
+};
+
+
+MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& other)
+/**
+Adds the bytes from another usage to this one.
+
+@param other: The usage to add.
+@return: MemoryUsage
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++)
+	{
+
+		this->bytes[i] += other.bytes[i];
+
+	}
+
+	return *this;
+
+};
+
+
+const char* MemoryUsage::bufferName(Buffer buffer)
+/**
+Returns the display name for a buffer type.
+
+@param buffer: The buffer type.
+@return: const char*
+*/
+{
+
+	static const char* names[] = { "userData", "triangles", "normals", "lines", "meshData" };
+
+	return (buffer < Buffer::Count) ? names[static_cast<unsigned int>(buffer)] : "unknown";
+
+};
+
+
+size_t Drawable::sizeOf(const MPointArray& points)
+/**
+Returns the number of bytes held by the supplied point array.
+
+@param points: The point array.
+@return: size_t
+*/
+{
+
+	return sizeof(MPointArray) + (points.length() * sizeof(MPoint));
+
+};
+
+
+size_t Drawable::sizeOf(const MVectorArray& vectors)
+/**
+Returns the number of bytes held by the supplied vector array.
+
+@param vectors: The vector array.
+@return: size_t
+*/
+{
+
+	return sizeof(MVectorArray) + (vectors.length() * sizeof(MVector));
+
+};
+
+
+size_t Drawable::sizeOf(const MIntArray& values)
+/**
+Returns the number of bytes held by the supplied integer array.
+
+@param values: The integer array.
+@return: size_t
+*/
+{
+
+	return sizeof(MIntArray) + (values.length() * sizeof(int));
+
+};
+
+
+size_t Drawable::sizeOf(const MString& string)
+/**
+Returns the number of bytes held by the supplied string.
+
+@param string: The string.
+@return: size_t
+*/
+{
+
+	return sizeof(MString) + string.numChars() + 1;
+
+};
+
+
+size_t Drawable::sizeOf(const MStringArray& strings)
+/**
+Returns the number of bytes held by the supplied string array.
+
+@param strings: The string array.
+@return: size_t
+*/
+{
+
+	size_t bytes = sizeof(MStringArray);
+
+	for (unsigned int i = 0; i < strings.length(); i++)
+	{
+
+		bytes += Drawable::sizeOf(strings[i]);
+
+	}
+
+	return bytes;
+
+};
+
+
+size_t Drawable::sizeOf(const MeshBuffers& buffers)
+/**
+Returns the number of bytes held by the supplied mesh buffers.
+
+@param buffers: The mesh buffers.
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOf(buffers.triangles) + Drawable::sizeOf(buffers.normals) + Drawable::sizeOf(buffers.lines);
+
+};
+
+
+size_t Drawable::sizeOfMeshData(const MObject& meshData)
+/**
+Returns an estimate of the bytes held by the supplied mesh data.
+Maya stores points as floats along with the polygon counts, connects and edges.
+
+@param meshData: The mesh data object.
+@return: size_t
+*/
+{
+
+	MStatus status;
+	MFnMesh fnMesh(meshData, &status);
+
+	if (!status)
+	{
+
+		return 0;
+
+	}
+
+	size_t numVertices = static_cast<size_t>(fnMesh.numVertices());
+	size_t numPolygons = static_cast<size_t>(fnMesh.numPolygons());
+	size_t numFaceVertices = static_cast<size_t>(fnMesh.numFaceVertices());
+	size_t numEdges = static_cast<size_t>(fnMesh.numEdges());
+
+	return (numVertices * 3 * sizeof(float)) + (numPolygons * sizeof(int)) + (numFaceVertices * sizeof(int)) + (numEdges * 2 * sizeof(int));
+
+};
@@ -0,0 +1,79 @@
+#ifndef _MEMORY_USAGE
+#define _MEMORY_USAGE
+//
+// File: MemoryUsage.h
+//
+// Author: Ben Singleton
+//
+
+#include <maya/MObject.h>
+#include <maya/MPoint.h>
+#include <maya/MPointArray.h>
+#include <maya/MVector.h>
+#include <maya/MVectorArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MString.h>
+#include <maya/MStringArray.h>
+
+#include <cstddef>
+
+
+namespace Drawable
+{
+
+	struct MeshBuffers;
+
+
+	enum class Buffer : unsigned int
+	{
+
+		UserData = 0,
+		Triangles,
+		Normals,
+		Lines,
+		MeshData,
+		Count
+
+	};
+
+	static const unsigned int NUM_BUFFERS = static_cast<unsigned int>(Buffer::Count);
+
+
+	class MemoryUsage
+	/**
+	Bytes held by the plugin, broken down by buffer type.
+	Sizes are computed from array lengths so they are a close lower bound rather than exact heap usage.
+	*/
+	{
+
+	public:
+
+								MemoryUsage();
+		virtual					~MemoryUsage();
+
+				void			add(Buffer buffer, size_t bytes);
+				size_t			get(Buffer buffer) const;
+				size_t			total() const;
+				void			clear();
+
+				MemoryUsage&	operator+=(const MemoryUsage& other);
+
+		static	const char*		bufferName(Buffer buffer);
+
+	protected:
+
+				size_t			bytes[NUM_BUFFERS];
+
+	};
+
+
+	size_t			sizeOf(const MPointArray& points);
+	size_t			sizeOf(const MVectorArray& vectors);
+	size_t			sizeOf(const MIntArray& values);
+	size_t			sizeOf(const MString& string);
+	size_t			sizeOf(const MStringArray& strings);
+	size_t			sizeOf(const MeshBuffers& buffers);
+	size_t			sizeOfMeshData(const MObject& meshData);
+
+};
+#endif
@@ -8,6 +8,7 @@
 
 
 MObject		Notch::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Notch::MESH_BUFFERS = Drawable::MeshBuffers();
 MIntArray	Notch::BOUNDARY = MIntArray();
 double		Notch::NOTCH_RADIUS = 0.5;
 int			Notch::SUBDIVISIONS_AXIS = 40;
@@ -59,6 +60,11 @@ Constructor.
 		status = Drawable::getBoundary(Notch::MESH_DATA, Notch::BOUNDARY);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Notch::MESH_DATA, Notch::BOUNDARY, Notch::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 
@@ -68,44 +74,29 @@ Constructor.
 Notch::~Notch() {};
 
 
-void Notch::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Notch::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a notched disc.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Notch::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Get lines from edges
-	//
-	status = Drawable::getLines(meshData, Notch::BOUNDARY, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Notch::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Notch::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData) {
+void Notch::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData) {
 	/**
 	Draws a notch.
 
 	@param drawManager: Interface used for drawing basic shapes inside the viewport.
-	@param frameContext: Contains global information for the current render frame.
 	@return: void
 	*/
 
@@ -118,12 +109,25 @@ void Notch::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrame
 		// Draw mesh
 		//
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
-};
\ No newline at end of file
+};
+
+
+size_t Notch::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every notch.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Notch::MESH_DATA) + Drawable::sizeOf(Notch::BOUNDARY);
+
+};
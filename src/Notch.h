@@ -17,16 +17,15 @@ public:
 							Notch();
 	virtual					~Notch();
 
-	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData);
-	virtual	void			draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
+	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void			draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
 
-protected:
+	virtual	size_t			meshDataMemoryUsage();
 
-			MPointArray		triangles;
-			MVectorArray	normals;
-			MPointArray		lines;
+protected:
 
 	static	MObject			MESH_DATA;
+	static	Drawable::MeshBuffers	MESH_BUFFERS;
 	static	MIntArray		BOUNDARY;
 	static	double			NOTCH_RADIUS;
 	static	int				SUBDIVISIONS_AXIS;
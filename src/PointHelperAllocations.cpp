@@ -0,0 +1,91 @@
+//
+// File: PointHelperAllocations.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperAllocations.h"
+
+#include <cstdlib>
+#include <new>
+
+
+namespace PointHelperAllocations
+{
+
+	static thread_local uint64_t numAllocations = 0;
+
+};
+
+using namespace PointHelperAllocations;
+
+
+#if POINT_HELPER_ALLOCATION_COUNTING
+
+// Every allocation made by the plugin's code goes through these replacements
+// Both forward to malloc and free, like the defaults, so memory can still be released by other modules
+//
+void* operator new(std::size_t size)
+{
+
+	numAllocations++;
+
+	void* pointer = std::malloc(size == 0 ? 1 : size);
+
+	if (pointer == nullptr)
+	{
+
+		throw std::bad_alloc();
+
+	}
+
+	return pointer;
+
+};
+
+
+void* operator new[](std::size_t size)
+{
+
+	return ::operator new(size);
+
+};
+
+
+void operator delete(void* pointer) noexcept { std::free(pointer); };
+void operator delete[](void* pointer) noexcept { std::free(pointer); };
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); };
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); };
+
+#endif
+
+
+bool PointHelperAllocations::isEnabled()
+/**
+Returns whether allocation counting was compiled in.
+
+@return: bool
+*/
+{
+
+	return POINT_HELPER_ALLOCATION_COUNTING != 0;
+
+};
+
+
+Counter::Counter() : start(numAllocations) {};
+Counter::~Counter() {};
+
+
+uint64_t Counter::count() const
+/**
+Returns the number of allocations made on the calling thread since this counter was created.
+This is always 0 when counting is compiled out.
+
+@return: uint64_t
+*/
+{
+
+	return numAllocations - this->start;
+
+};
@@ -0,0 +1,46 @@
+#ifndef _POINT_HELPER_ALLOCATIONS
+#define _POINT_HELPER_ALLOCATIONS
+//
+// File: PointHelperAllocations.h
+//
+// Author: Ben Singleton
+//
+// Counts the heap allocations made by the plugin's own code.
+// Counting replaces the plugin's operator new so it is only compiled in when configured with -DPOINT_HELPER_ALLOCATION_COUNTING=ON!
+//
+
+#include <cstdint>
+
+#ifndef POINT_HELPER_ALLOCATION_COUNTING
+#define POINT_HELPER_ALLOCATION_COUNTING 0
+#endif
+
+
+namespace PointHelperAllocations
+{
+
+	bool		isEnabled();
+
+
+	class Counter
+	/**
+	Counts the allocations made on the calling thread while it is alive.
+	Allocations made inside the Maya libraries are not counted.
+	*/
+	{
+
+	public:
+
+								Counter();
+								~Counter();
+
+				uint64_t		count() const;
+
+	protected:
+
+				uint64_t		start;
+
+	};
+
+};
+#endif
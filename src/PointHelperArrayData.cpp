@@ -0,0 +1,77 @@
+//
+// File: PointHelperArrayData.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperArrayData.h"
+
+
+PointHelperArrayData::PointHelperArrayData() : MUserData()
+/**
+Constructor.
+*/
+{
+
+	this->shapeFlags = (1 << static_cast<int>(Drawable::Shape::Box)) | (1 << static_cast<int>(Drawable::Shape::Cross));
+	this->size = 10.0;
+	this->lineWidth = 1.0f;
+	this->fill = false;
+	this->shaded = false;
+	this->drawOnTop = false;
+	this->cull = true;
+
+	this->wireColor = MColor();
+	this->useElementColors = true;
+	this->depthPriority = 0;
+
+	this->numVisible = 0;
+
+};
+
+
+PointHelperArrayData::~PointHelperArrayData() {};
+
+
+void PointHelperArrayData::clearBatch()
+/**
+Empties the batch while keeping its capacity, so a steady number of visible instances does not reallocate.
+
+@return: void
+*/
+{
+
+	this->batch.triangles.clear();
+	this->batch.normals.clear();
+	this->batch.lines.clear();
+	this->ranges.clear();
+
+	this->numVisible = 0;
+
+};
+
+
+size_t PointHelperArrayData::memoryUsage() const
+/**
+Returns the bytes held by the inputs and the batched buffers.
+
+@return: size_t
+*/
+{
+
+	size_t bytes = sizeof(PointHelperArrayData);
+
+	bytes += this->matrices.length() * sizeof(MMatrix);
+	bytes += Drawable::sizeOf(this->colors) + Drawable::sizeOf(this->shapeMasks);
+
+	bytes += this->batch.triangles.capacity() * sizeof(Drawable::Core::PointD);
+	bytes += this->batch.normals.capacity() * sizeof(Drawable::Core::VectorD);
+	bytes += this->batch.lines.capacity() * sizeof(Drawable::Core::PointD);
+	bytes += this->ranges.capacity() * sizeof(PointHelperArrayRange);
+
+	bytes += Drawable::sizeOf(this->triangles) + Drawable::sizeOf(this->normals) + Drawable::sizeOf(this->lines);
+	bytes += (this->triangleColors.length() + this->lineColors.length()) * sizeof(MColor);
+
+	return bytes;
+
+};
@@ -0,0 +1,75 @@
+#ifndef _POINT_HELPER_ARRAY_DATA
+#define _POINT_HELPER_ARRAY_DATA
+//
+// File: PointHelperArrayData.h
+//
+// Author: Ben Singleton
+//
+
+#include "Drawable.h"
+#include "MemoryUsage.h"
+
+#include <maya/MUserData.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MVectorArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MPointArray.h>
+#include <maya/MColor.h>
+#include <maya/MColorArray.h>
+
+#include <vector>
+
+
+struct PointHelperArrayRange
+/**
+The end of an instance's vertices inside the batched triangle and line lists, used to expand per instance colors.
+*/
+{
+
+	size_t			triangleEnd;
+	size_t			lineEnd;
+	MColor			color;
+
+};
+
+
+class PointHelperArrayData : public MUserData 
+{
+
+public:
+
+							PointHelperArrayData();
+	virtual					~PointHelperArrayData();
+
+	virtual	void			clearBatch();
+	virtual	size_t			memoryUsage() const;
+
+public:
+
+			MMatrixArray	matrices;
+			MVectorArray	colors;
+			MIntArray		shapeMasks;
+			int				shapeFlags;
+			double			size;
+			float			lineWidth;
+			bool			fill;
+			bool			shaded;
+			bool			drawOnTop;
+			bool			cull;
+
+			MColor			wireColor;
+			bool			useElementColors;
+			unsigned int	depthPriority;
+
+			Drawable::Core::MeshBuffers			batch;
+			std::vector<PointHelperArrayRange>	ranges;
+			unsigned int						numVisible;
+
+			MPointArray		triangles;
+			MVectorArray	normals;
+			MColorArray		triangleColors;
+			MPointArray		lines;
+			MColorArray		lineColors;
+
+};
+#endif
@@ -0,0 +1,502 @@
+//
+// File: PointHelperArrayDrawOverride.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperArrayDrawOverride.h"
+#include "UIDrawManager.h"
+#include "CaptureDrawManager.h"
+#include "PointHelperData.h"
+#include "AbstractDrawable.h"
+
+#include <algorithm>
+#include <memory>
+
+
+bool							PointHelperArrayDrawOverride::SHAPES_CAPTURED = false;
+Drawable::Core::MeshBuffers		PointHelperArrayDrawOverride::SHAPES[Drawable::NUM_SHAPES];
+double							PointHelperArrayDrawOverride::RADII[Drawable::NUM_SHAPES];
+
+
+PointHelperArrayDrawOverride::PointHelperArrayDrawOverride(const MObject& node) : MPxDrawOverride(node, NULL, true)
+/**
+Constructor.
+The override is always dirty since culling depends on the camera, prepareForDraw() skips the rebuild when nothing it depends on has changed.
+
+@param node: The Maya object this override draws.
+*/
+{
+
+	MStatus status;
+
+	// Store pointer to MPxLocator
+	//
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS(status);
+
+	this->pointHelperArray = status ? dynamic_cast<PointHelperArray*>(fnNode.userNode()) : nullptr;
+
+	// Capture the shared shapes
+	//
+	PointHelperArrayDrawOverride::captureShapes();
+
+};
+
+
+PointHelperArrayDrawOverride::~PointHelperArrayDrawOverride()
+/**
+Destructor.
+*/
+{
+
+	this->pointHelperArray = NULL;
+
+};
+
+
+MHWRender::MPxDrawOverride* PointHelperArrayDrawOverride::creator(const MObject& node)
+/**
+Static function used to create a new draw override instance.
+This function is called via the MDrawRegistry::registerDrawOverrideCreator() method.
+
+@param node: The Maya object this override draws. 
+@return: MPxDrawOverride*
+*/
+{
+
+	return new PointHelperArrayDrawOverride(node);
+
+};
+
+
+void PointHelperArrayDrawOverride::captureShapes()
+/**
+Captures every drawable's geometry at unit size in object space.
+The drawables are prepared and drawn into a capture draw manager once, so each element is drawn with exactly the same geometry as a point helper.
+Shapes without world space geometry, the center marker, an empty custom shape and the tripod labels, capture nothing.
+
+@return: void
+*/
+{
+
+	if (PointHelperArrayDrawOverride::SHAPES_CAPTURED)
+	{
+
+		return;
+
+	}
+
+	PointHelperData pointHelperData;
+	pointHelperData.size = 1.0;
+	pointHelperData.objectMatrix = MMatrix::identity;
+	pointHelperData.fill = true;
+	pointHelperData.shaded = true;
+
+	Drawable::CaptureDrawManager captureDrawManager;
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		std::unique_ptr<Drawable::AbstractDrawable> drawable(Drawable::AbstractDrawable::create(static_cast<Drawable::Shape>(i)));
+
+		if (drawable == nullptr)
+		{
+
+			continue;
+
+		}
+
+		captureDrawManager.reset();
+
+		drawable->setObjectMatrix(pointHelperData.objectMatrix);
+		drawable->prepareForDraw(MDagPath(), MDagPath(), &pointHelperData);
+		drawable->draw(captureDrawManager, &pointHelperData);
+
+		PointHelperArrayDrawOverride::SHAPES[i] = captureDrawManager.buffers();
+
+		// Store the bounding radius used for culling
+		//
+		double radius = 0.0;
+
+		for (const Drawable::Core::PointD& point : PointHelperArrayDrawOverride::SHAPES[i].lines)
+		{
+
+			radius = std::max(radius, Drawable::Core::VectorD(point.x, point.y, point.z).length());
+
+		}
+
+		for (const Drawable::Core::PointD& point : PointHelperArrayDrawOverride::SHAPES[i].triangles)
+		{
+
+			radius = std::max(radius, Drawable::Core::VectorD(point.x, point.y, point.z).length());
+
+		}
+
+		PointHelperArrayDrawOverride::RADII[i] = radius;
+
+	}
+
+	PointHelperArrayDrawOverride::SHAPES_CAPTURED = true;
+
+};
+
+
+double PointHelperArrayDrawOverride::shapeRadius(unsigned int mask)
+/**
+Returns the radius of a sphere that encloses every shape enabled by the supplied mask at unit size.
+
+@param mask: The shape mask, bit n enables Drawable::Shape n.
+@return: double
+*/
+{
+
+	double radius = 0.0;
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		if ((mask & (1u << i)) != 0)
+		{
+
+			radius = std::max(radius, PointHelperArrayDrawOverride::RADII[i]);
+
+		}
+
+	}
+
+	return radius;
+
+};
+
+
+MHWRender::DrawAPI PointHelperArrayDrawOverride::supportedDrawAPIs() const
+/**
+Returns the draw API supported by this override.
+
+@return: MHWRender::DrawAPI
+*/
+{
+
+	return (MHWRender::kOpenGL | MHWRender::kDirectX11 | MHWRender::kOpenGLCoreProfile);
+
+};
+
+
+bool PointHelperArrayDrawOverride::isBounded(const MDagPath& objPath, const MDagPath& cameraPath) const
+/**
+Called by Maya to determine if the drawable object is bounded or not.
+
+@param objPath: The path to the object being drawn.
+@param cameraPath: The path to the camera that is being used to draw.
+@return: bool
+*/
+{
+
+	return this->pointHelperArray->isBounded();
+
+};
+
+
+MBoundingBox PointHelperArrayDrawOverride::boundingBox(const MDagPath& objPath, const MDagPath& cameraPath) const
+/**
+Called by Maya whenever the bounding box of the drawable object is needed.
+
+@param objPath: The path to the object being drawn.
+@param cameraPath: The path to the camera that is being used to draw.
+@return: MBoundingBox
+*/
+{
+
+	return this->pointHelperArray->boundingBox();
+
+};
+
+
+bool PointHelperArrayDrawOverride::hasUIDrawables() const
+/**
+In order for any override for the addUIDrawables() method to be called this method must also be overridden to return true.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+MUserData* PointHelperArrayDrawOverride::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, MUserData* userData)
+/**
+Called by Maya whenever the object needs to update for draw.
+Inputs are only copied when they changed and the batch is only rebuilt when the inputs, the wire color or, with culling enabled, the view changed.
+
+@param objPath: The path to the object being drawn.
+@param cameraPath: The path to the camera that is being used to draw.
+@param frameContext: Frame level context information.
+@param userData: Data cached by the previous draw of the instance.
+@return: MUserData
+*/
+{
+
+	MStatus status;
+
+	// Check if an instance of PointHelperArrayData exists
+	//
+	PointHelperArrayData* data = dynamic_cast<PointHelperArrayData*>(userData);
+	bool isDirty = (data == nullptr);
+
+	if (data == nullptr)
+	{
+
+		data = new PointHelperArrayData();
+
+	}
+
+	// Copy internal values
+	//
+	if (isDirty || this->pointHelperArray->isInputDirty())
+	{
+
+		this->pointHelperArray->clearInputDirty();
+		this->pointHelperArray->copyInternalData(data);
+
+		isDirty = true;
+
+	}
+
+	// Per element colors are replaced by the wire color while the node is highlighted
+	//
+	MColor wireColor = MHWRender::MGeometryUtilities::wireframeColor(objPath);
+	MHWRender::DisplayStatus displayStatus = MHWRender::MGeometryUtilities::displayStatus(objPath);
+	bool useElementColors = (displayStatus == MHWRender::kDormant);
+
+	isDirty |= (wireColor != data->wireColor) || (useElementColors != data->useElementColors);
+
+	data->wireColor = wireColor;
+	data->useElementColors = useElementColors;
+	data->depthPriority = (displayStatus == MHWRender::kActiveComponent) ? MHWRender::MRenderItem::sActiveWireDepthPriority : MHWRender::MRenderItem::sDormantFilledDepthPriority;
+
+	// Rebuild the batch
+	//
+	if (isDirty || data->cull)
+	{
+
+		MMatrix viewProjection = frameContext.getMatrix(MHWRender::MFrameContext::kViewProjMtx, &status);
+		CHECK_MSTATUS(status);
+
+		this->batchUserData(data, objPath.inclusiveMatrix() * viewProjection);
+
+	}
+
+	return data;
+
+};
+
+
+void PointHelperArrayDrawOverride::batchUserData(PointHelperArrayData* data, const MMatrix& viewProjection)
+/**
+Culls the elements against the view and appends every visible element's shapes into one batch.
+The batch keeps its capacity between calls so steady-state frames do not allocate core buffers.
+
+@param data: The data to batch.
+@param viewProjection: The object to clip space matrix used for culling.
+@return: void
+*/
+{
+
+	data->clearBatch();
+
+	Drawable::Core::Plane planes[6];
+	Drawable::Core::frustumPlanes(Drawable::toCore(viewProjection), planes);
+
+	const Drawable::Core::Matrix sizeMatrix = Drawable::Core::createScaleMatrix(data->size, data->size, data->size);
+
+	const unsigned int numElements = data->matrices.length();
+	const unsigned int numMasks = data->shapeMasks.length();
+	const unsigned int numColors = data->colors.length();
+
+	for (unsigned int i = 0; i < numElements; i++)
+	{
+
+		// Check if element has any shapes
+		//
+		const unsigned int mask = static_cast<unsigned int>((i < numMasks) ? data->shapeMasks[i] : data->shapeFlags);
+
+		if (mask == 0)
+		{
+
+			continue;
+
+		}
+
+		const Drawable::Core::Matrix matrix = sizeMatrix * Drawable::toCore(data->matrices[i]);
+
+		// Check if element is inside the frustum
+		//
+		if (data->cull)
+		{
+
+			const Drawable::Core::PointD center(matrix(3, 0), matrix(3, 1), matrix(3, 2));
+			const double radius = Drawable::Core::boundingRadius(matrix, PointHelperArrayDrawOverride::shapeRadius(mask));
+
+			if (!Drawable::Core::isSphereVisible(planes, center, radius))
+			{
+
+				continue;
+
+			}
+
+		}
+
+		// Append enabled shapes
+		//
+		for (unsigned int j = 0; j < Drawable::NUM_SHAPES; j++)
+		{
+
+			if ((mask & (1u << j)) != 0)
+			{
+
+				Drawable::Core::appendInstance(matrix, PointHelperArrayDrawOverride::SHAPES[j], data->fill, data->batch);
+
+			}
+
+		}
+
+		MColor color = data->wireColor;
+
+		if (data->useElementColors && i < numColors)
+		{
+
+			const MVector& elementColor = data->colors[i];
+			color = MColor(static_cast<float>(elementColor.x), static_cast<float>(elementColor.y), static_cast<float>(elementColor.z));
+
+		}
+
+		data->ranges.push_back(PointHelperArrayRange{ data->batch.triangles.size(), data->batch.lines.size(), color });
+		data->numVisible++;
+
+	}
+
+	// Convert the batch for submission
+	//
+	Drawable::fromCore(data->batch.triangles, data->triangles);
+	Drawable::fromCore(data->batch.normals, data->normals);
+	Drawable::fromCore(data->batch.lines, data->lines);
+
+	data->triangleColors.setLength(data->triangles.length());
+	data->lineColors.setLength(data->lines.length());
+
+	size_t triangleStart = 0, lineStart = 0;
+
+	for (const PointHelperArrayRange& range : data->ranges)
+	{
+
+		for (size_t i = triangleStart; i < range.triangleEnd; i++)
+		{
+
+			data->triangleColors[static_cast<unsigned int>(i)] = range.color;
+
+		}
+
+		for (size_t i = lineStart; i < range.lineEnd; i++)
+		{
+
+			data->lineColors[static_cast<unsigned int>(i)] = range.color;
+
+		}
+
+		triangleStart = range.triangleEnd;
+		lineStart = range.lineEnd;
+
+	}
+
+};
+
+
+void PointHelperArrayDrawOverride::addUIDrawables(const MDagPath& objPath, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const MUserData* userData)
+/**
+Provides access to the MUIDrawManager, which can be used to queue up operations to draw simple UI shapes like lines, circles, text, etc.
+
+@param objPath: The path to the object being drawn.
+@param drawManager: The UI draw manager, it can be used to draw some simple geometry including text.
+@param frameContext: Frame level context information.
+@param userData: Data cached by prepareForDraw().
+@return: void
+*/
+{
+
+	Drawable::UIDrawManager uiDrawManager(drawManager);
+	this->drawUserData(uiDrawManager, userData);
+
+};
+
+
+void PointHelperArrayDrawOverride::drawUserData(Drawable::AbstractDrawManager& drawManager, const MUserData* userData)
+/**
+Submits the batch as a single drawable with at most one triangle mesh and one line mesh.
+
+@param drawManager: The draw manager to submit to.
+@param userData: Data cached by prepareForDraw().
+@return: void
+*/
+{
+
+	// Retrieve the cached data from the prepareForDraw() method
+	//
+	const PointHelperArrayData* data = dynamic_cast<const PointHelperArrayData*>(userData);
+
+	if (data == nullptr || data->numVisible == 0) 
+	{
+
+		return;
+
+	}
+
+	// Begin drawable
+	//
+	drawManager.beginDrawable();
+
+	drawManager.setColor(data->wireColor);
+	drawManager.setDepthPriority(data->depthPriority);
+	drawManager.setLineWidth(data->lineWidth);
+	drawManager.setLineStyle(MHWRender::MUIDrawManager::kSolid);
+
+	if (data->drawOnTop) 
+	{
+
+		drawManager.beginDrawInXray();
+
+	}
+
+	// Draw mesh
+	//
+	if (data->fill && data->triangles.length() > 0) 
+	{
+
+		drawManager.setPaintStyle(data->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, data->triangles, &data->normals, &data->triangleColors);
+
+	}
+
+	// Draw lines
+	//
+	if (data->lines.length() > 0)
+	{
+
+		drawManager.mesh(MHWRender::MUIDrawManager::kLines, data->lines, nullptr, &data->lineColors);
+
+	}
+
+	if (data->drawOnTop) 
+	{
+
+		drawManager.endDrawInXray();
+
+	}
+
+	// End drawable
+	//
+	drawManager.endDrawable();
+
+};
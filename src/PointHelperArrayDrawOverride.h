@@ -0,0 +1,60 @@
+#ifndef _POINT_HELPER_ARRAY_DRAW_OVERRIDE
+#define _POINT_HELPER_ARRAY_DRAW_OVERRIDE
+//
+// File: PointHelperArrayDrawOverride.h
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperArrayNode.h"
+#include "PointHelperArrayData.h"
+#include "AbstractDrawManager.h"
+
+#include <maya/MPxDrawOverride.h>
+#include <maya/MObject.h>
+#include <maya/MDagPath.h>
+#include <maya/MFnDependencyNode.h>
+
+#include <maya/MViewport2Renderer.h>
+#include <maya/MUIDrawManager.h>
+#include <maya/MFrameContext.h>
+#include <maya/MHWGeometry.h>
+#include <maya/MHWGeometryUtilities.h>
+
+
+class PointHelperArrayDrawOverride : public MHWRender::MPxDrawOverride 
+{
+
+public:
+
+								PointHelperArrayDrawOverride(const MObject& node);
+	virtual						~PointHelperArrayDrawOverride();
+
+	static	MPxDrawOverride*	creator(const MObject& node);
+
+	virtual	MHWRender::DrawAPI	supportedDrawAPIs() const;
+
+	virtual bool				isBounded(const MDagPath& objPath, const MDagPath& cameraPath) const;
+	virtual	MBoundingBox		boundingBox(const MDagPath& objPath, const MDagPath& cameraPath) const;
+
+	virtual MUserData*			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, MUserData* userData);
+
+	virtual bool				hasUIDrawables() const;
+	virtual void				addUIDrawables(const MDagPath& objPath, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const MUserData* userData);
+
+			void				batchUserData(PointHelperArrayData* data, const MMatrix& viewProjection);
+			void				drawUserData(Drawable::AbstractDrawManager& drawManager, const MUserData* userData);
+
+	static	void				captureShapes();
+	static	double				shapeRadius(unsigned int mask);
+
+private:
+
+			PointHelperArray*	pointHelperArray;
+
+	static	bool						SHAPES_CAPTURED;
+	static	Drawable::Core::MeshBuffers	SHAPES[Drawable::NUM_SHAPES];
+	static	double						RADII[Drawable::NUM_SHAPES];
+
+};
+#endif
@@ -0,0 +1,476 @@
+//
+// File: PointHelperArrayNode.cpp
+//
+// Dependency Graph Node: pointHelperArray
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperArrayNode.h"
+#include "PointHelperArrayDrawOverride.h"
+
+MObject	PointHelperArray::matrices;
+MObject	PointHelperArray::colors;
+MObject	PointHelperArray::shapeMasks;
+MObject	PointHelperArray::shapeFlags;
+MObject	PointHelperArray::size;
+MObject	PointHelperArray::lineWidth;
+MObject	PointHelperArray::fill;
+MObject	PointHelperArray::shaded;
+MObject	PointHelperArray::drawOnTop;
+MObject	PointHelperArray::cull;
+
+MString	PointHelperArray::drawableCategory("Drawable");
+MString	PointHelperArray::renderCategory("Render");
+
+MString	PointHelperArray::drawDbClassification("drawdb/geometry/PointHelperArray");
+MString	PointHelperArray::drawRegistrantId("PointHelperArrayPlugin");
+MTypeId PointHelperArray::id(0x0013b1c1);
+
+
+PointHelperArray::PointHelperArray() : MPxLocatorNode() 
+/**
+Constructor.
+*/
+{
+
+	this->inputDirty = true;
+	this->boundsDirty = true;
+
+};
+
+
+PointHelperArray::~PointHelperArray() {};
+
+
+MStatus PointHelperArray::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Any input change is recorded so the draw override can skip rebuilding the batch when only the camera moved, and the bounds are only computed again after a change.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	this->inputDirty = true;
+
+	std::lock_guard<std::mutex> lock(this->boundsMutex);
+	this->boundsDirty = true;
+
+	return MPxLocatorNode::setDependentsDirty(plug, plugArray);
+
+};
+
+
+MStatus PointHelperArray::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
+/**
+Prepare a node's internal state for threaded evaluation.
+Animated inputs do not go through setDependentsDirty() under the evaluation manager so they are recorded here instead.
+
+@param context: Context in which the evaluation is happening. This should be respected and only internal state information pertaining to it should be modified.
+@param evaluationNode: Evaluation node which contains information about the dirty plugs that are about to be evaluated for the context. Should be only used to query information.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	if (context.isNormal())
+	{
+
+		const MObject inputs[] = { PointHelperArray::matrices, PointHelperArray::colors, PointHelperArray::shapeMasks, PointHelperArray::shapeFlags, PointHelperArray::size };
+
+		for (const MObject& input : inputs)
+		{
+
+			if (evaluationNode.dirtyPlugExists(input, &status) && status)
+			{
+
+				this->inputDirty = true;
+
+				std::lock_guard<std::mutex> lock(this->boundsMutex);
+				this->boundsDirty = true;
+
+				break;
+
+			}
+
+		}
+
+	}
+
+	return MPxLocatorNode::preEvaluation(context, evaluationNode);
+
+};
+
+
+bool PointHelperArray::isInputDirty() const
+/**
+Evaluates if any input has changed since the draw override last copied them.
+
+@return: bool
+*/
+{
+
+	return this->inputDirty.load();
+
+};
+
+
+void PointHelperArray::clearInputDirty()
+/**
+Marks the inputs as copied.
+
+@return: void
+*/
+{
+
+	this->inputDirty = false;
+
+};
+
+
+void PointHelperArray::copyInternalData(PointHelperArrayData* data)
+/**
+Copies the data from this node to the supplied data object.
+
+@param node: The data to copy to
+@return: Void.
+*/
+{
+
+	MObject node = this->thisMObject();
+
+	PointHelperArray::getMatrixArrayData(MPlug(node, PointHelperArray::matrices), data->matrices);
+	PointHelperArray::getVectorArrayData(MPlug(node, PointHelperArray::colors), data->colors);
+	PointHelperArray::getIntArrayData(MPlug(node, PointHelperArray::shapeMasks), data->shapeMasks);
+
+	data->shapeFlags = MPlug(node, PointHelperArray::shapeFlags).asInt();
+	data->size = MPlug(node, PointHelperArray::size).asDouble();
+	data->lineWidth = MPlug(node, PointHelperArray::lineWidth).asFloat();
+	data->fill = MPlug(node, PointHelperArray::fill).asBool();
+	data->shaded = MPlug(node, PointHelperArray::shaded).asBool();
+	data->drawOnTop = MPlug(node, PointHelperArray::drawOnTop).asBool();
+	data->cull = MPlug(node, PointHelperArray::cull).asBool();
+
+	// Compute the bounds from the copied inputs, unless boundingBox() already did since they changed
+	//
+	std::lock_guard<std::mutex> lock(this->boundsMutex);
+
+	if (this->boundsDirty)
+	{
+
+		this->bounds = PointHelperArray::elementBounds(data->matrices, data->shapeMasks, data->shapeFlags, data->size);
+		this->boundsDirty = false;
+
+	}
+
+};
+
+
+void PointHelperArray::getMatrixArrayData(const MPlug& plug, MMatrixArray& matrices)
+/**
+Copies the matrix array from the supplied plug.
+
+@param plug: The plug to access.
+@param matrices: The passed array to populate.
+@return: void
+*/
+{
+
+	MStatus status;
+
+	MFnMatrixArrayData fnMatrixArrayData(plug.asMObject(), &status);
+
+	if (!status)
+	{
+
+		matrices.clear();
+		return;
+
+	}
+
+	status = fnMatrixArrayData.copyTo(matrices);
+	CHECK_MSTATUS(status);
+
+};
+
+
+void PointHelperArray::getVectorArrayData(const MPlug& plug, MVectorArray& vectors)
+/**
+Copies the vector array from the supplied plug.
+
+@param plug: The plug to access.
+@param vectors: The passed array to populate.
+@return: void
+*/
+{
+
+	MStatus status;
+
+	MFnVectorArrayData fnVectorArrayData(plug.asMObject(), &status);
+
+	if (!status)
+	{
+
+		vectors.clear();
+		return;
+
+	}
+
+	status = fnVectorArrayData.copyTo(vectors);
+	CHECK_MSTATUS(status);
+
+};
+
+
+void PointHelperArray::getIntArrayData(const MPlug& plug, MIntArray& values)
+/**
+Copies the int array from the supplied plug.
+
+@param plug: The plug to access.
+@param values: The passed array to populate.
+@return: void
+*/
+{
+
+	MStatus status;
+
+	MFnIntArrayData fnIntArrayData(plug.asMObject(), &status);
+
+	if (!status)
+	{
+
+		values.clear();
+		return;
+
+	}
+
+	status = fnIntArrayData.copyTo(values);
+	CHECK_MSTATUS(status);
+
+};
+
+
+bool PointHelperArray::isBounded() const
+/**
+This function indicates if the bounding method will be overrided by the user.
+Supplying a bounding box will make selection calculation more efficient!
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+MBoundingBox PointHelperArray::boundingBox() const
+/**
+This function is used to calculate a bounding box that encloses every element.
+The bounds are computed when the draw override copies the inputs and kept until they change, they are only read from the plugs here if they are asked for first.
+
+@return: MBoundingBox
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->boundsMutex);
+
+	if (this->boundsDirty)
+	{
+
+		MObject node = this->thisMObject();
+
+		MMatrixArray matrices;
+		MIntArray shapeMasks;
+
+		PointHelperArray::getMatrixArrayData(MPlug(node, PointHelperArray::matrices), matrices);
+		PointHelperArray::getIntArrayData(MPlug(node, PointHelperArray::shapeMasks), shapeMasks);
+
+		this->bounds = PointHelperArray::elementBounds(matrices, shapeMasks, MPlug(node, PointHelperArray::shapeFlags).asInt(), MPlug(node, PointHelperArray::size).asDouble());
+		this->boundsDirty = false;
+
+	}
+
+	return this->bounds;
+
+};
+
+
+MBoundingBox PointHelperArray::elementBounds(const MMatrixArray& matrices, const MIntArray& shapeMasks, int shapeFlags, double size)
+/**
+Returns a bounding box that encloses every element with any shapes.
+Each element contributes the same bounding sphere the draw override culls it with, sized by the radius of its enabled shapes.
+
+@param matrices: The element matrices.
+@param shapeMasks: The per element shape masks, elements past the end use the shape flags.
+@param shapeFlags: The shape mask of elements without their own.
+@param size: The size of every element.
+@return: MBoundingBox
+*/
+{
+
+	PointHelperArrayDrawOverride::captureShapes();
+
+	const Drawable::Core::Matrix sizeMatrix = Drawable::Core::createScaleMatrix(size, size, size);
+	const unsigned int numElements = matrices.length();
+	const unsigned int numMasks = shapeMasks.length();
+
+	MBoundingBox boundingBox;
+	bool isEmpty = true;
+
+	for (unsigned int i = 0; i < numElements; i++)
+	{
+
+		const unsigned int mask = static_cast<unsigned int>((i < numMasks) ? shapeMasks[i] : shapeFlags);
+
+		if (mask == 0)
+		{
+
+			continue;
+
+		}
+
+		const Drawable::Core::Matrix matrix = sizeMatrix * Drawable::toCore(matrices[i]);
+		const double radius = Drawable::Core::boundingRadius(matrix, PointHelperArrayDrawOverride::shapeRadius(mask));
+
+		boundingBox.expand(MPoint(matrix(3, 0) - radius, matrix(3, 1) - radius, matrix(3, 2) - radius));
+		boundingBox.expand(MPoint(matrix(3, 0) + radius, matrix(3, 1) + radius, matrix(3, 2) + radius));
+
+		isEmpty = false;
+
+	}
+
+	return isEmpty ? MBoundingBox(MPoint(-size, -size, -size), MPoint(size, size, size)) : boundingBox;
+
+};
+
+
+void* PointHelperArray::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperArray
+*/
+{
+
+	return new PointHelperArray();
+
+};
+
+
+MStatus PointHelperArray::initialize()
+/**
+This function is called by Maya after a plugin has been loaded.
+Use this function to define any static attributes.
+
+@return: MStatus
+*/
+{
+
+	MStatus status;
+
+	// Declare attribute function sets
+	//
+	MFnNumericAttribute fnNumericAttr;
+	MFnTypedAttribute fnTypedAttr;
+
+	// Input attributes:
+	// Initialize `matrices` attribute
+	//
+	PointHelperArray::matrices = fnTypedAttr.create("matrices", "mats", MFnData::kMatrixArray, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelperArray::drawableCategory));
+
+	// Initialize `colors` attribute
+	//
+	PointHelperArray::colors = fnTypedAttr.create("colors", "cls", MFnData::kVectorArray, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelperArray::drawableCategory));
+
+	// Initialize `shapeMasks` attribute
+	//
+	PointHelperArray::shapeMasks = fnTypedAttr.create("shapeMasks", "shm", MFnData::kIntArray, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelperArray::drawableCategory));
+
+	// Initialize `shapeFlags` attribute
+	// Bit n enables Drawable::Shape n for every element without a mask
+	//
+	const int defaultShapeFlags = (1 << static_cast<int>(Drawable::Shape::Box)) | (1 << static_cast<int>(Drawable::Shape::Cross));
+
+	PointHelperArray::shapeFlags = fnNumericAttr.create("shapeFlags", "shf", MFnNumericData::kInt, defaultShapeFlags, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setMin(0));
+	CHECK_MSTATUS(fnNumericAttr.setMax((1 << Drawable::NUM_SHAPES) - 1));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::drawableCategory));
+
+	// Initialize `size` attribute
+	//
+	PointHelperArray::size = fnNumericAttr.create("size", "size", MFnNumericData::kDouble, 10.0, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setChannelBox(true));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::renderCategory));
+
+	// Initialize `lineWidth` attribute
+	//
+	PointHelperArray::lineWidth = fnNumericAttr.create("lineWidth", "lw", MFnNumericData::kFloat, 1.0f, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setMin(0.0));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::renderCategory));
+
+	// Initialize `fill` attribute
+	//
+	PointHelperArray::fill = fnNumericAttr.create("fill", "fill", MFnNumericData::kBoolean, false, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::renderCategory));
+
+	// Initialize `shaded` attribute
+	//
+	PointHelperArray::shaded = fnNumericAttr.create("shaded", "shaded", MFnNumericData::kBoolean, false, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::renderCategory));
+
+	// Initialize `drawOnTop` attribute
+	//
+	PointHelperArray::drawOnTop = fnNumericAttr.create("drawOnTop", "drawOnTop", MFnNumericData::kBoolean, false, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::renderCategory));
+
+	// Initialize `cull` attribute
+	// Culling rebuilds the batch whenever the camera moves, disable it for static views of very large arrays
+	//
+	PointHelperArray::cull = fnNumericAttr.create("cull", "cull", MFnNumericData::kBoolean, true, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelperArray::renderCategory));
+
+	// Add attributes
+	//
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::matrices));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::colors));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::shapeMasks));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::shapeFlags));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::size));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::lineWidth));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::fill));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::shaded));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::drawOnTop));
+	CHECK_MSTATUS(PointHelperArray::addAttribute(PointHelperArray::cull));
+
+	return MS::kSuccess;
+
+};
@@ -0,0 +1,104 @@
+#ifndef _POINT_HELPER_ARRAY_NODE
+#define _POINT_HELPER_ARRAY_NODE
+//
+// File: PointHelperArrayNode.h
+//
+// Dependency Graph Node: pointHelperArray
+//
+// Author: Ben Singleton
+//
+
+#include "Drawable.h"
+#include "PointHelperArrayData.h"
+
+#include <maya/MPxLocatorNode.h>
+#include <maya/MObject.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MDataBlock.h>
+#include <maya/MDagPath.h>
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MVectorArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MBoundingBox.h>
+#include <maya/MString.h>
+#include <maya/MTypeId.h>
+
+#include <maya/MFnNumericAttribute.h>
+#include <maya/MFnNumericData.h>
+#include <maya/MFnTypedAttribute.h>
+#include <maya/MFnData.h>
+#include <maya/MFnMatrixArrayData.h>
+#include <maya/MFnVectorArrayData.h>
+#include <maya/MFnIntArrayData.h>
+
+#include <maya/MEvaluationNode.h>
+#include <maya/MViewport2Renderer.h>
+#include <maya/MDGContext.h>
+#include <maya/M3dView.h>
+
+#include <atomic>
+#include <mutex>
+
+
+class PointHelperArray : public MPxLocatorNode 
+{
+
+public:
+
+								PointHelperArray();
+	virtual						~PointHelperArray();
+
+	virtual	void				draw(M3dView& view, const MDagPath& dagPath, M3dView::DisplayStyle displayStyle, M3dView::DisplayStatus displayStatus) {};
+
+	virtual	MStatus				setDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
+	virtual	MStatus				preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode);
+
+	virtual	void				copyInternalData(PointHelperArrayData* data);
+	static	void				getMatrixArrayData(const MPlug& plug, MMatrixArray& matrices);
+	static	void				getVectorArrayData(const MPlug& plug, MVectorArray& vectors);
+	static	void				getIntArrayData(const MPlug& plug, MIntArray& values);
+
+	virtual	bool				isInputDirty() const;
+	virtual	void				clearInputDirty();
+
+	virtual	bool				isBounded() const;
+	virtual	MBoundingBox		boundingBox() const;
+	static	MBoundingBox		elementBounds(const MMatrixArray& matrices, const MIntArray& shapeMasks, int shapeFlags, double size);
+
+	static  void*				creator();
+	static  MStatus				initialize();
+
+public:
+
+	static	MObject				matrices;
+	static	MObject				colors;
+	static	MObject				shapeMasks;
+	static	MObject				shapeFlags;
+	static	MObject				size;
+	static	MObject				lineWidth;
+	static	MObject				fill;
+	static	MObject				shaded;
+	static	MObject				drawOnTop;
+	static	MObject				cull;
+
+	static	MString				drawableCategory;
+	static	MString				renderCategory;
+
+	static	MString				drawDbClassification;
+	static	MString				drawRegistrantId;
+	static	MTypeId				id;
+
+protected:
+
+			std::atomic<bool>	inputDirty;
+
+	mutable	std::mutex			boundsMutex;
+	mutable	bool				boundsDirty;
+	mutable	MBoundingBox		bounds;
+
+};
+
+
+#endif
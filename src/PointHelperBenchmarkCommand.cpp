@@ -0,0 +1,450 @@
+//
+// File: PointHelperBenchmarkCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperBenchmarkCommand.h"
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+
+const MString	PointHelperBenchmarkCommand::commandName("pointHelperBenchmark");
+
+const char*		PointHelperBenchmarkCommand::countFlag = "-c";
+const char*		PointHelperBenchmarkCommand::countLongFlag = "-count";
+const char*		PointHelperBenchmarkCommand::iterationsFlag = "-i";
+const char*		PointHelperBenchmarkCommand::iterationsLongFlag = "-iterations";
+const char*		PointHelperBenchmarkCommand::logFlag = "-l";
+const char*		PointHelperBenchmarkCommand::logLongFlag = "-log";
+const char*		PointHelperBenchmarkCommand::animateFlag = "-a";
+const char*		PointHelperBenchmarkCommand::animateLongFlag = "-animate";
+
+
+PointHelperBenchmarkCommand::PointHelperBenchmarkCommand() : MPxCommand() {};
+PointHelperBenchmarkCommand::~PointHelperBenchmarkCommand() {};
+
+
+MStatus PointHelperBenchmarkCommand::doIt(const MArgList& args)
+/**
+Drives the draw override's prepare and draw path for a set of helpers without a viewport.
+Draw calls are sent to a recording draw manager so the command also works in batch mode on machines without a GPU.
+The result is a JSON string containing timings, per-frame call counts and vertex counts.
+When allocation counting is compiled in, the command fails if the prepares allocate once warmed up.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	int count = 0;
+
+	if (argDatabase.isFlagSet(PointHelperBenchmarkCommand::countFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperBenchmarkCommand::countFlag, 0, count);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	int iterations = 10;
+
+	if (argDatabase.isFlagSet(PointHelperBenchmarkCommand::iterationsFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperBenchmarkCommand::iterationsFlag, 0, iterations);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	bool includeLog = argDatabase.isFlagSet(PointHelperBenchmarkCommand::logFlag);
+	bool animate = argDatabase.isFlagSet(PointHelperBenchmarkCommand::animateFlag);
+
+	// Collect helpers
+	//
+	MDagModifier dagModifier;
+	MDagPathArray dagPaths;
+
+	status = (count > 0) ? PointHelperBenchmarkCommand::createHelpers(count, dagModifier, dagPaths) : PointHelperBenchmarkCommand::collectHelpers(dagPaths);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	unsigned int numHelpers = dagPaths.length();
+
+	// Create a draw override and user data per helper
+	//
+	std::vector<std::unique_ptr<PointHelperDrawOverride>> drawOverrides(numHelpers);
+	std::vector<std::unique_ptr<MUserData>> userData(numHelpers);
+
+	for (unsigned int i = 0; i < numHelpers; i++)
+	{
+
+		drawOverrides[i].reset(new PointHelperDrawOverride(dagPaths[i].node()));
+		userData[i].reset(drawOverrides[i]->prepareUserData(dagPaths[i], MDagPath(), nullptr));
+
+	}
+
+	// Record a single frame so the log only holds one frame worth of calls
+	//
+	Drawable::RecordingDrawManager drawManager;
+
+	for (unsigned int i = 0; i < numHelpers; i++)
+	{
+
+		drawOverrides[i]->drawUserData(drawManager, userData[i].get());
+
+	}
+
+	std::vector<Drawable::DrawRecord> log = drawManager.log();
+	std::vector<uint64_t> callCounts(static_cast<size_t>(Drawable::DrawCall::Count));
+
+	for (size_t i = 0; i < callCounts.size(); i++)
+	{
+
+		callCounts[i] = drawManager.callCount(static_cast<Drawable::DrawCall>(i));
+
+	}
+
+	uint64_t vertexCount = drawManager.vertexCount();
+
+	// Store sizes so animated helpers can be restored
+	//
+	std::vector<double> sizes(animate ? numHelpers : 0);
+
+	for (unsigned int i = 0; i < sizes.size(); i++)
+	{
+
+		sizes[i] = MPlug(dagPaths[i].node(), PointHelper::size).asDouble();
+
+	}
+
+	// Time prepare and draw passes
+	// Allocations are counted around the prepares from the second iteration on, once animated helpers have moved to geometry of their own
+	//
+	using Clock = std::chrono::steady_clock;
+
+	drawManager.setLogging(false);
+
+	double prepareSeconds = 0.0, drawSeconds = 0.0;
+	uint64_t prepareAllocations = 0;
+
+	for (int iteration = 0; iteration < iterations; iteration++)
+	{
+
+		for (unsigned int i = 0; i < sizes.size(); i++)
+		{
+
+			status = MPlug(dagPaths[i].node(), PointHelper::size).setDouble(sizes[i] * (1.0 + (0.01 * static_cast<double>(iteration + 1))));
+			CHECK_MSTATUS(status);
+
+		}
+
+		Clock::time_point start = Clock::now();
+
+		{
+
+			PointHelperAllocations::Counter allocationCounter;
+
+			for (unsigned int i = 0; i < numHelpers; i++)
+			{
+
+				drawOverrides[i]->prepareUserData(dagPaths[i], MDagPath(), userData[i].get());
+
+			}
+
+			prepareAllocations += (iteration > 0) ? allocationCounter.count() : 0;
+
+		}
+
+		Clock::time_point middle = Clock::now();
+
+		drawManager.reset();
+
+		for (unsigned int i = 0; i < numHelpers; i++)
+		{
+
+			drawOverrides[i]->drawUserData(drawManager, userData[i].get());
+
+		}
+
+		Clock::time_point end = Clock::now();
+
+		prepareSeconds += std::chrono::duration<double>(middle - start).count();
+		drawSeconds += std::chrono::duration<double>(end - middle).count();
+
+	}
+
+	// Restore animated helpers
+	//
+	for (unsigned int i = 0; i < sizes.size(); i++)
+	{
+
+		status = MPlug(dagPaths[i].node(), PointHelper::size).setDouble(sizes[i]);
+		CHECK_MSTATUS(status);
+
+	}
+
+	// Release overrides before deleting any synthetic helpers
+	//
+	userData.clear();
+	drawOverrides.clear();
+
+	if (count > 0)
+	{
+
+		status = dagModifier.undoIt();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	// Serialize results
+	//
+	double frames = static_cast<double>(iterations > 0 ? iterations : 1);
+	double helpers = static_cast<double>(numHelpers > 0 ? numHelpers : 1);
+
+	std::ostringstream stream;
+	stream << "{\"helpers\": " << numHelpers;
+	stream << ", \"iterations\": " << iterations;
+	stream << ", \"prepareNsPerHelper\": " << (prepareSeconds * 1e9) / (frames * helpers);
+	stream << ", \"drawNsPerHelper\": " << (drawSeconds * 1e9) / (frames * helpers);
+	stream << ", \"helpersPerSecond\": " << ((prepareSeconds + drawSeconds) > 0.0 ? (helpers * frames) / (prepareSeconds + drawSeconds) : 0.0);
+	stream << ", \"verticesPerFrame\": " << vertexCount;
+	stream << ", \"animate\": " << (animate ? "true" : "false");
+
+	if (PointHelperAllocations::isEnabled())
+	{
+
+		stream << ", \"prepareAllocations\": " << prepareAllocations;
+
+	}
+
+	stream << ", \"callsPerFrame\": {";
+
+	for (size_t i = 0; i < callCounts.size(); i++)
+	{
+
+		stream << (i > 0 ? ", " : "") << "\"" << Drawable::RecordingDrawManager::callName(static_cast<Drawable::DrawCall>(i)) << "\": " << callCounts[i];
+
+	}
+
+	stream << "}";
+
+	if (includeLog)
+	{
+
+		stream << ", \"log\": [";
+
+		for (size_t i = 0; i < log.size(); i++)
+		{
+
+			stream << (i > 0 ? ", " : "") << "[\"" << Drawable::RecordingDrawManager::callName(log[i].call) << "\", " << log[i].vertexCount << "]";
+
+		}
+
+		stream << "]";
+
+	}
+
+	stream << "}";
+
+	this->setResult(MString(stream.str().c_str()));
+
+	// Check if the prepares allocated once warmed up
+	//
+	if (prepareAllocations > 0)
+	{
+
+		MString message("pointHelperBenchmark: expected no allocations once warmed up, prepares allocated ");
+		message += static_cast<unsigned int>(prepareAllocations);
+		message += " time(s)!";
+
+		MGlobal::displayError(message);
+		return MS::kFailure;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperBenchmarkCommand::createHelpers(const int count, MDagModifier& dagModifier, MDagPathArray& dagPaths)
+/**
+Creates synthetic helpers that cycle through every drawable, fill and text.
+The supplied modifier can be undone to delete them again.
+
+@param count: The number of helpers to create.
+@param dagModifier: The modifier used to create the helpers.
+@param dagPaths: The passed array to populate with paths to the new shapes.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Create transforms with point helper shapes
+	//
+	MObjectArray transforms(count);
+
+	for (int i = 0; i < count; i++)
+	{
+
+		transforms[i] = dagModifier.createNode("pointHelper", MObject::kNullObj, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	status = dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Edit the drawables on each shape
+	//
+	const MObject drawables[] =
+	{
+		PointHelper::centerMarker, PointHelper::axisTripod, PointHelper::axisView, PointHelper::cross,
+		PointHelper::square, PointHelper::box, PointHelper::triangle, PointHelper::pyramid,
+		PointHelper::diamond, PointHelper::disc, PointHelper::arrow, PointHelper::notch,
+		PointHelper::tearDrop, PointHelper::cylinder, PointHelper::sphere, PointHelper::custom
+	};
+
+	const int numDrawables = sizeof(drawables) / sizeof(drawables[0]);
+
+	status = dagPaths.setLength(count);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDagPath dagPath;
+
+	for (int i = 0; i < count; i++)
+	{
+
+		status = MDagPath::getAPathTo(transforms[i], dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = dagPath.extendToShape();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MObject shape = dagPath.node();
+
+		for (int j = 0; j < numDrawables; j++)
+		{
+
+			bool enabled = (j == (i % numDrawables)) || (j == ((i / numDrawables) % numDrawables));
+			MPlug(shape, drawables[j]).setBool(enabled);
+
+		}
+
+		MPlug(shape, PointHelper::fill).setBool((i % 2) == 1);
+
+		if ((i % 8) == 0)
+		{
+
+			MPlug(shape, PointHelper::text).elementByLogicalIndex(0).setString(MString("helper"));
+
+		}
+
+		dagPaths[i] = dagPath;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperBenchmarkCommand::collectHelpers(MDagPathArray& dagPaths)
+/**
+Collects paths to every point helper in the scene.
+
+@param dagPaths: The passed array to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MItDag iterDag(MItDag::kDepthFirst, MFn::kPluginLocatorNode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDagPath dagPath;
+	MFnDagNode fnDagNode;
+
+	for (; !iterDag.isDone(); iterDag.next())
+	{
+
+		status = iterDag.getPath(dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = fnDagNode.setObject(dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (fnDagNode.typeId() == PointHelper::id)
+		{
+
+			dagPaths.append(dagPath);
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+bool PointHelperBenchmarkCommand::isUndoable() const
+/**
+Synthetic helpers are deleted before the command returns so there is nothing to undo.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+void* PointHelperBenchmarkCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperBenchmarkCommand
+*/
+{
+
+	return new PointHelperBenchmarkCommand();
+
+};
+
+
+MSyntax PointHelperBenchmarkCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperBenchmarkCommand::countFlag, PointHelperBenchmarkCommand::countLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperBenchmarkCommand::iterationsFlag, PointHelperBenchmarkCommand::iterationsLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperBenchmarkCommand::logFlag, PointHelperBenchmarkCommand::logLongFlag));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperBenchmarkCommand::animateFlag, PointHelperBenchmarkCommand::animateLongFlag));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
@@ -0,0 +1,59 @@
+#ifndef _POINT_HELPER_BENCHMARK_COMMAND
+#define _POINT_HELPER_BENCHMARK_COMMAND
+//
+// File: PointHelperBenchmarkCommand.h
+//
+// Command: pointHelperBenchmark
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperNode.h"
+#include "PointHelperDrawOverride.h"
+#include "RecordingDrawManager.h"
+#include "PointHelperAllocations.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MDagModifier.h>
+#include <maya/MDagPathArray.h>
+#include <maya/MPlug.h>
+#include <maya/MGlobal.h>
+#include <maya/MItDag.h>
+#include <maya/MString.h>
+
+
+class PointHelperBenchmarkCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperBenchmarkCommand();
+	virtual						~PointHelperBenchmarkCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	bool				isUndoable() const;
+
+	static	MStatus				createHelpers(const int count, MDagModifier& dagModifier, MDagPathArray& dagPaths);
+	static	MStatus				collectHelpers(MDagPathArray& dagPaths);
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			countFlag;
+	static	const char*			countLongFlag;
+	static	const char*			iterationsFlag;
+	static	const char*			iterationsLongFlag;
+	static	const char*			logFlag;
+	static	const char*			logLongFlag;
+	static	const char*			animateFlag;
+	static	const char*			animateLongFlag;
+
+};
+#endif
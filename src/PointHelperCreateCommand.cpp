@@ -0,0 +1,467 @@
+//
+// File: PointHelperCreateCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperCreateCommand.h"
+
+#include <maya/MGlobal.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MMatrix.h>
+#include <maya/MTransformationMatrix.h>
+#include <maya/MEulerRotation.h>
+#include <maya/MAngle.h>
+#include <maya/MVector.h>
+
+#include <cctype>
+#include <cstdlib>
+
+
+const MString	PointHelperCreateCommand::commandName("pointHelperCreate");
+
+const char*		PointHelperCreateCommand::matrixFlag = "-m";
+const char*		PointHelperCreateCommand::matrixLongFlag = "-matrix";
+const char*		PointHelperCreateCommand::shapesFlag = "-sh";
+const char*		PointHelperCreateCommand::shapesLongFlag = "-shapes";
+const char*		PointHelperCreateCommand::sizeFlag = "-s";
+const char*		PointHelperCreateCommand::sizeLongFlag = "-size";
+const char*		PointHelperCreateCommand::colorFlag = "-cl";
+const char*		PointHelperCreateCommand::colorLongFlag = "-color";
+const char*		PointHelperCreateCommand::matrixArrayFlag = "-ma";
+const char*		PointHelperCreateCommand::matrixArrayLongFlag = "-matrixArray";
+const char*		PointHelperCreateCommand::shapesArrayFlag = "-sha";
+const char*		PointHelperCreateCommand::shapesArrayLongFlag = "-shapesArray";
+const char*		PointHelperCreateCommand::sizeArrayFlag = "-sa";
+const char*		PointHelperCreateCommand::sizeArrayLongFlag = "-sizeArray";
+const char*		PointHelperCreateCommand::colorArrayFlag = "-ca";
+const char*		PointHelperCreateCommand::colorArrayLongFlag = "-colorArray";
+
+
+PointHelperCreateCommand::PointHelperCreateCommand() : MPxCommand() {};
+PointHelperCreateCommand::~PointHelperCreateCommand() {};
+
+
+MStatus PointHelperCreateCommand::doIt(const MArgList& args)
+/**
+Creates one point helper per matrix in a single undoable step.
+Every node and attribute edit goes through one modifier and draw dirty notifications are held until the batch is committed.
+Per helper arrays can hold one value per helper or a single value that is shared by all of them.
+The result is the names of the new transforms.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = PointHelperCreateCommand::getFlagValues(argDatabase, PointHelperCreateCommand::matrixFlag, PointHelperCreateCommand::matrixArrayFlag, this->matrices);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = PointHelperCreateCommand::getFlagValues(argDatabase, PointHelperCreateCommand::shapesFlag, PointHelperCreateCommand::shapesArrayFlag, this->shapeMasks);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = PointHelperCreateCommand::getFlagValues(argDatabase, PointHelperCreateCommand::sizeFlag, PointHelperCreateCommand::sizeArrayFlag, this->sizes);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = PointHelperCreateCommand::getFlagValues(argDatabase, PointHelperCreateCommand::colorFlag, PointHelperCreateCommand::colorArrayFlag, this->colors);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Validate array lengths
+	//
+	const size_t count = this->matrices.size() / 16;
+
+	bool isValid = (count > 0) && (this->matrices.size() == count * 16);
+	isValid &= this->shapeMasks.empty() || this->shapeMasks.size() == 1 || this->shapeMasks.size() == count;
+	isValid &= this->sizes.empty() || this->sizes.size() == 1 || this->sizes.size() == count;
+	isValid &= this->colors.empty() || this->colors.size() == 3 || this->colors.size() == count * 3;
+
+	if (!isValid)
+	{
+
+		MGlobal::displayError("pointHelperCreate: -matrix requires 16 values per helper and every other array must hold one entry, or one entry per helper!");
+		return MS::kInvalidParameter;
+
+	}
+
+	// Create transforms with point helper shapes
+	//
+	MObjectArray transforms(static_cast<unsigned int>(count));
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+
+		transforms[i] = this->dagModifier.createNode("pointHelper", MObject::kNullObj, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	// Hold draw dirty notifications until every edit has been committed
+	//
+	PointHelper::suspendDrawDirty();
+
+	status = this->dagModifier.doIt();
+
+	MStringArray names;
+
+	if (status)
+	{
+
+		status = this->editHelpers(transforms, this->shapes, names);
+
+		if (status)
+		{
+
+			status = this->dagModifier.doIt();
+
+		}
+
+		// Delete the new helpers if any edit failed, no undo is registered for a failed command
+		//
+		if (!status)
+		{
+
+			CHECK_MSTATUS(this->dagModifier.undoIt());
+			this->shapes.clear();
+
+		}
+
+	}
+
+	PointHelper::resumeDrawDirty(this->shapes);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	this->setResult(names);
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperCreateCommand::editHelpers(const MObjectArray& transforms, MObjectArray& shapes, MStringArray& names)
+/**
+Queues the transform, drawable, size and color edits for the newly created helpers.
+
+@param transforms: The new transforms.
+@param shapes: The passed array to populate with the new shapes.
+@param names: The passed array to populate with the transform names.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	const unsigned int count = transforms.length();
+
+	status = shapes.setLength(count);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = names.setLength(count);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	const char* translateNames[3] = { "translateX", "translateY", "translateZ" };
+	const char* rotateNames[3] = { "rotateX", "rotateY", "rotateZ" };
+	const char* scaleNames[3] = { "scaleX", "scaleY", "scaleZ" };
+	const char* shearNames[3] = { "shearXY", "shearXZ", "shearYZ" };
+	const char* colorNames[3] = { "overrideColorR", "overrideColorG", "overrideColorB" };
+
+	MDagPath dagPath;
+	MFnDagNode fnTransform;
+	MFnDependencyNode fnShape;
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+
+		status = fnTransform.setObject(transforms[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = MDagPath::getAPathTo(transforms[i], dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = dagPath.extendToShape();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		shapes[i] = dagPath.node();
+		names[i] = fnTransform.partialPathName();
+
+		status = fnShape.setObject(shapes[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Decompose matrix into transform values
+		// Shear is kept as well so sheared matrices are reproduced exactly
+		//
+		const double* values = &this->matrices[size_t(i) * 16];
+		const double rows[4][4] =
+		{
+			{ values[0], values[1], values[2], values[3] },
+			{ values[4], values[5], values[6], values[7] },
+			{ values[8], values[9], values[10], values[11] },
+			{ values[12], values[13], values[14], values[15] }
+		};
+
+		MTransformationMatrix transformationMatrix(MMatrix(rows));
+
+		MVector translate = transformationMatrix.getTranslation(MSpace::kTransform);
+		MEulerRotation rotate = transformationMatrix.eulerRotation();
+
+		double scale[3] = { 1.0, 1.0, 1.0 };
+		transformationMatrix.getScale(scale, MSpace::kTransform);
+
+		double shear[3] = { 0.0, 0.0, 0.0 };
+		transformationMatrix.getShear(shear, MSpace::kTransform);
+
+		for (unsigned int j = 0; j < 3; j++)
+		{
+
+			this->dagModifier.newPlugValueDouble(fnTransform.findPlug(translateNames[j], false), translate[j]);
+			this->dagModifier.newPlugValueMAngle(fnTransform.findPlug(rotateNames[j], false), MAngle(rotate[j], MAngle::kRadians));
+			this->dagModifier.newPlugValueDouble(fnTransform.findPlug(scaleNames[j], false), scale[j]);
+			this->dagModifier.newPlugValueDouble(fnTransform.findPlug(shearNames[j], false), shear[j]);
+
+		}
+
+		// Edit drawables
+		// Bit n of the mask enables Drawable::Shape n
+		//
+		if (!this->shapeMasks.empty())
+		{
+
+			const int mask = static_cast<int>(this->shapeMasks[(this->shapeMasks.size() == 1) ? 0 : i]);
+			this->dagModifier.newPlugValueInt(MPlug(shapes[i], PointHelper::shapeFlags), mask);
+
+		}
+
+		// Edit size
+		//
+		if (!this->sizes.empty())
+		{
+
+			this->dagModifier.newPlugValueDouble(MPlug(shapes[i], PointHelper::size), this->sizes[(this->sizes.size() == 1) ? 0 : i]);
+
+		}
+
+		// Edit wire color through the shape's drawing overrides
+		//
+		if (!this->colors.empty())
+		{
+
+			const double* color = &this->colors[(this->colors.size() == 3) ? 0 : size_t(i) * 3];
+
+			this->dagModifier.newPlugValueBool(fnShape.findPlug("overrideEnabled", false), true);
+			this->dagModifier.newPlugValueBool(fnShape.findPlug("overrideRGBColors", false), true);
+
+			for (unsigned int j = 0; j < 3; j++)
+			{
+
+				this->dagModifier.newPlugValueFloat(fnShape.findPlug(colorNames[j], false), static_cast<float>(color[j]));
+
+			}
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperCreateCommand::redoIt()
+/**
+Recreates the helpers.
+
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	PointHelper::suspendDrawDirty();
+
+	status = this->dagModifier.doIt();
+
+	PointHelper::resumeDrawDirty(this->shapes);
+
+	return status;
+
+};
+
+
+MStatus PointHelperCreateCommand::undoIt()
+/**
+Deletes the helpers.
+
+@return: Return status.
+*/
+{
+
+	return this->dagModifier.undoIt();
+
+};
+
+
+bool PointHelperCreateCommand::isUndoable() const
+/**
+The helpers are created in a single undo chunk.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+MStatus PointHelperCreateCommand::getFlagValues(const MArgDatabase& argDatabase, const char* flag, const char* arrayFlag, std::vector<double>& values)
+/**
+Collects every use of a multi-use numeric flag, followed by every value of its array flag, into a flat array.
+Each use of the array flag is a string of whitespace separated values so thousands of helpers can be passed in a single use.
+
+@param argDatabase: The parsed command arguments.
+@param flag: The numeric flag to collect.
+@param arrayFlag: The string flag holding whitespace separated values.
+@param values: The passed array to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	const unsigned int numUses = argDatabase.numberOfFlagUses(flag);
+	const unsigned int numArrayUses = argDatabase.numberOfFlagUses(arrayFlag);
+
+	values.clear();
+	values.reserve(numUses);
+
+	MArgList argList;
+
+	for (unsigned int i = 0; i < numUses; i++)
+	{
+
+		status = argDatabase.getFlagArgumentList(flag, i, argList);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		unsigned int index = 0;
+
+		values.push_back(argList.asDouble(index, &status));
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	for (unsigned int i = 0; i < numArrayUses; i++)
+	{
+
+		status = argDatabase.getFlagArgumentList(arrayFlag, i, argList);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		unsigned int index = 0;
+
+		MString text = argList.asString(index, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		// Parse whitespace separated values
+		//
+		const char* start = text.asChar();
+		char* end = nullptr;
+
+		while (true)
+		{
+
+			double value = std::strtod(start, &end);
+
+			if (end == start)
+			{
+
+				break;
+
+			}
+
+			values.push_back(value);
+			start = end;
+
+		}
+
+		// Anything left over that is not whitespace is not a number
+		//
+		while (std::isspace(static_cast<unsigned char>(*start)))
+		{
+
+			start++;
+
+		}
+
+		if (*start != '\0')
+		{
+
+			MGlobal::displayError(MString("pointHelperCreate: ") + arrayFlag + " expects whitespace separated numbers!");
+			return MS::kInvalidParameter;
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+void* PointHelperCreateCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperCreateCommand
+*/
+{
+
+	return new PointHelperCreateCommand();
+
+};
+
+
+MSyntax PointHelperCreateCommand::newSyntax()
+/**
+Returns the syntax for this command.
+Every flag can be used multiple times, so from Python each one takes a flat list.
+The array flags take the same values as one whitespace separated string, which avoids parsing a flag use per value.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::matrixFlag, PointHelperCreateCommand::matrixLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::shapesFlag, PointHelperCreateCommand::shapesLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::sizeFlag, PointHelperCreateCommand::sizeLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::colorFlag, PointHelperCreateCommand::colorLongFlag, MSyntax::kDouble));
+
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::matrixFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::shapesFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::sizeFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::colorFlag));
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::matrixArrayFlag, PointHelperCreateCommand::matrixArrayLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::shapesArrayFlag, PointHelperCreateCommand::shapesArrayLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::sizeArrayFlag, PointHelperCreateCommand::sizeArrayLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperCreateCommand::colorArrayFlag, PointHelperCreateCommand::colorArrayLongFlag, MSyntax::kString));
+
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::matrixArrayFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::shapesArrayFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::sizeArrayFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperCreateCommand::colorArrayFlag));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
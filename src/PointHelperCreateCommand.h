@@ -0,0 +1,78 @@
+#ifndef _POINT_HELPER_CREATE_COMMAND
+#define _POINT_HELPER_CREATE_COMMAND
+//
+// File: PointHelperCreateCommand.h
+//
+// Command: pointHelperCreate
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperNode.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MDagModifier.h>
+#include <maya/MDagPath.h>
+#include <maya/MObjectArray.h>
+#include <maya/MStringArray.h>
+#include <maya/MString.h>
+
+#include <vector>
+
+
+class PointHelperCreateCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperCreateCommand();
+	virtual						~PointHelperCreateCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	MStatus				redoIt();
+	virtual	MStatus				undoIt();
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+	static	MStatus				getFlagValues(const MArgDatabase& argDatabase, const char* flag, const char* arrayFlag, std::vector<double>& values);
+
+protected:
+
+			MStatus				editHelpers(const MObjectArray& transforms, MObjectArray& shapes, MStringArray& names);
+
+			MDagModifier		dagModifier;
+			MObjectArray		shapes;
+
+			std::vector<double>	matrices;
+			std::vector<double>	shapeMasks;
+			std::vector<double>	sizes;
+			std::vector<double>	colors;
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			matrixFlag;
+	static	const char*			matrixLongFlag;
+	static	const char*			shapesFlag;
+	static	const char*			shapesLongFlag;
+	static	const char*			sizeFlag;
+	static	const char*			sizeLongFlag;
+	static	const char*			colorFlag;
+	static	const char*			colorLongFlag;
+	static	const char*			matrixArrayFlag;
+	static	const char*			matrixArrayLongFlag;
+	static	const char*			shapesArrayFlag;
+	static	const char*			shapesArrayLongFlag;
+	static	const char*			sizeArrayFlag;
+	static	const char*			sizeArrayLongFlag;
+	static	const char*			colorArrayFlag;
+	static	const char*			colorArrayLongFlag;
+
+};
+#endif
@@ -32,8 +32,28 @@ Constructor.
 	this->fontSize = 11;
 
 	this->controlPoints = MVectorArray();
+	this->controlPointsGeneration = 0;
 
-	this->drawables = { { "cross", true }, { "box", true } };
+	this->shapeLibrary = nullptr;
+	this->shapeAsset = nullptr;
+	this->libraryShape = nullptr;
+	this->isShapePending = false;
+
+	this->curveLines = nullptr;
+
+	this->batch = nullptr;
+	this->inputHash = 0;
+	this->hasInputHash = false;
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		this->drawables[i] = false;
+
+	}
+
+	this->drawables[static_cast<unsigned int>(Drawable::Shape::Cross)] = true;
+	this->drawables[static_cast<unsigned int>(Drawable::Shape::Box)] = true;
 
 };
 
@@ -45,7 +65,11 @@ Destructor.
 {
 
 	this->controlPoints.clear();
-	this->drawables.clear();
+
+	this->libraryShape = nullptr;
+	this->shapeLibrary.reset();
+	this->shapeAsset.reset();
+	this->curveLines.reset();
 
 };
 
@@ -139,3 +163,100 @@ void PointHelperData::invalidate()
 	this->objectMatrix = sizeMatrix * scaleMatrix * rotateMatrix * positionMatrix;
 
 };
+
+
+size_t PointHelperData::memoryUsage() const
+/**
+Returns the bytes held by this data object, including its arrays and strings.
+
+@return: size_t
+*/
+{
+
+	size_t bytes = sizeof(PointHelperData);
+
+	bytes += Drawable::sizeOf(this->texts) - sizeof(MStringArray);
+	bytes += Drawable::sizeOf(this->text) - sizeof(MString);
+	bytes += Drawable::sizeOf(this->controlPoints) - sizeof(MVectorArray);
+
+	// Shared batches are reported by the geometry cache
+	//
+	if (this->batch != nullptr && !this->batch->isShared)
+	{
+
+		bytes += Drawable::sizeOf(this->batch->triangles) + Drawable::sizeOf(this->batch->normals) + Drawable::sizeOf(this->batch->lines);
+
+	}
+
+	return bytes;
+
+};
+
+
+uint64_t PointHelperData::geometryHash() const
+/**
+Returns a hash of every input the drawables prepare their geometry from.
+Colors, line widths and text are read at draw time so they are left out.
+
+@return: uint64_t
+*/
+{
+
+	double matrix[4][4];
+	this->objectMatrix.get(matrix);
+
+	uint64_t hash = Drawable::Core::hashBytes(matrix, sizeof(matrix));
+	hash = Drawable::Core::hashBytes(&this->size, sizeof(this->size), hash);
+	hash = Drawable::Core::hashBytes(this->drawables, sizeof(this->drawables), hash);
+
+	// Shared shapes and curves are immutable so their addresses identify them
+	//
+	const void* sources[3] = { this->libraryShape, this->curveLines.get(), this->shapeAsset.get() };
+
+	hash = Drawable::Core::hashBytes(sources, sizeof(sources), hash);
+	hash = Drawable::Core::hashBytes(&this->isShapePending, sizeof(this->isShapePending), hash);
+
+	// The node hands out a new generation whenever its control points are dirtied so the points themselves are not hashed
+	//
+	hash = Drawable::Core::hashBytes(&this->controlPointsGeneration, sizeof(this->controlPointsGeneration), hash);
+
+	return hash;
+
+};
+
+
+const void* PointHelperData::customSource() const
+/**
+Returns what the custom drawable's geometry is keyed by: the address of its shape or curves, or else the generation of its control points.
+Generations are handed out plugin-wide and never reused, so they identify the control points the same way an address identifies a shape.
+
+@return: const void*
+*/
+{
+
+	if (this->isShapePending)
+	{
+
+		return nullptr;
+
+	}
+	else if (this->libraryShape != nullptr)
+	{
+
+		return this->libraryShape;
+
+	}
+	else if (this->curveLines != nullptr)
+	{
+
+		return this->curveLines.get();
+
+	}
+	else
+	{
+
+		return reinterpret_cast<const void*>(static_cast<uintptr_t>(this->controlPointsGeneration));
+
+	}
+
+};
@@ -7,6 +7,9 @@
 //
 
 #include "Drawable.h"
+#include "DrawableLibrary.h"
+#include "GeometryCache.h"
+#include "MemoryUsage.h"
 
 #include <maya/MUserData.h>
 #include <maya/MPlug.h>
@@ -30,6 +33,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 
 
 class PointHelperData : public MUserData 
@@ -45,6 +49,10 @@ public:
 
 	virtual	void			invalidate();
 
+	virtual	size_t			memoryUsage() const;
+	virtual	uint64_t		geometryHash() const;
+	virtual	const void*		customSource() const;
+
 public:
 			
 			MVector			localPosition;
@@ -66,8 +74,20 @@ public:
 			unsigned int	depthPriority;
 
 			MVectorArray	controlPoints;
+			uint64_t		controlPointsGeneration;
+
+			std::shared_ptr<const Drawable::Library::ShapeLibrary>	shapeLibrary;
+			std::shared_ptr<const Drawable::Library::ShapeAsset>	shapeAsset;
+			const Drawable::Library::Shape*							libraryShape;
+			bool													isShapePending;
+
+			std::shared_ptr<const MPointArray>						curveLines;
+
+			bool			drawables[Drawable::NUM_SHAPES];
 
-			std::map<std::string, bool>	drawables;
+			std::shared_ptr<const Drawable::PreparedGeometry>		batch;
+			uint64_t												inputHash;
+			bool													hasInputHash;
 
 };
 #endif
\ No newline at end of file
@@ -5,6 +5,9 @@
 //
 
 #include "PointHelperDrawOverride.h"
+#include "UIDrawManager.h"
+#include "CaptureDrawManager.h"
+#include "PointHelperMemory.h"
 
 #include "Arrow.h"
 #include "AxisTripod.h"
@@ -23,6 +26,46 @@
 #include "Square.h"
 #include "TearDrop.h"
 
+#include <utility>
+
+
+// Drawable ids double as indices into the shape flags so both tables must agree
+//
+static_assert(PointHelperStats::NUM_DRAWABLES == Drawable::NUM_SHAPES, "Drawable names and shapes are out of sync!");
+
+// Draw calls that keep a drawable out of its helper's batch, since the batch only holds plain lines and triangles drawn with the helper's draw properties
+//
+static const Drawable::DrawCall UNBATCHED_CALLS[] =
+{
+	Drawable::DrawCall::Text,
+	Drawable::DrawCall::Icon,
+	Drawable::DrawCall::SetColor,
+	Drawable::DrawCall::SetLineWidth,
+	Drawable::DrawCall::SetLineStyle,
+	Drawable::DrawCall::SetFontSize
+};
+
+#if POINT_HELPER_STATS_ENABLED
+
+// Draw calls recorded as per-frame submission counters by drawUserData()
+//
+static const std::pair<Drawable::DrawCall, PointHelperStats::Counter> SUBMISSION_COUNTERS[] =
+{
+	{ Drawable::DrawCall::BeginDrawable, PointHelperStats::Counter::DrawableBlocks },
+	{ Drawable::DrawCall::Mesh, PointHelperStats::Counter::MeshCalls },
+	{ Drawable::DrawCall::LineList, PointHelperStats::Counter::LineListCalls },
+	{ Drawable::DrawCall::Line, PointHelperStats::Counter::LineCalls },
+	{ Drawable::DrawCall::Sphere, PointHelperStats::Counter::SphereCalls },
+	{ Drawable::DrawCall::Text, PointHelperStats::Counter::TextCalls },
+	{ Drawable::DrawCall::BeginDrawInXray, PointHelperStats::Counter::XrayToggles },
+	{ Drawable::DrawCall::SetColor, PointHelperStats::Counter::ColorChanges },
+	{ Drawable::DrawCall::SetLineWidth, PointHelperStats::Counter::LineWidthChanges }
+};
+
+static const unsigned int NUM_SUBMISSION_COUNTERS = sizeof(SUBMISSION_COUNTERS) / sizeof(SUBMISSION_COUNTERS[0]);
+
+#endif
+
 
 PointHelperDrawOverride::PointHelperDrawOverride(const MObject& node) : MPxDrawOverride(node, NULL, false)
 /**
@@ -41,6 +84,10 @@ Constructor.
 	this->modelEditorChangedCallbackId = MEventMessage::addEventCallback("modelEditorChanged", PointHelperDrawOverride::onModelEditorChanged, this, &status);
 	CHECK_MSTATUS(status);
 
+	this->shapeFileCallbackId = 0;
+
+	this->unbatchableDrawables = 0;
+
 	// Store pointer to MPxLocator
 	// This will be useful for getting plug data to pass into our MPxUserData class
 	//
@@ -49,6 +96,15 @@ Constructor.
 
 	this->pointHelper = status ? dynamic_cast<PointHelper*>(fnNode.userNode()) : nullptr;
 
+	// Register draw path counters for this node
+	//
+	this->stats = PointHelperStats::acquire(node);
+
+	// Register for memory accounting
+	//
+	this->userDataSize = 0;
+	PointHelperMemory::add(this);
+
 	// Check if drawables have been initialized
 	//
 	
@@ -62,23 +118,15 @@ Constructor.
 		this->drawables = std::map<std::string, Drawable::AbstractDrawable*>();
 
 		// Add drawables to dictionary
+		// Each drawable's id is its shape index, which is used by stats, traces, probes and the geometry cache
 		//
-		this->drawables.insert(std::make_pair("arrow", new Arrow()));
-		this->drawables.insert(std::make_pair("axisTripod", new AxisTripod()));
-		this->drawables.insert(std::make_pair("axisView", new AxisView()));
-		this->drawables.insert(std::make_pair("box", new Box()));
-		this->drawables.insert(std::make_pair("centerMarker", new CenterMarker()));
-		this->drawables.insert(std::make_pair("cross", new Cross()));
-		this->drawables.insert(std::make_pair("custom", new Custom()));
-		this->drawables.insert(std::make_pair("cylinder", new Cylinder()));
-		this->drawables.insert(std::make_pair("triangle", new Triangle()));
-		this->drawables.insert(std::make_pair("pyramid", new Pyramid()));
-		this->drawables.insert(std::make_pair("diamond", new Diamond()));
-		this->drawables.insert(std::make_pair("disc", new Disc()));
-		this->drawables.insert(std::make_pair("notch", new Notch()));
-		this->drawables.insert(std::make_pair("sphere", new Sphere()));
-		this->drawables.insert(std::make_pair("square", new Square()));
-		this->drawables.insert(std::make_pair("tearDrop", new TearDrop()));
+		for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+		{
+
+			Drawable::Shape shape = static_cast<Drawable::Shape>(i);
+			this->drawables.insert(std::make_pair(std::string(Drawable::shapeName(shape)), Drawable::AbstractDrawable::create(shape)));
+
+		}
 
 	}
 	
@@ -96,6 +144,11 @@ Destructor.
 	this->pointHelper = NULL;
 	this->drawables.clear();
 
+	PointHelperStats::release(this->stats);
+	this->stats = nullptr;
+
+	PointHelperMemory::remove(this);
+
 	// Remove model editor callback
 	//
 	if (this->modelEditorChangedCallbackId != 0) 
@@ -106,6 +159,16 @@ Destructor.
 
 	}
 
+	// Remove shape file callback
+	//
+	if (this->shapeFileCallbackId != 0) 
+	{
+
+		MMessage::removeCallback(this->shapeFileCallbackId);
+		this->shapeFileCallbackId = 0;
+
+	}
+
 };
 
 
@@ -144,11 +207,11 @@ To explicitly mark an object as being dirty the MRenderer::setGeometryDrawDirty(
 
 	}
 
-	// Check if point helper is null
+	// Check if point helper is null or a bulk edit is in progress
 	//
 	PointHelperDrawOverride *drawOverride = static_cast<PointHelperDrawOverride*>(clientData);
 
-	if (drawOverride->pointHelper == NULL)
+	if (drawOverride->pointHelper == NULL || PointHelper::isDrawDirtySuspended())
 	{
 
 		return;
@@ -162,6 +225,53 @@ To explicitly mark an object as being dirty the MRenderer::setGeometryDrawDirty(
 };
 
 
+void PointHelperDrawOverride::onShapeFileIdle(void* clientData)
+/**
+Idle callback used while this locator's shape file loads on a worker thread.
+Once the file has loaded, or failed to, the node is marked dirty so the shape replaces the bounding-box and the callback removes itself.
+
+@param clientData: Pointer to the draw override instance.
+@return: void
+*/
+{
+
+	// Check if client data is null
+	//
+	if (clientData == NULL)
+	{
+
+		return;
+
+	}
+
+	PointHelperDrawOverride *drawOverride = static_cast<PointHelperDrawOverride*>(clientData);
+
+	if (drawOverride->pointHelper == NULL)
+	{
+
+		return;
+
+	}
+
+	// Check if the shape file is still loading
+	//
+	std::shared_ptr<const Drawable::Library::ShapeAsset> asset;
+
+	if (drawOverride->pointHelper->getShapeAsset(asset) == Drawable::Library::AssetState::Pending)
+	{
+
+		return;
+
+	}
+
+	MMessage::removeCallback(drawOverride->shapeFileCallbackId);
+	drawOverride->shapeFileCallbackId = 0;
+
+	MHWRender::MRenderer::setGeometryDrawDirty(drawOverride->pointHelper->thisMObject());
+
+};
+
+
 MHWRender::DrawAPI PointHelperDrawOverride::supportedDrawAPIs() const
 /**
 Returns the draw API supported by this override.
@@ -208,6 +318,9 @@ Default implementation returns a huge bounding box which will never cull the obj
 */
 {
 
+	POINT_HELPER_PROFILE(MProfiler::kColorE_L3, "boundingBox", nullptr, this->pointHelper->thisMObject());
+	POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::BoundingBoxCalls, 1);
+
 	return this->pointHelper->boundingBox();
 
 };
@@ -239,10 +352,32 @@ It is invalid to pull data from the Maya dependency graph in the draw callback m
 @param userData: Data cached by the previous draw of the instance.
 @return: MUserData
 */
+{
+
+	return this->prepareUserData(objPath, cameraPath, userData);
+
+};
+
+
+PointHelperData* PointHelperDrawOverride::prepareUserData(const MDagPath& objPath, const MDagPath& cameraPath, MUserData* userData)
+/**
+Copies the node's internal data and prepares every enabled drawable.
+Unlike prepareForDraw() this does not require a frame context so it can be driven without a viewport.
+
+@param objPath: The path to the object being drawn.
+@param cameraPath: The path to the camera that is being used to draw.
+@param userData: Data cached by the previous draw of the instance.
+@return: PointHelperData
+*/
 {
 
 	MStatus status;
 
+	PointHelperProbes::PrepareForDrawProbe prepareForDrawProbe(this->pointHelper);
+	POINT_HELPER_TRACE("prepareForDraw", this->pointHelper->thisMObject());
+	POINT_HELPER_STATS_TIMER(this->stats, PointHelperStats::Counter::PrepareForDrawTime);
+	POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::PrepareForDrawCalls, 1);
+
 	// Check if an instance of PointHelperData exists
 	//
 	PointHelperData* pointHelperData = dynamic_cast<PointHelperData*>(userData);
@@ -256,29 +391,81 @@ It is invalid to pull data from the Maya dependency graph in the draw callback m
 
 	// Copy internal values
 	//
-	this->pointHelper->copyInternalData(pointHelperData);
+	{
+
+		POINT_HELPER_PROFILE(MProfiler::kColorD_L1, "copyInternalData", nullptr, this->pointHelper->thisMObject());
+		POINT_HELPER_TRACE("copyInternalData", this->pointHelper->thisMObject());
+		POINT_HELPER_STATS_TIMER(this->stats, PointHelperStats::Counter::CopyInternalDataTime);
+		POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::CopyInternalDataCalls, 1);
+
+		this->pointHelper->copyInternalData(pointHelperData);
+
+	}
 
 	pointHelperData->copyWireColor(objPath);
 	pointHelperData->copyDepthPriority(objPath);
 
-	// Iterate through drawable attributes
+	// Redraw once a loading shape file is ready
+	//
+	if (pointHelperData->isShapePending && this->shapeFileCallbackId == 0)
+	{
+
+		MStatus status;
+
+		this->shapeFileCallbackId = MEventMessage::addEventCallback("idle", PointHelperDrawOverride::onShapeFileIdle, this, &status);
+		CHECK_MSTATUS(status);
+
+	}
+
+	// Skip every drawable's prepare when none of their inputs changed since this instance's last one
+	// Maya also marks the override dirty for editor and selection changes that leave the geometry as is
+	// The override is shared by every instance of the node so the hash is kept with the instance's batch
+	//
+	// Filled spheres are only captured as triangles while the helper is filled so the fill is hashed as well
+	//
+	uint64_t inputHash = Drawable::Core::hashBytes(&pointHelperData->fill, sizeof(pointHelperData->fill), pointHelperData->geometryHash());
+
+	if (pointHelperData->hasInputHash && inputHash == pointHelperData->inputHash)
+	{
+
+		POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::PrepareSkips, 1);
+
+		this->userDataSize = pointHelperData->memoryUsage();
+		return pointHelperData;
+
+	}
+
+	pointHelperData->inputHash = inputHash;
+	pointHelperData->hasInputHash = true;
+
+	// Iterate through drawables
+	// Flags are indexed by drawable id so no lookups by name are made per frame
 	//
 	Drawable::AbstractDrawable* drawable;
-	std::map<std::string, bool>::iterator iter;
+	bool isEnabled;
 
-	for (iter = pointHelperData->drawables.begin(); iter != pointHelperData->drawables.end(); iter++)
+	for (auto const& x : this->drawables)
 	{
 		
 		// Check if drawable is enabled
 		//
-		drawable = this->drawables[iter->first];
-		drawable->setEnabled(iter->second);
+		drawable = x.second;
+		isEnabled = pointHelperData->drawables[drawable->getId()];
 
-		if (iter->second)
+		drawable->setEnabled(isEnabled);
+
+		if (isEnabled)
 		{
 
+			PointHelperProbes::DrawablePrepareProbe drawablePrepareProbe(this->pointHelper, drawable->getId());
+			POINT_HELPER_PROFILE(MProfiler::kColorD_L2, PointHelperStats::drawableName(drawable->getId()), "prepareForDraw", this->pointHelper->thisMObject());
+			POINT_HELPER_TRACE(PointHelperStats::drawableName(drawable->getId()), this->pointHelper->thisMObject(), "prepareForDraw");
+			POINT_HELPER_STATS_TIMER(this->stats, PointHelperStats::drawablePrepareTime(drawable->getId()));
+
 			drawable->setObjectMatrix(pointHelperData->objectMatrix);
-			drawable->prepareForDraw(objPath, cameraPath, frameContext, pointHelperData);
+			drawable->prepareForDraw(objPath, cameraPath, pointHelperData);
+
+			drawablePrepareProbe.setVertexCount(drawable->vertexCount());
 
 		}
 		else
@@ -290,11 +477,164 @@ It is invalid to pull data from the Maya dependency graph in the draw callback m
 		
 	}
 
+	// Merge the enabled shapes into a single batch
+	//
+	this->batchDrawables(pointHelperData);
+
+	// Update memory accounting
+	//
+	this->userDataSize = pointHelperData->memoryUsage();
+
 	return pointHelperData;
 
 };
 
 
+void PointHelperDrawOverride::batchDrawables(PointHelperData* pointHelperData)
+/**
+Concatenates the lines and triangles of every enabled drawable into one batch, so each helper is submitted as one line list and one triangle list.
+The batch is prepared through the geometry cache, keyed by the enabled drawables, object matrix and shape, so helpers that look the same share it.
+Each drawable is captured through a capture draw manager and anything beyond plain meshes, lines, spheres and paint styles, such as text, icons or draw state, keeps the drawable out of the batch.
+Drawables without prepared geometry have nothing to capture so they are kept out as well.
+Drawables found to make such calls are remembered and not captured again.
+Triangles and normals are always captured and the fill and shaded flags are applied when the batch is drawn.
+Spheres are the exception, they are captured as wireframe lines when the helper is not filled, so the batch is also keyed by the fill.
+
+@param pointHelperData: The data the drawables were prepared with.
+@return: void
+*/
+{
+
+	POINT_HELPER_PROFILE(MProfiler::kColorD_L2, "batch", "prepareForDraw", this->pointHelper->thisMObject());
+	POINT_HELPER_TRACE("batch", this->pointHelper->thisMObject(), "prepareForDraw");
+
+	// Key the batch by everything the enabled drawables were prepared from
+	// Only a custom shape reads more than the object matrix so its shape, curves or control points are keyed the same way as its own geometry
+	//
+	Drawable::GeometryKey key(Drawable::NUM_SHAPES, pointHelperData->objectMatrix);
+	unsigned int customId = static_cast<unsigned int>(Drawable::Shape::Custom);
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		key.variant |= pointHelperData->drawables[i] ? (1u << i) : 0u;
+
+	}
+
+	key.variant |= pointHelperData->fill ? (1u << (Drawable::NUM_SHAPES + 1)) : 0u;
+
+	if (pointHelperData->drawables[customId])
+	{
+
+		bool isControlPoints = !pointHelperData->isShapePending && pointHelperData->libraryShape == nullptr && pointHelperData->curveLines == nullptr;
+
+		key.variant |= pointHelperData->isShapePending ? (1u << Drawable::NUM_SHAPES) : 0u;
+		key.variant |= isControlPoints ? (1u << (Drawable::NUM_SHAPES + 2)) : 0u;
+		key.sources[0] = pointHelperData->customSource();
+
+	}
+
+	std::shared_ptr<Drawable::PreparedGeometry> batch = Drawable::GeometryCache::acquire(key, pointHelperData->batch);
+
+	if (batch == nullptr)
+	{
+
+		return;
+
+	}
+
+	// Capture the enabled drawables
+	// A single scratch capture is reused by every helper on this thread
+	//
+	static thread_local Drawable::CaptureDrawManager captureDrawManager;
+	captureDrawManager.reset();
+
+	bool fill = pointHelperData->fill;
+	bool shaded = pointHelperData->shaded;
+
+	pointHelperData->fill = true;
+	pointHelperData->shaded = true;
+
+	captureDrawManager.setSphereFill(fill);
+
+	batch->unbatched = 0;
+
+	Drawable::AbstractDrawable* drawable;
+
+	for (auto const& x : this->drawables)
+	{
+
+		drawable = x.second;
+
+		if (!drawable->isEnabled())
+		{
+
+			continue;
+
+		}
+
+		if (drawable->vertexCount() == 0 || (this->unbatchableDrawables & (1u << drawable->getId())) != 0)
+		{
+
+			batch->unbatched |= 1u << drawable->getId();
+			continue;
+
+		}
+
+		// Capture drawable
+		//
+		size_t numTriangles = captureDrawManager.buffers().triangles.size();
+		size_t numLines = captureDrawManager.buffers().lines.size();
+		uint64_t numUnbatchedCalls = 0;
+
+		for (Drawable::DrawCall call : UNBATCHED_CALLS)
+		{
+
+			numUnbatchedCalls += captureDrawManager.callCount(call);
+
+		}
+
+		drawable->draw(captureDrawManager, pointHelperData);
+
+		for (Drawable::DrawCall call : UNBATCHED_CALLS)
+		{
+
+			numUnbatchedCalls -= captureDrawManager.callCount(call);
+
+		}
+
+		if (numUnbatchedCalls != 0)
+		{
+
+			captureDrawManager.rewind(numTriangles, numLines);
+			batch->unbatched |= 1u << drawable->getId();
+
+			this->unbatchableDrawables |= 1u << drawable->getId();
+
+		}
+
+	}
+
+	pointHelperData->fill = fill;
+	pointHelperData->shaded = shaded;
+
+	// Convert the batch for submission
+	// The batch holds the owners of any shape or curves it is keyed by to keep their addresses from being reused
+	//
+	const Drawable::Core::MeshBuffers& buffers = captureDrawManager.buffers();
+
+	Drawable::fromCore(buffers.triangles, batch->triangles);
+	Drawable::fromCore(buffers.normals, batch->normals);
+	Drawable::fromCore(buffers.lines, batch->lines);
+
+	batch->owners[0] = (key.sources[0] == nullptr) ? nullptr : (pointHelperData->libraryShape != nullptr) ? std::static_pointer_cast<const void>(pointHelperData->shapeAsset) : std::static_pointer_cast<const void>(pointHelperData->curveLines);
+	batch->owners[1] = (key.sources[0] != nullptr && pointHelperData->libraryShape != nullptr) ? std::static_pointer_cast<const void>(pointHelperData->shapeLibrary) : nullptr;
+
+	Drawable::GeometryCache::commit(batch, pointHelperData->batch);
+
+};
+
+
 void PointHelperDrawOverride::addUIDrawables(const MDagPath& objPath, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const MUserData* userData)
 /**
 Provides access to the MUIDrawManager, which can be used to queue up operations to draw simple UI shapes like lines, circles, text, etc.
@@ -308,11 +648,28 @@ This method is called after prepareForDraw() and carries the same restrictions o
 @param userData: Data cached by prepareForDraw().
 @return: void
 */
+{
+
+	Drawable::UIDrawManager uiDrawManager(drawManager);
+	this->drawUserData(uiDrawManager, userData);
+
+};
+
+
+void PointHelperDrawOverride::drawUserData(Drawable::AbstractDrawManager& drawManager, const MUserData* userData)
+/**
+Submits the enabled drawables and text to the supplied draw manager.
+The draw manager may forward to the viewport or record calls for headless benchmarks.
+
+@param drawManager: The draw manager to submit to.
+@param userData: Data cached by prepareUserData().
+@return: void
+*/
 {
 
 	// Retrieve the cached data from the prepareForDraw() method
 	//
-	PointHelperData* pointHelperData = (PointHelperData*)userData;
+	const PointHelperData* pointHelperData = dynamic_cast<const PointHelperData*>(userData);
 
 	if (!pointHelperData) 
 	{
@@ -321,18 +678,106 @@ This method is called after prepareForDraw() and carries the same restrictions o
 
 	}
 
-	// Iterate through drawables
+	PointHelperProbes::AddUIDrawablesProbe addUIDrawablesProbe(this->pointHelper);
+	POINT_HELPER_TRACE("addUIDrawables", this->pointHelper->thisMObject());
+	POINT_HELPER_STATS_TIMER(this->stats, PointHelperStats::Counter::DrawTime);
+	POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::DrawCalls, 1);
+
+	uint64_t vertexCount = drawManager.vertexCount();
+
+#if POINT_HELPER_STATS_ENABLED
+
+	uint64_t primitiveCount = drawManager.primitiveCount();
+	uint64_t callCounts[NUM_SUBMISSION_COUNTERS];
+
+	for (unsigned int i = 0; i < NUM_SUBMISSION_COUNTERS; i++)
+	{
+
+		callCounts[i] = drawManager.callCount(SUBMISSION_COUNTERS[i].first);
+
+	}
+
+#endif
+
+	// Draw the batch in a single drawable
 	//
-	bool isEnabled;
+	const Drawable::PreparedGeometry* batch = pointHelperData->batch.get();
 
-	for (auto const& x : this->drawables) 
+	bool hasTriangles = batch != nullptr && pointHelperData->fill && batch->triangles.length() > 0;
+	bool hasLines = batch != nullptr && batch->lines.length() > 0;
+
+	if (hasTriangles || hasLines)
 	{
 
-		// Check if drawable is enabled
+		// Begin drawable
+		//
+		drawManager.beginDrawable();
+
+		// Edit draw properties
+		//
+		drawManager.setColor(pointHelperData->wireColor);
+		drawManager.setDepthPriority(pointHelperData->depthPriority);
+		drawManager.setLineWidth(pointHelperData->lineWidth);
+		drawManager.setLineStyle(MHWRender::MUIDrawManager::kSolid);
+
+		if (pointHelperData->drawOnTop) 
+		{
+
+			drawManager.beginDrawInXray();
+
+		}
+
+		// Request draw
+		//
+		{
+
+			PointHelperProbes::DrawableDrawProbe drawableDrawProbe(this->pointHelper, PointHelperProbes::NO_DRAWABLE);
+			POINT_HELPER_PROFILE(MProfiler::kColorB_L2, "batch", "draw", this->pointHelper->thisMObject());
+			POINT_HELPER_TRACE("batch", this->pointHelper->thisMObject(), "draw");
+
+			uint64_t batchVertexCount = drawManager.vertexCount();
+
+			if (hasTriangles)
+			{
+
+				drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
+				drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, batch->triangles, &batch->normals);
+
+			}
+
+			if (hasLines)
+			{
+
+				drawManager.mesh(MHWRender::MUIDrawManager::kLines, batch->lines);
+
+			}
+
+			drawableDrawProbe.setVertexCount(drawManager.vertexCount() - batchVertexCount);
+
+		}
+
+		if (pointHelperData->drawOnTop) 
+		{
+
+			drawManager.endDrawInXray();
+
+		}
+
+		// End drawable
 		//
-		isEnabled = x.second->isEnabled();
+		drawManager.endDrawable();
+
+	}
+
+	// Draw the drawables kept out of the batch in drawables of their own
+	// Each one starts from the helper's draw properties since they may change the color, font size or line width
+	//
+	unsigned int unbatched = (batch != nullptr) ? batch->unbatched : 0;
+
+	for (auto const& x : this->drawables)
+	{
 
-		if (!isEnabled) 
+		if (!x.second->isEnabled() || (unbatched & (1u << x.second->getId())) == 0)
 		{
 
 			continue;
@@ -359,7 +804,19 @@ This method is called after prepareForDraw() and carries the same restrictions o
 
 		// Request draw
 		//
-		x.second->draw(drawManager, frameContext, pointHelperData);
+		{
+
+			PointHelperProbes::DrawableDrawProbe drawableDrawProbe(this->pointHelper, x.second->getId());
+			POINT_HELPER_PROFILE(MProfiler::kColorB_L2, PointHelperStats::drawableName(x.second->getId()), "draw", this->pointHelper->thisMObject());
+			POINT_HELPER_TRACE(PointHelperStats::drawableName(x.second->getId()), this->pointHelper->thisMObject(), "draw");
+			POINT_HELPER_STATS_TIMER(this->stats, PointHelperStats::drawableDrawTime(x.second->getId()));
+
+			uint64_t drawableVertexCount = drawManager.vertexCount();
+			x.second->draw(drawManager, pointHelperData);
+
+			drawableDrawProbe.setVertexCount(drawManager.vertexCount() - drawableVertexCount);
+
+		}
 
 		if (pointHelperData->drawOnTop) 
 		{
@@ -379,6 +836,9 @@ This method is called after prepareForDraw() and carries the same restrictions o
 	if (pointHelperData->text.length() > 0) 
 	{
 
+		POINT_HELPER_PROFILE(MProfiler::kColorB_L3, "text", "draw", this->pointHelper->thisMObject());
+		POINT_HELPER_TRACE("text", this->pointHelper->thisMObject(), "draw");
+
 		// Begin drawable
 		//
 		drawManager.beginDrawable();
@@ -399,19 +859,116 @@ This method is called after prepareForDraw() and carries the same restrictions o
 
 	}
 
+	// Record emitted geometry
+	//
+	addUIDrawablesProbe.setVertexCount(drawManager.vertexCount() - vertexCount);
+
+	POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::Vertices, drawManager.vertexCount() - vertexCount);
+	POINT_HELPER_STATS_RECORD(this->stats, PointHelperStats::Counter::Primitives, drawManager.primitiveCount() - primitiveCount);
+
+#if POINT_HELPER_STATS_ENABLED
+
+	// Record submitted calls, counters that did not change are skipped to keep the atomics off the common path
+	//
+	for (unsigned int i = 0; i < NUM_SUBMISSION_COUNTERS; i++)
+	{
+
+		uint64_t numCalls = drawManager.callCount(SUBMISSION_COUNTERS[i].first) - callCounts[i];
+
+		if (numCalls > 0)
+		{
+
+			POINT_HELPER_STATS_RECORD(this->stats, SUBMISSION_COUNTERS[i].second, numCalls);
+
+		}
+
+	}
+
+#endif
+
+};
+
+
+MObject PointHelperDrawOverride::node() const
+/**
+Returns the point helper node this override draws.
+
+@return: MObject
+*/
+{
+
+	return (this->pointHelper != nullptr) ? this->pointHelper->thisMObject() : MObject::kNullObj;
+
+};
+
+
+void PointHelperDrawOverride::memoryUsage(Drawable::MemoryUsage& usage, Drawable::MemoryUsage* drawableUsage) const
+/**
+Adds the bytes held by this override's user data and drawable buffers to the supplied usage.
+The user data size is the size recorded during the last prepare.
+
+@param usage: The usage to add to.
+@param drawableUsage: Optional array, indexed by drawable id, to add each drawable's usage to.
+@return: void
+*/
+{
+
+	usage.add(Drawable::Buffer::UserData, this->userDataSize);
+
+	for (auto const& x : this->drawables)
+	{
+
+		Drawable::MemoryUsage bufferUsage;
+		x.second->memoryUsage(bufferUsage);
+
+		usage += bufferUsage;
+
+		if (drawableUsage != nullptr && x.second->getId() < PointHelperStats::NUM_DRAWABLES)
+		{
+
+			drawableUsage[x.second->getId()] += bufferUsage;
+
+		}
+
+	}
+
+};
+
+
+void PointHelperDrawOverride::meshDataMemoryUsage(size_t* drawableBytes) const
+/**
+Copies the bytes held by each drawable's shared mesh data into the supplied array.
+
+@param drawableBytes: The passed array, indexed by drawable id, to populate.
+@return: void
+*/
+{
+
+	for (auto const& x : this->drawables)
+	{
+
+		if (x.second->getId() < PointHelperStats::NUM_DRAWABLES)
+		{
+
+			drawableBytes[x.second->getId()] = x.second->meshDataMemoryUsage();
+
+		}
+
+	}
+
 };
 
 
 bool PointHelperDrawOverride::traceCallSequence() const
 /**
 This method allows a way for a plug-in to examine the basic call sequence for a draw override.
-The default implementation returns false meaning no tracing will occur.
+Tracing follows the state of the trace-event tracer, see the pointHelperTrace command.
 
 @return: bool
 */
 {
 
-	return false; // Toggle for debugging!!!
+	return PointHelperTracer::isEnabled();
 
 };
 
@@ -419,13 +976,13 @@ The default implementation returns false meaning no tracing will occur.
 void PointHelperDrawOverride::handleTraceMessage(const MString& message) const
 /**
 When debug tracing is enabled via MPxDrawOverride::traceCallSequence(), this method will be called for each trace message.
-The default implementation will print the message to stderr.
+Messages are recorded as instant events so they line up with the tracer's begin and end events.
 
 @param message: A string which will provide feedback on either an internal or plug-in call location.
 @return: void
 */
 {
 
-	MGlobal::displayInfo("PointHelperDrawOverride::handleTraceMessage() : " + message);
+	PointHelperTracer::record('i', "traceMessage", this->pointHelper->thisMObject(), message.asChar());
 
 }
\ No newline at end of file
@@ -9,6 +9,11 @@
 #include "PointHelperNode.h"
 #include "PointHelperData.h"
 #include "AbstractDrawable.h"
+#include "AbstractDrawManager.h"
+#include "PointHelperStats.h"
+#include "PointHelperProfiler.h"
+#include "PointHelperTracer.h"
+#include "PointHelperProbes.h"
 
 #include <maya/MPxDrawOverride.h>
 #include <maya/MObject.h>
@@ -47,6 +52,15 @@ public:
 	virtual bool				hasUIDrawables() const;
 	virtual void				addUIDrawables(const MDagPath& objPath, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const MUserData* userData);
 
+			PointHelperData*	prepareUserData(const MDagPath& objPath, const MDagPath& cameraPath, MUserData* userData);
+			void				drawUserData(Drawable::AbstractDrawManager& drawManager, const MUserData* userData);
+
+			void				batchDrawables(PointHelperData* pointHelperData);
+
+			MObject				node() const;
+			void				memoryUsage(Drawable::MemoryUsage& usage, Drawable::MemoryUsage* drawableUsage) const;
+			void				meshDataMemoryUsage(size_t* drawableBytes) const;
+
 	virtual	bool				traceCallSequence() const;
 	virtual	void				handleTraceMessage(const MString& message) const;
 
@@ -54,9 +68,15 @@ private:
 
 			PointHelper*										pointHelper;
 			std::map<std::string, Drawable::AbstractDrawable*>	drawables;
+			PointHelperStats::NodeStats*						stats;
+			size_t												userDataSize;
+			unsigned int										unbatchableDrawables;
 
 			MCallbackId							modelEditorChangedCallbackId;
 	static	void								onModelEditorChanged(void *clientData);
 
+			MCallbackId							shapeFileCallbackId;
+	static	void								onShapeFileIdle(void *clientData);
+
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,471 @@
+//
+// File: PointHelperEditCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperEditCommand.h"
+
+#include <maya/MGlobal.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MObjectHandle.h>
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+
+
+struct ObjectHandleHash
+{
+
+	size_t operator()(const MObjectHandle& handle) const
+	{
+
+		return static_cast<size_t>(handle.hashCode());
+
+	};
+
+};
+
+
+const MString	PointHelperEditCommand::commandName("pointHelperEdit");
+
+const char*		PointHelperEditCommand::sizeFlag = "-s";
+const char*		PointHelperEditCommand::sizeLongFlag = "-size";
+const char*		PointHelperEditCommand::lineWidthFlag = "-lw";
+const char*		PointHelperEditCommand::lineWidthLongFlag = "-lineWidth";
+const char*		PointHelperEditCommand::fontSizeFlag = "-fs";
+const char*		PointHelperEditCommand::fontSizeLongFlag = "-fontSize";
+const char*		PointHelperEditCommand::fillFlag = "-f";
+const char*		PointHelperEditCommand::fillLongFlag = "-fill";
+const char*		PointHelperEditCommand::shadedFlag = "-sd";
+const char*		PointHelperEditCommand::shadedLongFlag = "-shaded";
+const char*		PointHelperEditCommand::drawOnTopFlag = "-dot";
+const char*		PointHelperEditCommand::drawOnTopLongFlag = "-drawOnTop";
+const char*		PointHelperEditCommand::shapesFlag = "-sh";
+const char*		PointHelperEditCommand::shapesLongFlag = "-shapes";
+const char*		PointHelperEditCommand::enableFlag = "-en";
+const char*		PointHelperEditCommand::enableLongFlag = "-enable";
+const char*		PointHelperEditCommand::disableFlag = "-dis";
+const char*		PointHelperEditCommand::disableLongFlag = "-disable";
+
+
+PointHelperEditCommand::PointHelperEditCommand() : MPxCommand() {};
+PointHelperEditCommand::~PointHelperEditCommand() {};
+
+
+MStatus PointHelperEditCommand::doIt(const MArgList& args)
+/**
+Applies the same attribute values to every supplied helper in a single undoable step.
+Edits are queued on one modifier and the helpers' draw dirty notifications are held until it has been committed.
+If no objects are supplied the active selection is used, and transforms are expanded to their point helper shapes.
+The result is the number of helpers edited.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MSelectionList selection;
+
+	status = argDatabase.getObjects(selection);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = PointHelperEditCommand::collectHelpers(selection, this->nodes);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Queue edits
+	//
+	status = this->queueEdits(argDatabase);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->redoIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	this->setResult(static_cast<int>(this->nodes.length()));
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperEditCommand::queueEdits(const MArgDatabase& argDatabase)
+/**
+Queues a plug edit per helper for every flag that was set.
+
+@param argDatabase: The parsed command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Collect values
+	//
+	const bool hasSize = argDatabase.isFlagSet(PointHelperEditCommand::sizeFlag);
+	const bool hasLineWidth = argDatabase.isFlagSet(PointHelperEditCommand::lineWidthFlag);
+	const bool hasFontSize = argDatabase.isFlagSet(PointHelperEditCommand::fontSizeFlag);
+	const bool hasFill = argDatabase.isFlagSet(PointHelperEditCommand::fillFlag);
+	const bool hasShaded = argDatabase.isFlagSet(PointHelperEditCommand::shadedFlag);
+	const bool hasDrawOnTop = argDatabase.isFlagSet(PointHelperEditCommand::drawOnTopFlag);
+	const bool hasShapes = argDatabase.isFlagSet(PointHelperEditCommand::shapesFlag);
+
+	double size = 0.0, lineWidth = 0.0;
+	int fontSize = 0, shapes = 0;
+	bool fill = false, shaded = false, drawOnTop = false;
+
+	if (hasSize)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::sizeFlag, 0, size);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (hasLineWidth)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::lineWidthFlag, 0, lineWidth);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (hasFontSize)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::fontSizeFlag, 0, fontSize);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (hasFill)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::fillFlag, 0, fill);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (hasShaded)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::shadedFlag, 0, shaded);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (hasDrawOnTop)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::drawOnTopFlag, 0, drawOnTop);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (hasShapes)
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperEditCommand::shapesFlag, 0, shapes);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	unsigned int enabled = 0, disabled = 0;
+
+	status = this->getShapeFlags(argDatabase, PointHelperEditCommand::enableFlag, enabled);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->getShapeFlags(argDatabase, PointHelperEditCommand::disableFlag, disabled);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Queue plug edits
+	//
+	for (unsigned int i = 0; i < this->nodes.length(); i++)
+	{
+
+		MObject node = this->nodes[i];
+
+		if (hasSize)
+		{
+
+			this->dgModifier.newPlugValueDouble(MPlug(node, PointHelper::size), size);
+
+		}
+
+		if (hasLineWidth)
+		{
+
+			this->dgModifier.newPlugValueFloat(MPlug(node, PointHelper::lineWidth), static_cast<float>(lineWidth));
+
+		}
+
+		if (hasFontSize)
+		{
+
+			this->dgModifier.newPlugValueInt(MPlug(node, PointHelper::fontSize), fontSize);
+
+		}
+
+		if (hasFill)
+		{
+
+			this->dgModifier.newPlugValueBool(MPlug(node, PointHelper::fill), fill);
+
+		}
+
+		if (hasShaded)
+		{
+
+			this->dgModifier.newPlugValueBool(MPlug(node, PointHelper::shaded), shaded);
+
+		}
+
+		if (hasDrawOnTop)
+		{
+
+			this->dgModifier.newPlugValueBool(MPlug(node, PointHelper::drawOnTop), drawOnTop);
+
+		}
+
+		// Edit drawables with a single set of the packed flags
+		// Bit n of the mask toggles Drawable::Shape n
+		//
+		if (hasShapes || (enabled | disabled) != 0)
+		{
+
+			MPlug plug(node, PointHelper::shapeFlags);
+
+			unsigned int flags = hasShapes ? static_cast<unsigned int>(shapes) : static_cast<unsigned int>(PointHelper::getIntData(plug));
+			flags = (flags | enabled) & ~disabled;
+
+			this->dgModifier.newPlugValueInt(plug, static_cast<int>(flags));
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperEditCommand::getShapeFlags(const MArgDatabase& argDatabase, const char* flag, unsigned int& mask)
+/**
+Converts every use of a multi-use drawable name flag into a shape mask.
+
+@param argDatabase: The parsed command arguments.
+@param flag: The flag to collect.
+@param mask: The passed mask to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	const unsigned int numUses = argDatabase.numberOfFlagUses(flag);
+
+	MArgList argList;
+
+	for (unsigned int i = 0; i < numUses; i++)
+	{
+
+		status = argDatabase.getFlagArgumentList(flag, i, argList);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		unsigned int index = 0;
+
+		MString name = argList.asString(index, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		Drawable::Shape shape = Drawable::findShape(name);
+
+		if (shape == Drawable::Shape::Count)
+		{
+
+			MGlobal::displayError("pointHelperEdit: unknown drawable \"" + name + "\"!");
+			return MS::kInvalidParameter;
+
+		}
+
+		mask |= 1u << static_cast<unsigned int>(shape);
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperEditCommand::collectHelpers(const MSelectionList& selection, MObjectArray& nodes)
+/**
+Collects the point helper shapes from the supplied selection.
+Transforms contribute every point helper shape directly below them, and a shape selected along with its transform is only collected once.
+
+@param selection: The objects to search.
+@param nodes: The passed array to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MDagPath dagPath;
+	MFnDagNode fnDagNode;
+
+	std::unordered_set<MObjectHandle, ObjectHandleHash> collected;
+
+	for (unsigned int i = 0; i < selection.length(); i++)
+	{
+
+		status = selection.getDagPath(i, dagPath);
+
+		if (!status)
+		{
+
+			continue;
+
+		}
+
+		unsigned int numShapes = 0;
+		dagPath.numberOfShapesDirectlyBelow(numShapes);
+
+		for (unsigned int j = 0; j < std::max(numShapes, 1u); j++)
+		{
+
+			MDagPath shapePath(dagPath);
+
+			if (numShapes > 0)
+			{
+
+				status = shapePath.extendToShapeDirectlyBelow(j);
+				CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			}
+
+			status = fnDagNode.setObject(shapePath);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			if (fnDagNode.typeId() == PointHelper::id && collected.insert(MObjectHandle(shapePath.node())).second)
+			{
+
+				nodes.append(shapePath.node());
+
+			}
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperEditCommand::redoIt()
+/**
+Commits the queued edits.
+
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	PointHelper::suspendDrawDirty();
+
+	status = this->dgModifier.doIt();
+
+	PointHelper::resumeDrawDirty(this->nodes);
+
+	return status;
+
+};
+
+
+MStatus PointHelperEditCommand::undoIt()
+/**
+Restores the previous attribute values.
+
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	PointHelper::suspendDrawDirty();
+
+	status = this->dgModifier.undoIt();
+
+	PointHelper::resumeDrawDirty(this->nodes);
+
+	return status;
+
+};
+
+
+bool PointHelperEditCommand::isUndoable() const
+/**
+Every edit is undone as a single operation.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+void* PointHelperEditCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperEditCommand
+*/
+{
+
+	return new PointHelperEditCommand();
+
+};
+
+
+MSyntax PointHelperEditCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::sizeFlag, PointHelperEditCommand::sizeLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::lineWidthFlag, PointHelperEditCommand::lineWidthLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::fontSizeFlag, PointHelperEditCommand::fontSizeLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::fillFlag, PointHelperEditCommand::fillLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::shadedFlag, PointHelperEditCommand::shadedLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::drawOnTopFlag, PointHelperEditCommand::drawOnTopLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::shapesFlag, PointHelperEditCommand::shapesLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::enableFlag, PointHelperEditCommand::enableLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperEditCommand::disableFlag, PointHelperEditCommand::disableLongFlag, MSyntax::kString));
+
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperEditCommand::enableFlag));
+	CHECK_MSTATUS(syntax.makeFlagMultiUse(PointHelperEditCommand::disableFlag));
+
+	syntax.setObjectType(MSyntax::kSelectionList);
+	syntax.useSelectionAsDefault(true);
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
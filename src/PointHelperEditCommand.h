@@ -0,0 +1,75 @@
+#ifndef _POINT_HELPER_EDIT_COMMAND
+#define _POINT_HELPER_EDIT_COMMAND
+//
+// File: PointHelperEditCommand.h
+//
+// Command: pointHelperEdit
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperNode.h"
+#include "Drawable.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MDGModifier.h>
+#include <maya/MDagPath.h>
+#include <maya/MObjectArray.h>
+#include <maya/MSelectionList.h>
+#include <maya/MString.h>
+
+
+class PointHelperEditCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperEditCommand();
+	virtual						~PointHelperEditCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	MStatus				redoIt();
+	virtual	MStatus				undoIt();
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+	static	MStatus				collectHelpers(const MSelectionList& selection, MObjectArray& nodes);
+
+protected:
+
+			MStatus				queueEdits(const MArgDatabase& argDatabase);
+			MStatus				getShapeFlags(const MArgDatabase& argDatabase, const char* flag, unsigned int& mask);
+
+			MDGModifier			dgModifier;
+			MObjectArray		nodes;
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			sizeFlag;
+	static	const char*			sizeLongFlag;
+	static	const char*			lineWidthFlag;
+	static	const char*			lineWidthLongFlag;
+	static	const char*			fontSizeFlag;
+	static	const char*			fontSizeLongFlag;
+	static	const char*			fillFlag;
+	static	const char*			fillLongFlag;
+	static	const char*			shadedFlag;
+	static	const char*			shadedLongFlag;
+	static	const char*			drawOnTopFlag;
+	static	const char*			drawOnTopLongFlag;
+	static	const char*			shapesFlag;
+	static	const char*			shapesLongFlag;
+	static	const char*			enableFlag;
+	static	const char*			enableLongFlag;
+	static	const char*			disableFlag;
+	static	const char*			disableLongFlag;
+
+};
+#endif
@@ -0,0 +1,482 @@
+//
+// File: PointHelperExportCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperExportCommand.h"
+
+#include <maya/MGlobal.h>
+#include <maya/MSelectionList.h>
+#include <maya/MItDag.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MAnimControl.h>
+#include <maya/MTime.h>
+#include <maya/MMatrix.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+
+const MString	PointHelperExportCommand::commandName("pointHelperExport");
+
+const char*		PointHelperExportCommand::selectionFlag = "-sl";
+const char*		PointHelperExportCommand::selectionLongFlag = "-selection";
+const char*		PointHelperExportCommand::startFrameFlag = "-st";
+const char*		PointHelperExportCommand::startFrameLongFlag = "-startFrame";
+const char*		PointHelperExportCommand::endFrameFlag = "-e";
+const char*		PointHelperExportCommand::endFrameLongFlag = "-endFrame";
+const char*		PointHelperExportCommand::geometryFlag = "-g";
+const char*		PointHelperExportCommand::geometryLongFlag = "-geometry";
+const char*		PointHelperExportCommand::chunkSizeFlag = "-cs";
+const char*		PointHelperExportCommand::chunkSizeLongFlag = "-chunkSize";
+
+
+PointHelperExportCommand::PointHelperExportCommand() : MPxCommand()
+/**
+Constructor.
+*/
+{
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		this->drawables[i].reset(Drawable::AbstractDrawable::create(static_cast<Drawable::Shape>(i)));
+
+	}
+
+};
+
+
+PointHelperExportCommand::~PointHelperExportCommand() {};
+
+
+MStatus PointHelperExportCommand::doIt(const MArgList& args)
+/**
+Writes every point helper, or the selected ones, to a compact binary file. See Drawable::IO::ExportWriter for the layout.
+Records are written chunk by chunk so memory stays bounded however many helpers and frames are exported.
+The result is the number of records written.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MString filePath;
+
+	status = argDatabase.getCommandArgument(0, filePath);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	const MTime originalTime = MAnimControl::currentTime();
+	const double currentFrame = originalTime.as(MTime::uiUnit());
+
+	bool isAnimated = argDatabase.isFlagSet(PointHelperExportCommand::startFrameFlag) || argDatabase.isFlagSet(PointHelperExportCommand::endFrameFlag);
+	double startFrame = currentFrame;
+	double endFrame = currentFrame;
+
+	if (argDatabase.isFlagSet(PointHelperExportCommand::startFrameFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperExportCommand::startFrameFlag, 0, startFrame);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		endFrame = std::max(endFrame, startFrame);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperExportCommand::endFrameFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperExportCommand::endFrameFlag, 0, endFrame);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (endFrame < startFrame)
+	{
+
+		MGlobal::displayError("pointHelperExport: -endFrame must not be less than -startFrame!");
+		return MS::kInvalidParameter;
+
+	}
+
+	bool includeGeometry = true;
+
+	if (argDatabase.isFlagSet(PointHelperExportCommand::geometryFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperExportCommand::geometryFlag, 0, includeGeometry);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	size_t chunkSize = Drawable::IO::DEFAULT_CHUNK_SIZE;
+
+	if (argDatabase.isFlagSet(PointHelperExportCommand::chunkSizeFlag))
+	{
+
+		int megabytes = 0;
+
+		status = argDatabase.getFlagArgument(PointHelperExportCommand::chunkSizeFlag, 0, megabytes);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		chunkSize = size_t(std::max(1, megabytes)) * 1024 * 1024;
+
+	}
+
+	// Collect point helpers
+	//
+	MDagPathArray dagPaths;
+
+	status = this->collectHelpers(argDatabase.isFlagSet(PointHelperExportCommand::selectionFlag), dagPaths);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Open file and write helper names
+	//
+	std::ofstream stream(filePath.asChar(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+	if (!stream.is_open())
+	{
+
+		MGlobal::displayError("pointHelperExport: unable to open " + filePath);
+		return MS::kFailure;
+
+	}
+
+	Drawable::IO::ExportWriter writer(stream, chunkSize);
+
+	for (unsigned int i = 0; i < dagPaths.length(); i++)
+	{
+
+		writer.addHelper(dagPaths[i].fullPathName().asChar());
+
+	}
+
+	if (!writer.begin())
+	{
+
+		MGlobal::displayError("pointHelperExport: unable to write " + filePath);
+		return MS::kFailure;
+
+	}
+
+	// Write each frame
+	// The time is only changed for a frame range, and is always restored
+	//
+	const int numFrames = static_cast<int>(endFrame - startFrame) + 1;
+
+	for (int i = 0; i < numFrames; i++)
+	{
+
+		const double frame = startFrame + static_cast<double>(i);
+
+		if (isAnimated)
+		{
+
+			status = MAnimControl::setCurrentTime(MTime(frame, MTime::uiUnit()));
+
+			if (!status)
+			{
+
+				break;
+
+			}
+
+		}
+
+		status = this->writeFrame(writer, dagPaths, frame, includeGeometry);
+
+		if (!status)
+		{
+
+			break;
+
+		}
+
+	}
+
+	if (isAnimated)
+	{
+
+		MAnimControl::setCurrentTime(originalTime);
+
+	}
+
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (!writer.finish())
+	{
+
+		MGlobal::displayError("pointHelperExport: unable to write " + filePath);
+		return MS::kFailure;
+
+	}
+
+	this->setResult(static_cast<int>(writer.recordCount()));
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperExportCommand::writeFrame(Drawable::IO::ExportWriter& writer, const MDagPathArray& dagPaths, double frame, bool includeGeometry)
+/**
+Writes one record per point helper at the current time.
+Geometry is captured by preparing and drawing the enabled drawables into a capture draw manager, so it matches the viewport exactly.
+
+@param writer: The writer to append records to.
+@param dagPaths: The point helpers to write.
+@param frame: The frame stored with each record.
+@param includeGeometry: If true the prepared lines and triangles are written with each record.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MFnDagNode fnDagNode;
+	Drawable::IO::ExportRecord record;
+
+	for (unsigned int i = 0; i < dagPaths.length(); i++)
+	{
+
+		status = fnDagNode.setObject(dagPaths[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		PointHelper* pointHelper = dynamic_cast<PointHelper*>(fnDagNode.userNode());
+
+		if (pointHelper == nullptr)
+		{
+
+			continue;
+
+		}
+
+		pointHelper->copyInternalData(&this->pointHelperData);
+		this->pointHelperData.copyWireColor(dagPaths[i]);
+
+		// Copy transform and shape values
+		//
+		MMatrix worldMatrix = dagPaths[i].inclusiveMatrix();
+
+		record.helper = i;
+		record.frame = frame;
+		worldMatrix.get(record.worldMatrix.values);
+		record.shapeFlags = 0;
+		record.size = this->pointHelperData.size;
+		record.color[0] = this->pointHelperData.wireColor.r;
+		record.color[1] = this->pointHelperData.wireColor.g;
+		record.color[2] = this->pointHelperData.wireColor.b;
+		record.geometry = nullptr;
+
+		for (unsigned int j = 0; j < Drawable::NUM_SHAPES; j++)
+		{
+
+			if (this->pointHelperData.drawables[j])
+			{
+
+				record.shapeFlags |= (1u << j);
+
+			}
+
+		}
+
+		// Capture prepared geometry
+		//
+		if (includeGeometry)
+		{
+
+			this->captureDrawManager.reset();
+
+			for (unsigned int j = 0; j < Drawable::NUM_SHAPES; j++)
+			{
+
+				Drawable::AbstractDrawable* drawable = this->drawables[j].get();
+
+				if (drawable == nullptr || !this->pointHelperData.drawables[j])
+				{
+
+					continue;
+
+				}
+
+				drawable->setObjectMatrix(this->pointHelperData.objectMatrix);
+				drawable->prepareForDraw(dagPaths[i], MDagPath(), &this->pointHelperData);
+				drawable->draw(this->captureDrawManager, &this->pointHelperData);
+
+			}
+
+			record.geometry = &this->captureDrawManager.buffers();
+
+		}
+
+		if (!writer.write(record))
+		{
+
+			MGlobal::displayError("pointHelperExport: unable to write record!");
+			return MS::kFailure;
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperExportCommand::collectHelpers(bool selectionOnly, MDagPathArray& dagPaths)
+/**
+Collects paths to every point helper in the scene, or in the active selection.
+Selected transforms are expanded to the point helpers directly below them.
+
+@param selectionOnly: If true only the active selection is searched.
+@param dagPaths: The passed array to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MDagPath dagPath;
+	MFnDagNode fnDagNode;
+
+	if (selectionOnly)
+	{
+
+		MSelectionList selection;
+
+		status = MGlobal::getActiveSelectionList(selection);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		for (unsigned int i = 0; i < selection.length(); i++)
+		{
+
+			status = selection.getDagPath(i, dagPath);
+
+			if (!status)
+			{
+
+				continue;
+
+			}
+
+			unsigned int numShapes = 0;
+			dagPath.numberOfShapesDirectlyBelow(numShapes);
+
+			for (unsigned int j = 0; j < std::max(numShapes, 1u); j++)
+			{
+
+				MDagPath shapePath(dagPath);
+
+				if (numShapes > 0)
+				{
+
+					status = shapePath.extendToShapeDirectlyBelow(j);
+					CHECK_MSTATUS_AND_RETURN_IT(status);
+
+				}
+
+				status = fnDagNode.setObject(shapePath);
+				CHECK_MSTATUS_AND_RETURN_IT(status);
+
+				if (fnDagNode.typeId() == PointHelper::id)
+				{
+
+					dagPaths.append(shapePath);
+
+				}
+
+			}
+
+		}
+
+		return MS::kSuccess;
+
+	}
+
+	MItDag iterDag(MItDag::kDepthFirst, MFn::kPluginLocatorNode, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	for (; !iterDag.isDone(); iterDag.next())
+	{
+
+		status = iterDag.getPath(dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = fnDagNode.setObject(dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (fnDagNode.typeId() == PointHelper::id)
+		{
+
+			dagPaths.append(dagPath);
+
+		}
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+bool PointHelperExportCommand::isUndoable() const
+/**
+Exporting does not modify the scene so there is nothing to undo.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+void* PointHelperExportCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperExportCommand
+*/
+{
+
+	return new PointHelperExportCommand();
+
+};
+
+
+MSyntax PointHelperExportCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addArg(MSyntax::kString));
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperExportCommand::selectionFlag, PointHelperExportCommand::selectionLongFlag, MSyntax::kNoArg));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperExportCommand::startFrameFlag, PointHelperExportCommand::startFrameLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperExportCommand::endFrameFlag, PointHelperExportCommand::endFrameLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperExportCommand::geometryFlag, PointHelperExportCommand::geometryLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperExportCommand::chunkSizeFlag, PointHelperExportCommand::chunkSizeLongFlag, MSyntax::kLong));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
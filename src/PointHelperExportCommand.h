@@ -0,0 +1,67 @@
+#ifndef _POINT_HELPER_EXPORT_COMMAND
+#define _POINT_HELPER_EXPORT_COMMAND
+//
+// File: PointHelperExportCommand.h
+//
+// Command: pointHelperExport
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperNode.h"
+#include "PointHelperData.h"
+#include "AbstractDrawable.h"
+#include "CaptureDrawManager.h"
+#include "DrawableIO.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MDagPath.h>
+#include <maya/MDagPathArray.h>
+#include <maya/MString.h>
+
+#include <memory>
+
+
+class PointHelperExportCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperExportCommand();
+	virtual						~PointHelperExportCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+protected:
+
+			MStatus				collectHelpers(bool selectionOnly, MDagPathArray& dagPaths);
+			MStatus				writeFrame(Drawable::IO::ExportWriter& writer, const MDagPathArray& dagPaths, double frame, bool includeGeometry);
+
+			std::unique_ptr<Drawable::AbstractDrawable>	drawables[Drawable::NUM_SHAPES];
+			Drawable::CaptureDrawManager				captureDrawManager;
+			PointHelperData								pointHelperData;
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			selectionFlag;
+	static	const char*			selectionLongFlag;
+	static	const char*			startFrameFlag;
+	static	const char*			startFrameLongFlag;
+	static	const char*			endFrameFlag;
+	static	const char*			endFrameLongFlag;
+	static	const char*			geometryFlag;
+	static	const char*			geometryLongFlag;
+	static	const char*			chunkSizeFlag;
+	static	const char*			chunkSizeLongFlag;
+
+};
+#endif
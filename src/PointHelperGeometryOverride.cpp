@@ -0,0 +1,766 @@
+//
+// File: PointHelperGeometryOverride.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperGeometryOverride.h"
+#include "UIDrawManager.h"
+
+#include <cstdlib>
+#include <cstring>
+
+
+const char*		PointHelperGeometryOverride::ENABLE_VARIABLE = "POINT_HELPER_GEOMETRY_OVERRIDE";
+const MString	PointHelperGeometryOverride::LINES_ITEM_NAME("pointHelperLines");
+const MString	PointHelperGeometryOverride::TRIANGLES_ITEM_NAME("pointHelperTriangles");
+
+
+// Draw calls that cannot be stored in vertex buffers, drawables that make them are drawn through the UI draw manager
+//
+static const Drawable::DrawCall UI_CALLS[] =
+{
+	Drawable::DrawCall::Text,
+	Drawable::DrawCall::Icon,
+	Drawable::DrawCall::SetColor,
+	Drawable::DrawCall::SetFontSize
+};
+
+
+PointHelperGeometryOverride::PointHelperGeometryOverride(const MObject& node) : MPxGeometryOverride(node)
+/**
+Constructor.
+
+@param node: The Maya object this override draws.
+*/
+{
+
+	MStatus status;
+
+	// Store pointer to MPxLocator
+	//
+	MFnDependencyNode fnNode(node, &status);
+	CHECK_MSTATUS(status);
+
+	this->pointHelper = status ? dynamic_cast<PointHelper*>(fnNode.userNode()) : nullptr;
+
+	this->uiDrawables = 0;
+	this->inputHash = 0;
+	this->hasInputHash = false;
+	this->isGeometryDirty = true;
+	this->hasItemState = false;
+	this->shapeFileCallbackId = 0;
+
+	// Create one drawable per shape, ids match the shape flags copied into the data
+	//
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		this->drawables[i].reset(Drawable::AbstractDrawable::create(static_cast<Drawable::Shape>(i)));
+
+	}
+
+};
+
+
+PointHelperGeometryOverride::~PointHelperGeometryOverride()
+/**
+Destructor.
+*/
+{
+
+	this->pointHelper = nullptr;
+
+	// Remove shape file callback
+	//
+	if (this->shapeFileCallbackId != 0)
+	{
+
+		MMessage::removeCallback(this->shapeFileCallbackId);
+		this->shapeFileCallbackId = 0;
+
+	}
+
+	// Release shader instances
+	//
+	this->releaseShaders();
+
+};
+
+
+MHWRender::MPxGeometryOverride* PointHelperGeometryOverride::creator(const MObject& node)
+/**
+Static function used to create a new geometry override instance.
+This function is called via the MDrawRegistry::registerGeometryOverrideCreator() method.
+
+@param node: The Maya object this override draws.
+@return: MPxGeometryOverride*
+*/
+{
+
+	return new PointHelperGeometryOverride(node);
+
+};
+
+
+bool PointHelperGeometryOverride::isEnabled()
+/**
+Returns whether the retained path should be registered in place of the draw override.
+It is enabled by setting POINT_HELPER_GEOMETRY_OVERRIDE=1 before the plugin loads.
+
+@return: bool
+*/
+{
+
+	const char* value = std::getenv(PointHelperGeometryOverride::ENABLE_VARIABLE);
+	return value != nullptr && std::strcmp(value, "1") == 0;
+
+};
+
+
+void PointHelperGeometryOverride::onShapeFileIdle(void* clientData)
+/**
+Idle callback used while this locator's shape file loads on a worker thread.
+Once the file has loaded, or failed to, the node is marked dirty so the shape replaces the bounding-box and the callback removes itself.
+
+@param clientData: Pointer to the geometry override instance.
+@return: void
+*/
+{
+
+	// Check if client data is null
+	//
+	if (clientData == NULL)
+	{
+
+		return;
+
+	}
+
+	PointHelperGeometryOverride* geometryOverride = static_cast<PointHelperGeometryOverride*>(clientData);
+
+	if (geometryOverride->pointHelper == NULL)
+	{
+
+		return;
+
+	}
+
+	// Check if the shape file is still loading
+	//
+	std::shared_ptr<const Drawable::Library::ShapeAsset> asset;
+
+	if (geometryOverride->pointHelper->getShapeAsset(asset) == Drawable::Library::AssetState::Pending)
+	{
+
+		return;
+
+	}
+
+	MMessage::removeCallback(geometryOverride->shapeFileCallbackId);
+	geometryOverride->shapeFileCallbackId = 0;
+
+	MHWRender::MRenderer::setGeometryDrawDirty(geometryOverride->pointHelper->thisMObject());
+
+};
+
+
+MHWRender::DrawAPI PointHelperGeometryOverride::supportedDrawAPIs() const
+/**
+Returns the draw API supported by this override.
+
+@return: MHWRender::DrawAPI
+*/
+{
+
+	return (MHWRender::kOpenGL | MHWRender::kDirectX11 | MHWRender::kOpenGLCoreProfile);
+
+};
+
+
+void PointHelperGeometryOverride::updateDG()
+/**
+Copies the node's internal data, this is the only stage that may pull data from the dependency graph.
+The buffers are only rebuilt when the geometry inputs changed since the last update.
+
+@return: void
+*/
+{
+
+	if (this->pointHelper == nullptr)
+	{
+
+		return;
+
+	}
+
+	this->pointHelper->copyInternalData(&this->pointHelperData);
+
+	// Redraw once a loading shape file is ready
+	//
+	if (this->pointHelperData.isShapePending && this->shapeFileCallbackId == 0)
+	{
+
+		MStatus status;
+
+		this->shapeFileCallbackId = MEventMessage::addEventCallback("idle", PointHelperGeometryOverride::onShapeFileIdle, this, &status);
+		CHECK_MSTATUS(status);
+
+	}
+
+	// Compare against the inputs of the current buffers
+	// Spheres are captured as wireframe lines without fill so it is hashed as well
+	//
+	bool fill = this->pointHelperData.fill;
+	uint64_t inputHash = Drawable::Core::hashBytes(&fill, sizeof(fill), this->pointHelperData.geometryHash());
+
+	if (this->hasInputHash && inputHash == this->inputHash)
+	{
+
+		return;
+
+	}
+
+	this->inputHash = inputHash;
+	this->hasInputHash = true;
+
+	this->rebuildBuffers();
+
+};
+
+
+void PointHelperGeometryOverride::rebuildBuffers()
+/**
+Captures every enabled drawable in object space and welds the capture into indexed buffers.
+The drawables bake in the helper's local transform, the DAG transform is applied by Viewport 2.0.
+Drawables that submit text or icons are left out of the capture and drawn by addUIDrawables() instead.
+
+@return: void
+*/
+{
+
+	Drawable::CaptureDrawManager captureDrawManager;
+	PointHelperData& data = this->pointHelperData;
+
+	// Capture with the helper's fill so spheres become wireframe without it
+	// Normals are always captured, the shaded flag only picks the shader
+	//
+	bool shaded = data.shaded;
+
+	data.shaded = true;
+	captureDrawManager.setSphereFill(data.fill);
+
+	this->uiDrawables = 0;
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		Drawable::AbstractDrawable* drawable = this->drawables[i].get();
+
+		if (drawable == nullptr || !data.drawables[i])
+		{
+
+			continue;
+
+		}
+
+		drawable->setObjectMatrix(data.objectMatrix);
+		drawable->prepareForDraw(MDagPath(), MDagPath(), &data);
+
+		// Capture drawable
+		//
+		size_t numTriangles = captureDrawManager.buffers().triangles.size();
+		size_t numLines = captureDrawManager.buffers().lines.size();
+		uint64_t numUICalls = 0;
+
+		for (Drawable::DrawCall call : UI_CALLS)
+		{
+
+			numUICalls += captureDrawManager.callCount(call);
+
+		}
+
+		drawable->draw(captureDrawManager, &data);
+
+		for (Drawable::DrawCall call : UI_CALLS)
+		{
+
+			numUICalls -= captureDrawManager.callCount(call);
+
+		}
+
+		if (numUICalls != 0)
+		{
+
+			captureDrawManager.rewind(numTriangles, numLines);
+			this->uiDrawables |= 1u << i;
+
+		}
+
+	}
+
+	data.shaded = shaded;
+
+	Drawable::Core::buildIndexedBuffers(captureDrawManager.buffers(), this->buffers);
+	this->isGeometryDirty = true;
+
+};
+
+
+bool PointHelperGeometryOverride::requiresGeometryUpdate() const
+/**
+Returns whether populateGeometry() needs to be called, which is only the case after the buffers were rebuilt.
+
+@return: bool
+*/
+{
+
+	return this->isGeometryDirty;
+
+};
+
+
+bool PointHelperGeometryOverride::RenderItemState::operator!=(const RenderItemState& other) const
+/**
+Inequality operator.
+
+@param other: The state to compare against.
+@return: bool
+*/
+{
+
+	return this->color != other.color || this->depthPriority != other.depthPriority || this->lineWidth != other.lineWidth || this->fill != other.fill || this->shaded != other.shaded || this->hasLines != other.hasLines || this->hasTriangles != other.hasTriangles;
+
+};
+
+
+PointHelperGeometryOverride::RenderItemState PointHelperGeometryOverride::renderItemState(const MDagPath& path) const
+/**
+Returns the state the render items of the supplied instance should be drawn with.
+Draw on top has no x-ray pass here so it raises the depth priority instead.
+
+@param path: The path to the instance being drawn.
+@return: RenderItemState
+*/
+{
+
+	RenderItemState state;
+
+	state.color = MHWRender::MGeometryUtilities::wireframeColor(path);
+	state.depthPriority = MHWRender::MRenderItem::sDormantFilledDepthPriority;
+	state.lineWidth = this->pointHelperData.lineWidth;
+	state.fill = this->pointHelperData.fill;
+	state.shaded = this->pointHelperData.shaded;
+	state.hasLines = !this->buffers.lineIndices.empty();
+	state.hasTriangles = !this->buffers.triangleIndices.empty();
+
+	if (this->pointHelperData.drawOnTop)
+	{
+
+		state.depthPriority = MHWRender::MRenderItem::sActivePointDepthPriority;
+
+	}
+	else if (MHWRender::MGeometryUtilities::displayStatus(path) == MHWRender::DisplayStatus::kActiveComponent)
+	{
+
+		state.depthPriority = MHWRender::MRenderItem::sActiveWireDepthPriority;
+
+	}
+
+	return state;
+
+};
+
+
+bool PointHelperGeometryOverride::requiresUpdateRenderItems(const MDagPath& path) const
+/**
+Returns whether updateRenderItems() needs to be called.
+This is only the case when the wire color, which changes with the selection, or anything else the items are drawn with changed since the last update.
+
+@param path: The path to the instance being drawn.
+@return: bool
+*/
+{
+
+	return !this->hasItemState || this->renderItemState(path) != this->itemState;
+
+};
+
+
+void PointHelperGeometryOverride::updateShader(MHWRender::MRenderItem* item, bool isTriangles, bool isNewItem, const RenderItemState& state)
+/**
+Assigns a stock shader with the helper's color to a render item.
+Each item keeps its shader instance, a new one is only acquired when the stock shader changes and parameters are only set when they change.
+Items with the same shader and color can be consolidated by Viewport 2.0.
+
+@param item: The render item to update.
+@param isTriangles: If true, the item draws the filled triangles.
+@param isNewItem: If true, the item was just created and has no shader yet.
+@param state: The state to draw with.
+@return: void
+*/
+{
+
+	MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
+	const MHWRender::MShaderManager* shaderManager = (renderer != nullptr) ? renderer->getShaderManager() : nullptr;
+
+	if (shaderManager == nullptr)
+	{
+
+		return;
+
+	}
+
+	bool isShaded = isTriangles && state.shaded;
+	bool isThick = !isTriangles && state.lineWidth > 1.0f;
+
+	MHWRender::MShaderManager::MStockShader stockShader = isShaded ? MHWRender::MShaderManager::k3dBlinnShader : (isThick ? MHWRender::MShaderManager::k3dThickLineShader : MHWRender::MShaderManager::k3dSolidShader);
+	ItemShader& itemShader = this->itemShaders[isTriangles ? 1 : 0];
+
+	// Acquire a new shader instance when the stock shader changes
+	//
+	bool isNewShader = itemShader.shader == nullptr || itemShader.stockShader != stockShader;
+
+	if (isNewShader)
+	{
+
+		if (itemShader.shader != nullptr)
+		{
+
+			shaderManager->releaseShader(itemShader.shader);
+
+		}
+
+		itemShader.shader = shaderManager->getStockShader(stockShader);
+		itemShader.stockShader = stockShader;
+
+		if (itemShader.shader == nullptr)
+		{
+
+			return;
+
+		}
+
+	}
+
+	// Update parameters
+	//
+	if (isNewShader || itemShader.color != state.color)
+	{
+
+		const float values[4] = { state.color.r, state.color.g, state.color.b, state.color.a };
+		CHECK_MSTATUS(itemShader.shader->setParameter(isShaded ? "diffuseColor" : "solidColor", values));
+
+		itemShader.color = state.color;
+
+	}
+
+	if (isThick && (isNewShader || itemShader.lineWidth != state.lineWidth))
+	{
+
+		const float lineWidth[2] = { state.lineWidth, state.lineWidth };
+		CHECK_MSTATUS(itemShader.shader->setParameter("lineWidth", lineWidth));
+
+		itemShader.lineWidth = state.lineWidth;
+
+	}
+
+	if (isNewShader || isNewItem)
+	{
+
+		item->setShader(itemShader.shader);
+
+	}
+
+};
+
+
+void PointHelperGeometryOverride::releaseShaders()
+/**
+Releases the shader instances held for the render items.
+
+@return: void
+*/
+{
+
+	MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
+	const MHWRender::MShaderManager* shaderManager = (renderer != nullptr) ? renderer->getShaderManager() : nullptr;
+
+	for (ItemShader& itemShader : this->itemShaders)
+	{
+
+		if (itemShader.shader != nullptr && shaderManager != nullptr)
+		{
+
+			shaderManager->releaseShader(itemShader.shader);
+
+		}
+
+		itemShader.shader = nullptr;
+
+	}
+
+};
+
+
+void PointHelperGeometryOverride::updateRenderItems(const MDagPath& path, MHWRender::MRenderItemList& list)
+/**
+Creates the line and triangle render items and updates their shaders and visibility.
+
+@param path: The path to the instance being drawn.
+@param list: The render items of this override.
+@return: void
+*/
+{
+
+	RenderItemState state = this->renderItemState(path);
+
+	for (int i = 0; i < 2; i++)
+	{
+
+		bool isTriangles = (i == 1);
+		const MString& name = isTriangles ? PointHelperGeometryOverride::TRIANGLES_ITEM_NAME : PointHelperGeometryOverride::LINES_ITEM_NAME;
+
+		// Find or create render item
+		//
+		MHWRender::MRenderItem* item;
+		int index = list.indexOf(name);
+		bool isNewItem = (index < 0);
+
+		if (isNewItem)
+		{
+
+			item = MHWRender::MRenderItem::Create(name, MHWRender::MRenderItem::DecorationItem, isTriangles ? MHWRender::MGeometry::kTriangles : MHWRender::MGeometry::kLines);
+			item->setDrawMode(MHWRender::MGeometry::kAll);
+			item->setWantConsolidation(true);
+
+			list.append(item);
+
+		}
+		else
+		{
+
+			item = list.itemAt(index);
+
+		}
+
+		// Update visibility and appearance
+		//
+		bool isVisible = isTriangles ? (state.fill && state.hasTriangles) : state.hasLines;
+
+		item->enable(isVisible);
+		item->depthPriority(state.depthPriority);
+
+		if (isVisible)
+		{
+
+			this->updateShader(item, isTriangles, isNewItem, state);
+
+		}
+
+	}
+
+	this->itemState = state;
+	this->hasItemState = true;
+
+};
+
+
+void PointHelperGeometryOverride::populateGeometry(const MHWRender::MGeometryRequirements& requirements, const MHWRender::MRenderItemList& renderItems, MHWRender::MGeometry& data)
+/**
+Copies the indexed buffers into the vertex and index buffers requested by Viewport 2.0.
+
+@param requirements: The vertex buffers required by the render items' shaders.
+@param renderItems: The render items to create index buffers for.
+@param data: The geometry to populate.
+@return: void
+*/
+{
+
+	this->isGeometryDirty = false;
+
+	const unsigned int numVertices = static_cast<unsigned int>(this->buffers.numVertices());
+
+	if (numVertices == 0)
+	{
+
+		return;
+
+	}
+
+	// Fill vertex buffers
+	//
+	const MHWRender::MVertexBufferDescriptorList& descriptors = requirements.vertexRequirements();
+	MHWRender::MVertexBufferDescriptor descriptor;
+
+	for (int i = 0; i < descriptors.length(); i++)
+	{
+
+		if (!descriptors.getDescriptor(i, descriptor))
+		{
+
+			continue;
+
+		}
+
+		const std::vector<float>* source = nullptr;
+
+		switch (descriptor.semantic())
+		{
+
+		case MHWRender::MGeometry::kPosition: source = &this->buffers.positions; break;
+		case MHWRender::MGeometry::kNormal: source = &this->buffers.normals; break;
+		default: break;
+
+		}
+
+		if (source == nullptr || descriptor.dimension() != 3)
+		{
+
+			continue;
+
+		}
+
+		MHWRender::MVertexBuffer* vertexBuffer = data.createVertexBuffer(descriptor);
+		float* vertices = (vertexBuffer != nullptr) ? static_cast<float*>(vertexBuffer->acquire(numVertices, true)) : nullptr;
+
+		if (vertices != nullptr)
+		{
+
+			std::memcpy(vertices, source->data(), source->size() * sizeof(float));
+			vertexBuffer->commit(vertices);
+
+		}
+
+	}
+
+	// Fill index buffers
+	//
+	for (int i = 0; i < renderItems.length(); i++)
+	{
+
+		const MHWRender::MRenderItem* item = renderItems.itemAt(i);
+
+		if (item == nullptr)
+		{
+
+			continue;
+
+		}
+
+		const std::vector<uint32_t>& indices = (item->name() == PointHelperGeometryOverride::TRIANGLES_ITEM_NAME) ? this->buffers.triangleIndices : this->buffers.lineIndices;
+
+		if (indices.empty())
+		{
+
+			continue;
+
+		}
+
+		MHWRender::MIndexBuffer* indexBuffer = data.createIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
+		uint32_t* buffer = (indexBuffer != nullptr) ? static_cast<uint32_t*>(indexBuffer->acquire(static_cast<unsigned int>(indices.size()), true)) : nullptr;
+
+		if (buffer != nullptr)
+		{
+
+			std::memcpy(buffer, indices.data(), indices.size() * sizeof(uint32_t));
+			indexBuffer->commit(buffer);
+
+			item->associateWithIndexBuffer(indexBuffer);
+
+		}
+
+	}
+
+};
+
+
+void PointHelperGeometryOverride::cleanUp()
+/**
+Called after populateGeometry(), the indexed buffers are kept so they can be uploaded again without recapturing.
+
+@return: void
+*/
+{
+
+	return;
+
+};
+
+
+bool PointHelperGeometryOverride::hasUIDrawables() const
+/**
+Returns whether addUIDrawables() should be called, text and drawables that submit text or icons are the only parts of a helper that are not retained.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+void PointHelperGeometryOverride::addUIDrawables(const MDagPath& path, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext)
+/**
+Draws the helper's text and any drawables that submit text or icons, which cannot be stored in vertex buffers.
+
+@param path: The path to the instance being drawn.
+@param drawManager: The UI draw manager.
+@param frameContext: Frame level context information.
+@return: void
+*/
+{
+
+	MColor color = MHWRender::MGeometryUtilities::wireframeColor(path);
+
+	// Draw drawables that were left out of the buffers
+	// Each one starts from the helper's draw properties since they may change the color or font size
+	//
+	if (this->uiDrawables != 0)
+	{
+
+		Drawable::UIDrawManager uiDrawManager(drawManager);
+
+		for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+		{
+
+			if ((this->uiDrawables & (1u << i)) == 0)
+			{
+
+				continue;
+
+			}
+
+			uiDrawManager.beginDrawable();
+
+			uiDrawManager.setColor(color);
+			uiDrawManager.setLineWidth(this->pointHelperData.lineWidth);
+			uiDrawManager.setLineStyle(MHWRender::MUIDrawManager::kSolid);
+
+			this->drawables[i]->draw(uiDrawManager, &this->pointHelperData);
+
+			uiDrawManager.endDrawable();
+
+		}
+
+	}
+
+	// Draw text
+	//
+	if (this->pointHelperData.text.length() == 0)
+	{
+
+		return;
+
+	}
+
+	drawManager.beginDrawable();
+
+	drawManager.setColor(color);
+	drawManager.setFontSize(this->pointHelperData.fontSize);
+	drawManager.text(MPoint::origin, this->pointHelperData.text, MHWRender::MUIDrawManager::kCenter);
+
+	drawManager.endDrawable();
+
+};
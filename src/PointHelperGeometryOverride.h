@@ -0,0 +1,123 @@
+#ifndef _POINT_HELPER_GEOMETRY_OVERRIDE
+#define _POINT_HELPER_GEOMETRY_OVERRIDE
+//
+// File: PointHelperGeometryOverride.h
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperNode.h"
+#include "PointHelperData.h"
+#include "AbstractDrawable.h"
+#include "CaptureDrawManager.h"
+
+#include <maya/MPxGeometryOverride.h>
+#include <maya/MObject.h>
+#include <maya/MDagPath.h>
+#include <maya/MString.h>
+#include <maya/MColor.h>
+#include <maya/MCallbackId.h>
+#include <maya/MMessage.h>
+#include <maya/MEventMessage.h>
+#include <maya/MFnDependencyNode.h>
+
+#include <maya/MViewport2Renderer.h>
+#include <maya/MUIDrawManager.h>
+#include <maya/MFrameContext.h>
+#include <maya/MHWGeometry.h>
+#include <maya/MHWGeometryUtilities.h>
+#include <maya/MShaderManager.h>
+
+#include <memory>
+
+
+class PointHelperGeometryOverride : public MHWRender::MPxGeometryOverride
+/**
+Retained Viewport 2.0 path for point helpers.
+The enabled shapes are captured once into persistent vertex and index buffers, and the DAG transform is left to Viewport 2.0 so static helpers can be consolidated.
+Buffers are only rebuilt when the inputs hashed by PointHelperData::geometryHash(), or the fill, change.
+Drawables that submit text or icons cannot be retained so they are drawn through the UI draw manager instead.
+*/
+{
+
+public:
+
+									PointHelperGeometryOverride(const MObject& node);
+	virtual							~PointHelperGeometryOverride();
+
+	static	MPxGeometryOverride*	creator(const MObject& node);
+	static	bool					isEnabled();
+
+	virtual	MHWRender::DrawAPI		supportedDrawAPIs() const;
+
+	virtual	void					updateDG();
+	virtual	bool					requiresGeometryUpdate() const;
+	virtual	bool					requiresUpdateRenderItems(const MDagPath& path) const;
+	virtual	void					updateRenderItems(const MDagPath& path, MHWRender::MRenderItemList& list);
+	virtual	void					populateGeometry(const MHWRender::MGeometryRequirements& requirements, const MHWRender::MRenderItemList& renderItems, MHWRender::MGeometry& data);
+	virtual	void					cleanUp();
+
+	virtual	bool					hasUIDrawables() const;
+	virtual	void					addUIDrawables(const MDagPath& path, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext);
+
+	static	const char*				ENABLE_VARIABLE;
+	static	const MString			LINES_ITEM_NAME;
+	static	const MString			TRIANGLES_ITEM_NAME;
+
+private:
+
+	struct RenderItemState
+	/**
+	Everything the render items' visibility and shaders are updated from.
+	*/
+	{
+
+		MColor			color;
+		unsigned int	depthPriority = 0;
+		float			lineWidth = 0.0f;
+		bool			fill = false;
+		bool			shaded = false;
+		bool			hasLines = false;
+		bool			hasTriangles = false;
+
+		bool			operator!=(const RenderItemState& other) const;
+
+	};
+
+	struct ItemShader
+	/**
+	A render item's shader instance along with the parameters last set on it.
+	*/
+	{
+
+		MHWRender::MShaderInstance*					shader = nullptr;
+		MHWRender::MShaderManager::MStockShader		stockShader = MHWRender::MShaderManager::k3dSolidShader;
+		MColor										color;
+		float										lineWidth = 0.0f;
+
+	};
+
+			void					rebuildBuffers();
+			RenderItemState			renderItemState(const MDagPath& path) const;
+			void					updateShader(MHWRender::MRenderItem* item, bool isTriangles, bool isNewItem, const RenderItemState& state);
+			void					releaseShaders();
+
+			PointHelper*											pointHelper;
+			PointHelperData											pointHelperData;
+			std::unique_ptr<Drawable::AbstractDrawable>				drawables[Drawable::NUM_SHAPES];
+
+			Drawable::Core::IndexedBuffers							buffers;
+			unsigned int											uiDrawables;
+			uint64_t												inputHash;
+			bool													hasInputHash;
+			bool													isGeometryDirty;
+
+			RenderItemState											itemState;
+			bool													hasItemState;
+			ItemShader												itemShaders[2];
+
+			MCallbackId							shapeFileCallbackId;
+	static	void								onShapeFileIdle(void *clientData);
+
+};
+#endif
@@ -0,0 +1,476 @@
+//
+// File: PointHelperImportCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperImportCommand.h"
+
+#include <maya/MGlobal.h>
+#include <maya/MSelectionList.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MFnMatrixArrayData.h>
+#include <maya/MFnVectorArrayData.h>
+#include <maya/MFnIntArrayData.h>
+#include <maya/MPlug.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+
+const MString	PointHelperImportCommand::commandName("pointHelperImport");
+
+const char*		PointHelperImportCommand::formatFlag = "-fmt";
+const char*		PointHelperImportCommand::formatLongFlag = "-format";
+const char*		PointHelperImportCommand::shapesFlag = "-sh";
+const char*		PointHelperImportCommand::shapesLongFlag = "-shapes";
+const char*		PointHelperImportCommand::colorsFlag = "-cl";
+const char*		PointHelperImportCommand::colorsLongFlag = "-colors";
+const char*		PointHelperImportCommand::nodeFlag = "-n";
+const char*		PointHelperImportCommand::nodeLongFlag = "-node";
+const char*		PointHelperImportCommand::chunkSizeFlag = "-cs";
+const char*		PointHelperImportCommand::chunkSizeLongFlag = "-chunkSize";
+
+
+PointHelperImportCommand::PointHelperImportCommand() : MPxCommand()
+/**
+Constructor.
+*/
+{
+
+	this->numRecords = 0;
+	this->numErrors = 0;
+
+};
+
+
+PointHelperImportCommand::~PointHelperImportCommand() {};
+
+
+MStatus PointHelperImportCommand::doIt(const MArgList& args)
+/**
+Streams helper transforms from a binary or CSV file into a point helper array in a single undoable step.
+The file is read in fixed-size chunks that are decoded in parallel, so its contents are never held in memory as a whole.
+The result is the name of the point helper array.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MString filePath;
+
+	status = argDatabase.getCommandArgument(0, filePath);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Default to CSV for .csv files and double matrices for anything else
+	//
+	MString extension = (filePath.length() >= 4) ? filePath.substring(filePath.length() - 4, filePath.length() - 1).toLowerCase() : MString("");
+	MString format = (extension == ".csv") ? "csv" : "m44d";
+
+	if (argDatabase.isFlagSet(PointHelperImportCommand::formatFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperImportCommand::formatFlag, 0, format);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	bool hasShapes = false;
+
+	if (argDatabase.isFlagSet(PointHelperImportCommand::shapesFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperImportCommand::shapesFlag, 0, hasShapes);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	bool hasColors = false;
+
+	if (argDatabase.isFlagSet(PointHelperImportCommand::colorsFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperImportCommand::colorsFlag, 0, hasColors);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	size_t chunkSize = Drawable::IO::DEFAULT_CHUNK_SIZE;
+
+	if (argDatabase.isFlagSet(PointHelperImportCommand::chunkSizeFlag))
+	{
+
+		int megabytes = 0;
+
+		status = argDatabase.getFlagArgument(PointHelperImportCommand::chunkSizeFlag, 0, megabytes);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		chunkSize = size_t(std::max(1, megabytes)) * 1024 * 1024;
+
+	}
+
+	// Stream records
+	//
+	status = this->readRecords(filePath, format, hasShapes, hasColors, chunkSize);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (this->numErrors > 0)
+	{
+
+		MString message("pointHelperImport: skipped ");
+		message += static_cast<int>(this->numErrors);
+		message += " rows that could not be parsed!";
+
+		MGlobal::displayWarning(message);
+
+	}
+
+	// Find or create the point helper array
+	//
+	MObject node;
+
+	status = this->getArrayNode(argDatabase, node);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Queue array edits
+	//
+	MFnMatrixArrayData fnMatrixArrayData;
+	MObject matrixData = fnMatrixArrayData.create(this->matrices, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->dagModifier.newPlugValue(MPlug(node, PointHelperArray::matrices), matrixData);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MFnVectorArrayData fnVectorArrayData;
+	MObject colorData = fnVectorArrayData.create(this->colors, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->dagModifier.newPlugValue(MPlug(node, PointHelperArray::colors), colorData);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MFnIntArrayData fnIntArrayData;
+	MObject shapeData = fnIntArrayData.create(this->shapeMasks, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->dagModifier.newPlugValue(MPlug(node, PointHelperArray::shapeMasks), shapeData);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// The modifier holds its own copies so release ours
+	//
+	this->matrices.clear();
+	this->colors.clear();
+	this->shapeMasks.clear();
+
+	status = this->dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MFnDagNode fnDagNode(node, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	this->setResult(fnDagNode.partialPathName());
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperImportCommand::readRecords(const MString& filePath, const MString& format, bool hasShapes, bool hasColors, size_t chunkSize)
+/**
+Streams the records from the supplied file into the command's arrays.
+
+@param filePath: The file to read.
+@param format: Either "csv" or a binary record layout, see Drawable::IO::parseRecordLayout().
+@param hasShapes: If true every binary record ends with a shape mask.
+@param hasColors: If true every binary record ends with a color.
+@param chunkSize: The number of bytes read per chunk.
+@return: Return status.
+*/
+{
+
+	const bool isCsv = (format == "csv");
+	std::ifstream stream(filePath.asChar(), isCsv ? std::ios::in : (std::ios::in | std::ios::binary));
+
+	if (!stream.is_open())
+	{
+
+		MGlobal::displayError("pointHelperImport: unable to open " + filePath);
+		return MS::kFailure;
+
+	}
+
+	this->numRecords = 0;
+	this->numErrors = 0;
+
+	auto consume = [this](const Drawable::IO::HelperRecords& records)
+	{
+
+		this->appendRecords(records);
+
+	};
+
+	std::string error;
+	bool succeeded = false;
+
+	if (isCsv)
+	{
+
+		succeeded = Drawable::IO::readCsvRecords(stream, chunkSize, consume, this->numErrors, error);
+
+	}
+	else
+	{
+
+		Drawable::IO::RecordFormat recordFormat;
+		recordFormat.shapes = hasShapes;
+		recordFormat.colors = hasColors;
+
+		if (!Drawable::IO::parseRecordLayout(format.asChar(), recordFormat.layout))
+		{
+
+			MGlobal::displayError("pointHelperImport: -format must be csv, m44d, m44f, trsd or trsf!");
+			return MS::kInvalidParameter;
+
+		}
+
+		// The record count is known up front so the arrays only allocate once
+		//
+		stream.seekg(0, std::ios::end);
+		const size_t numBytes = static_cast<size_t>(stream.tellg());
+		stream.seekg(0, std::ios::beg);
+
+		const unsigned int numExpected = static_cast<unsigned int>(numBytes / recordFormat.recordSize());
+
+		this->matrices.setLength(numExpected);
+		this->shapeMasks.setLength(hasShapes ? numExpected : 0);
+		this->colors.setLength(hasColors ? numExpected : 0);
+
+		succeeded = Drawable::IO::readBinaryRecords(stream, recordFormat, chunkSize, consume, error);
+
+	}
+
+	if (!succeeded)
+	{
+
+		MGlobal::displayError(MString("pointHelperImport: ") + error.c_str());
+		return MS::kFailure;
+
+	}
+
+	// Trim any spare capacity
+	//
+	this->matrices.setLength(this->numRecords);
+	this->shapeMasks.setLength(std::min(this->shapeMasks.length(), this->numRecords));
+	this->colors.setLength(std::min(this->colors.length(), this->numRecords));
+
+	return MS::kSuccess;
+
+};
+
+
+void PointHelperImportCommand::appendRecords(const Drawable::IO::HelperRecords& records)
+/**
+Appends a chunk of decoded records to the command's arrays.
+Arrays grow geometrically when the record count was not known up front.
+
+@param records: The decoded records.
+@return: void
+*/
+{
+
+	const unsigned int offset = this->numRecords;
+	const unsigned int count = static_cast<unsigned int>(records.size());
+	const unsigned int required = offset + count;
+
+	if (this->matrices.length() < required)
+	{
+
+		const unsigned int capacity = std::max(required, this->matrices.length() * 2);
+
+		this->matrices.setLength(capacity);
+		this->shapeMasks.setLength(records.shapeMasks.empty() ? 0 : capacity);
+		this->colors.setLength(records.colors.empty() ? 0 : capacity);
+
+	}
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+
+		this->matrices[offset + i] = MMatrix(records.matrices[i].values);
+
+	}
+
+	for (unsigned int i = 0; i < static_cast<unsigned int>(records.shapeMasks.size()); i++)
+	{
+
+		this->shapeMasks[offset + i] = records.shapeMasks[i];
+
+	}
+
+	for (unsigned int i = 0; i < static_cast<unsigned int>(records.colors.size()); i++)
+	{
+
+		const Drawable::Core::VectorD& color = records.colors[i];
+		this->colors[offset + i] = MVector(color.x, color.y, color.z);
+
+	}
+
+	this->numRecords = required;
+
+};
+
+
+MStatus PointHelperImportCommand::getArrayNode(const MArgDatabase& argDatabase, MObject& node)
+/**
+Returns the point helper array named by the node flag, or creates a new one.
+Transforms are expanded to the point helper array directly below them.
+
+@param argDatabase: The parsed command arguments.
+@param node: The passed object to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	if (argDatabase.isFlagSet(PointHelperImportCommand::nodeFlag))
+	{
+
+		MString name;
+
+		status = argDatabase.getFlagArgument(PointHelperImportCommand::nodeFlag, 0, name);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MSelectionList selection;
+		MDagPath dagPath;
+
+		status = selection.add(name);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = selection.getDagPath(0, dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = dagPath.extendToShape();
+		node = dagPath.node();
+
+		if (!status || MFnDependencyNode(node).typeId() != PointHelperArray::id)
+		{
+
+			MGlobal::displayError("pointHelperImport: " + name + " is not a pointHelperArray!");
+			return MS::kInvalidParameter;
+
+		}
+
+		return MS::kSuccess;
+
+	}
+
+	// Create transform with a point helper array shape
+	//
+	MObject transform = this->dagModifier.createNode("pointHelperArray", MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	MDagPath dagPath;
+
+	status = MDagPath::getAPathTo(transform, dagPath);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = dagPath.extendToShape();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	node = dagPath.node();
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperImportCommand::redoIt()
+/**
+Recreates the array and restores the imported values.
+
+@return: Return status.
+*/
+{
+
+	return this->dagModifier.doIt();
+
+};
+
+
+MStatus PointHelperImportCommand::undoIt()
+/**
+Restores the previous array values, or deletes the created array.
+
+@return: Return status.
+*/
+{
+
+	return this->dagModifier.undoIt();
+
+};
+
+
+bool PointHelperImportCommand::isUndoable() const
+/**
+The import is a single undo chunk.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+void* PointHelperImportCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperImportCommand
+*/
+{
+
+	return new PointHelperImportCommand();
+
+};
+
+
+MSyntax PointHelperImportCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addArg(MSyntax::kString));
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperImportCommand::formatFlag, PointHelperImportCommand::formatLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperImportCommand::shapesFlag, PointHelperImportCommand::shapesLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperImportCommand::colorsFlag, PointHelperImportCommand::colorsLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperImportCommand::nodeFlag, PointHelperImportCommand::nodeLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperImportCommand::chunkSizeFlag, PointHelperImportCommand::chunkSizeLongFlag, MSyntax::kLong));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
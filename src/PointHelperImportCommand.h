@@ -0,0 +1,73 @@
+#ifndef _POINT_HELPER_IMPORT_COMMAND
+#define _POINT_HELPER_IMPORT_COMMAND
+//
+// File: PointHelperImportCommand.h
+//
+// Command: pointHelperImport
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperArrayNode.h"
+#include "DrawableIO.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MDagModifier.h>
+#include <maya/MDagPath.h>
+#include <maya/MObject.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MVectorArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MString.h>
+
+
+class PointHelperImportCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperImportCommand();
+	virtual						~PointHelperImportCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	MStatus				redoIt();
+	virtual	MStatus				undoIt();
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+protected:
+
+			MStatus				readRecords(const MString& filePath, const MString& format, bool hasShapes, bool hasColors, size_t chunkSize);
+			MStatus				getArrayNode(const MArgDatabase& argDatabase, MObject& node);
+			void				appendRecords(const Drawable::IO::HelperRecords& records);
+
+			MDagModifier		dagModifier;
+
+			MMatrixArray		matrices;
+			MVectorArray		colors;
+			MIntArray			shapeMasks;
+			unsigned int		numRecords;
+			size_t				numErrors;
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			formatFlag;
+	static	const char*			formatLongFlag;
+	static	const char*			shapesFlag;
+	static	const char*			shapesLongFlag;
+	static	const char*			colorsFlag;
+	static	const char*			colorsLongFlag;
+	static	const char*			nodeFlag;
+	static	const char*			nodeLongFlag;
+	static	const char*			chunkSizeFlag;
+	static	const char*			chunkSizeLongFlag;
+
+};
+#endif
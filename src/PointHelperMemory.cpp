@@ -0,0 +1,230 @@
+//
+// File: PointHelperMemory.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperMemory.h"
+#include "PointHelperDrawOverride.h"
+#include "GeometryCache.h"
+
+#include <maya/MFnDagNode.h>
+#include <maya/MObjectHandle.h>
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+
+namespace PointHelperMemory
+{
+
+	struct Registry
+	{
+
+		std::mutex									mutex;
+		std::vector<const PointHelperDrawOverride*>	drawOverrides;
+
+	};
+
+
+	static Registry& registry()
+	/**
+	Returns the registry of live draw overrides.
+
+	@return: Registry
+	*/
+	{
+
+		static Registry instance;
+		return instance;
+
+	};
+
+
+	static void writeUsage(std::ostream& stream, const Drawable::MemoryUsage& usage)
+	/**
+	Writes the supplied usage as a JSON object keyed by buffer type.
+
+	@param stream: The stream to write to.
+	@param usage: The usage to write.
+	@return: void
+	*/
+	{
+
+		stream << "{";
+
+		for (unsigned int i = 0; i < Drawable::NUM_BUFFERS; i++)
+		{
+
+			Drawable::Buffer buffer = static_cast<Drawable::Buffer>(i);
+			stream << (i > 0 ? ", " : "") << "\"" << Drawable::MemoryUsage::bufferName(buffer) << "\": " << usage.get(buffer);
+
+		}
+
+		stream << "}";
+
+	};
+
+};
+
+using namespace PointHelperMemory;
+
+
+void PointHelperMemory::add(const PointHelperDrawOverride* drawOverride)
+/**
+Registers a draw override for memory accounting.
+
+@param drawOverride: The draw override.
+@return: void
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	instance.drawOverrides.push_back(drawOverride);
+
+};
+
+
+void PointHelperMemory::remove(const PointHelperDrawOverride* drawOverride)
+/**
+Unregisters a draw override from memory accounting.
+
+@param drawOverride: The draw override.
+@return: void
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	instance.drawOverrides.erase(std::remove(instance.drawOverrides.begin(), instance.drawOverrides.end(), drawOverride), instance.drawOverrides.end());
+
+};
+
+
+std::string PointHelperMemory::report(unsigned int top)
+/**
+Returns the bytes held by the plugin as a JSON string.
+The report contains the total, a breakdown by buffer type and by drawable, the shared mesh data and the nodes holding the most memory.
+
+@param top: The number of nodes to include, sorted by bytes held.
+@return: std::string
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	// Collect usage per node
+	//
+	size_t numOverrides = instance.drawOverrides.size();
+
+	std::vector<Drawable::MemoryUsage> nodeUsage(numOverrides);
+	std::vector<Drawable::MemoryUsage> drawableUsage(PointHelperStats::NUM_DRAWABLES);
+	std::vector<size_t> meshDataBytes(PointHelperStats::NUM_DRAWABLES, 0);
+
+	Drawable::MemoryUsage total;
+
+	for (size_t i = 0; i < numOverrides; i++)
+	{
+
+		instance.drawOverrides[i]->memoryUsage(nodeUsage[i], drawableUsage.data());
+		total += nodeUsage[i];
+
+	}
+
+	// Shared mesh data is counted once regardless of the number of helpers
+	//
+	if (numOverrides > 0)
+	{
+
+		instance.drawOverrides[0]->meshDataMemoryUsage(meshDataBytes.data());
+
+		for (size_t bytes : meshDataBytes)
+		{
+
+			total.add(Drawable::Buffer::MeshData, bytes);
+
+		}
+
+	}
+
+	// Shape files are shared through the plugin-wide cache so they are also counted once
+	//
+	size_t shapeFileBytes = Drawable::Library::AssetCache::memoryUsage();
+	total.add(Drawable::Buffer::MeshData, shapeFileBytes);
+
+	// Prepared geometry is shared by every helper with the same inputs so it is counted once as well
+	//
+	Drawable::MemoryUsage sharedUsage;
+	Drawable::GeometryCache::memoryUsage(sharedUsage);
+
+	total += sharedUsage;
+
+	// Sort nodes by bytes held
+	//
+	std::vector<size_t> order(numOverrides);
+
+	for (size_t i = 0; i < numOverrides; i++)
+	{
+
+		order[i] = i;
+
+	}
+
+	size_t numTop = std::min(static_cast<size_t>(top), numOverrides);
+
+	std::partial_sort(order.begin(), order.begin() + numTop, order.end(), [&nodeUsage](size_t a, size_t b) { return nodeUsage[a].total() > nodeUsage[b].total(); });
+
+	// Serialize report
+	//
+	std::ostringstream stream;
+	stream << "{\"helpers\": " << numOverrides << ", \"totalBytes\": " << total.total() << ", \"byBuffer\": ";
+	writeUsage(stream, total);
+
+	stream << ", \"byDrawable\": {";
+
+	for (unsigned int i = 0; i < PointHelperStats::NUM_DRAWABLES; i++)
+	{
+
+		stream << (i > 0 ? ", " : "") << "\"" << PointHelperStats::drawableName(i) << "\": " << drawableUsage[i].total();
+
+	}
+
+	stream << "}, \"meshData\": {";
+
+	for (unsigned int i = 0; i < PointHelperStats::NUM_DRAWABLES; i++)
+	{
+
+		stream << (i > 0 ? ", " : "") << "\"" << PointHelperStats::drawableName(i) << "\": " << meshDataBytes[i];
+
+	}
+
+	stream << "}, \"shapeFiles\": " << shapeFileBytes;
+	stream << ", \"sharedGeometry\": {\"geometries\": " << Drawable::GeometryCache::size() << ", \"bytes\": " << sharedUsage.total();
+	stream << ", \"hits\": " << Drawable::GeometryCache::hitCount() << ", \"misses\": " << Drawable::GeometryCache::missCount() << "}, \"top\": [";
+
+	for (size_t i = 0; i < numTop; i++)
+	{
+
+		const PointHelperDrawOverride* drawOverride = instance.drawOverrides[order[i]];
+		const Drawable::MemoryUsage& usage = nodeUsage[order[i]];
+
+		MObjectHandle handle(drawOverride->node());
+		MString name = handle.isAlive() && handle.isValid() ? MFnDagNode(handle.object()).fullPathName() : MString();
+
+		stream << (i > 0 ? ", " : "") << "{\"node\": \"" << name.asChar() << "\", \"bytes\": " << usage.total() << ", \"byBuffer\": ";
+		writeUsage(stream, usage);
+		stream << "}";
+
+	}
+
+	stream << "]}";
+
+	return stream.str();
+
+};
@@ -0,0 +1,26 @@
+#ifndef _POINT_HELPER_MEMORY
+#define _POINT_HELPER_MEMORY
+//
+// File: PointHelperMemory.h
+//
+// Author: Ben Singleton
+//
+
+#include "MemoryUsage.h"
+
+#include <string>
+
+
+class PointHelperDrawOverride;
+
+
+namespace PointHelperMemory
+{
+
+	void			add(const PointHelperDrawOverride* drawOverride);
+	void			remove(const PointHelperDrawOverride* drawOverride);
+
+	std::string		report(unsigned int top);
+
+};
+#endif
@@ -0,0 +1,100 @@
+//
+// File: PointHelperMemoryCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperMemoryCommand.h"
+
+#include <algorithm>
+
+
+const MString	PointHelperMemoryCommand::commandName("pointHelperMemory");
+
+const char*		PointHelperMemoryCommand::topFlag = "-t";
+const char*		PointHelperMemoryCommand::topLongFlag = "-top";
+
+
+PointHelperMemoryCommand::PointHelperMemoryCommand() : MPxCommand() {};
+PointHelperMemoryCommand::~PointHelperMemoryCommand() {};
+
+
+MStatus PointHelperMemoryCommand::doIt(const MArgList& args)
+/**
+Returns the bytes held by point helper user data, drawable buffers and shared mesh data as a JSON string.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	int top = 10;
+
+	if (argDatabase.isFlagSet(PointHelperMemoryCommand::topFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperMemoryCommand::topFlag, 0, top);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	std::string json = PointHelperMemory::report(static_cast<unsigned int>(std::max(top, 0)));
+	this->setResult(MString(json.c_str()));
+
+	return MS::kSuccess;
+
+};
+
+
+bool PointHelperMemoryCommand::isUndoable() const
+/**
+This command only queries data so there is nothing to undo.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+void* PointHelperMemoryCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperMemoryCommand
+*/
+{
+
+	return new PointHelperMemoryCommand();
+
+};
+
+
+MSyntax PointHelperMemoryCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperMemoryCommand::topFlag, PointHelperMemoryCommand::topLongFlag, MSyntax::kLong));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
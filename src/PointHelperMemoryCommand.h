@@ -0,0 +1,42 @@
+#ifndef _POINT_HELPER_MEMORY_COMMAND
+#define _POINT_HELPER_MEMORY_COMMAND
+//
+// File: PointHelperMemoryCommand.h
+//
+// Command: pointHelperMemory
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperMemory.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MString.h>
+
+
+class PointHelperMemoryCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperMemoryCommand();
+	virtual						~PointHelperMemoryCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			topFlag;
+	static	const char*			topLongFlag;
+
+};
+#endif
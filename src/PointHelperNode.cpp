@@ -33,10 +33,15 @@ MObject	PointHelper::choice;
 MObject	PointHelper::text;
 MObject	PointHelper::fontSize;
 MObject	PointHelper::custom;
+MObject	PointHelper::shapeFlags;
 MObject	PointHelper::controlPoints;
 MObject	PointHelper::xValue;
 MObject	PointHelper::yValue;
 MObject	PointHelper::zValue;
+MObject	PointHelper::shapeLibrary;
+MObject	PointHelper::shapeName;
+MObject	PointHelper::shapeFile;
+MObject	PointHelper::curveShape;
 MObject	PointHelper::lineWidth;
 MObject	PointHelper::drawOnTop;
 MObject	PointHelper::fill;
@@ -59,8 +64,11 @@ MString	PointHelper::drawDbClassification("drawdb/geometry/PointHelper");
 MString	PointHelper::drawRegistrantId("PointHelperPlugin");
 MTypeId PointHelper::id(0x0013b1c0);
 
+std::atomic<int> PointHelper::drawDirtySuspendCount(0);
+std::atomic<uint64_t> PointHelper::controlPointsGenerations(0);
 
-PointHelper::PointHelper() {};
+
+PointHelper::PointHelper() : controlPointsGeneration(++PointHelper::controlPointsGenerations) {};
 PointHelper::~PointHelper() {};
 
 
@@ -80,11 +88,16 @@ Only these values should be used when performing computations!
 
 	MStatus status;
 
+	PointHelperProbes::ComputeProbe computeProbe(this);
+
 	// Check requested attribute
 	//
 	if (plug == PointHelper::objectMatrix || plug == PointHelper::objectInverseMatrix)
 	{
 
+		POINT_HELPER_PROFILE(MProfiler::kColorC_L1, "compute", "objectMatrix", this->thisMObject());
+		POINT_HELPER_TRACE("compute", this->thisMObject(), "objectMatrix");
+
 		// Get data handles
 		//
 		MDataHandle localPositionHandle = data.inputValue(PointHelper::localPosition, &status);
@@ -146,6 +159,9 @@ Only these values should be used when performing computations!
 	else if (plug == PointHelper::objectWorldMatrix || plug == PointHelper::objectWorldInverseMatrix)
 	{
 
+		POINT_HELPER_PROFILE(MProfiler::kColorC_L1, "compute", "objectWorldMatrix", this->thisMObject());
+		POINT_HELPER_TRACE("compute", this->thisMObject(), "objectWorldMatrix");
+
 		// Get object matrix
 		//
 		MDataHandle objectMatrixHandle = data.inputValue(PointHelper::objectMatrix, &status);
@@ -235,6 +251,54 @@ Only these values should be used when performing computations!
 };
 
 
+MStatus PointHelper::setDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
+/**
+This method can be overridden in user defined nodes to specify which plugs should be set dirty based upon an input plug which Maya is marking dirty.
+Connected curves are only tessellated again after they have changed.
+Control points are given a new plugin-wide generation whenever they change, so their prepared geometry can be keyed without hashing them.
+The library shape is only looked up again after its library or name have changed, and the shape file after it has changed.
+
+@param plug: Plug which is being set dirty by Maya.
+@param plugArray: The programmer should add any plugs which they want to set dirty to this list.
+@return: Return status.
+*/
+{
+
+	MObject attribute = plug.attribute();
+
+	if (attribute == PointHelper::curveShape)
+	{
+
+		this->curvesDirty = true;
+
+	}
+
+	if (attribute == PointHelper::shapeLibrary || attribute == PointHelper::shapeName)
+	{
+
+		this->shapeLibraryDirty = true;
+
+	}
+
+	if (attribute == PointHelper::shapeFile)
+	{
+
+		this->shapeFileDirty = true;
+
+	}
+
+	if (attribute == PointHelper::controlPoints || attribute == PointHelper::xValue || attribute == PointHelper::yValue || attribute == PointHelper::zValue)
+	{
+
+		this->controlPointsGeneration = ++PointHelper::controlPointsGenerations;
+
+	}
+
+	return MPxLocatorNode::setDependentsDirty(plug, plugArray);
+
+};
+
+
 MStatus PointHelper::preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode)
 /**
 Prepare a node's internal state for threaded evaluation.
@@ -252,7 +316,7 @@ When using Evaluation Caching or VP2 Custom Caching, preEvaluation() is called a
 
 	MStatus status;
 
-	if (context.isNormal())
+	if (context.isNormal() && !PointHelper::isDrawDirtySuspended())
 	{
 
 		if (evaluationNode.dirtyPlugExists(PointHelper::size, &status) && status || evaluationNode.dirtyPlugExists(PointHelper::localRotate, &status) && status)
@@ -264,6 +328,36 @@ When using Evaluation Caching or VP2 Custom Caching, preEvaluation() is called a
 
 	}
 
+	// Animated curves do not go through setDependentsDirty() under the evaluation manager
+	//
+	if (context.isNormal() && evaluationNode.dirtyPlugExists(PointHelper::curveShape, &status) && status)
+	{
+
+		this->curvesDirty = true;
+
+	}
+
+	if (context.isNormal() && (evaluationNode.dirtyPlugExists(PointHelper::shapeLibrary, &status) && status || evaluationNode.dirtyPlugExists(PointHelper::shapeName, &status) && status))
+	{
+
+		this->shapeLibraryDirty = true;
+
+	}
+
+	if (context.isNormal() && evaluationNode.dirtyPlugExists(PointHelper::shapeFile, &status) && status)
+	{
+
+		this->shapeFileDirty = true;
+
+	}
+
+	if (context.isNormal() && (evaluationNode.dirtyPlugExists(PointHelper::controlPoints, &status) && status || evaluationNode.dirtyPlugExists(PointHelper::xValue, &status) && status || evaluationNode.dirtyPlugExists(PointHelper::yValue, &status) && status || evaluationNode.dirtyPlugExists(PointHelper::zValue, &status) && status))
+	{
+
+		this->controlPointsGeneration = ++PointHelper::controlPointsGenerations;
+
+	}
+
 	return MPxLocatorNode::preEvaluation(context, evaluationNode);
 
 };
@@ -302,6 +396,8 @@ Copies the data from this node to the supplied data object.
 */
 {
 
+	PointHelperProbes::CopyInternalDataProbe copyInternalDataProbe(this);
+
 	MObject node = this->thisMObject();
 
 	data->localPosition = PointHelper::getVectorData(MPlug(node, PointHelper::localPosition));
@@ -309,14 +405,43 @@ Copies the data from this node to the supplied data object.
 	data->localScale = PointHelper::getVectorData(MPlug(node, PointHelper::localScale));
 	data->size = PointHelper::getDoubleData(MPlug(node, PointHelper::size));
 
-	data->drawables = this->drawables();
-	data->controlPoints = PointHelper::getVectorArrayData(MPlug(node, PointHelper::controlPoints));
+	this->drawables(data->drawables);
+
+	// Control points are only copied again after they have changed
+	//
+	uint64_t controlPointsGeneration = this->controlPointsGeneration;
+
+	if (data->controlPointsGeneration != controlPointsGeneration)
+	{
+
+		PointHelper::getVectorArrayData(MPlug(node, PointHelper::controlPoints), data->controlPoints);
+		data->controlPointsGeneration = controlPointsGeneration;
+
+	}
+
+	data->curveLines = this->getCurveLines();
+	data->isShapePending = (this->getShapeAsset(data->shapeAsset) == Drawable::Library::AssetState::Pending);
+
+	if (data->shapeAsset != nullptr)
+	{
+
+		data->shapeLibrary = nullptr;
+		data->libraryShape = &data->shapeAsset->shape;
+
+	}
+	else
+	{
+
+		data->libraryShape = this->getLibraryShape(data->shapeLibrary);
+
+	}
+
 	data->lineWidth = PointHelper::getFloatData(MPlug(node, PointHelper::lineWidth));
 	data->fill = PointHelper::getBoolData(MPlug(node, PointHelper::fill));
 	data->shaded = PointHelper::getBoolData(MPlug(node, PointHelper::shaded));
 	data->drawOnTop = PointHelper::getBoolData(MPlug(node, PointHelper::drawOnTop));
 
-	data->texts = PointHelper::getStringArrayData(MPlug(node, PointHelper::text));
+	PointHelper::getStringArrayData(MPlug(node, PointHelper::text), data->texts);
 	data->choice = PointHelper::getIntData(MPlug(node, PointHelper::choice));
 	data->text = (0 <= data->choice && data->choice < data->texts.length()) ? data->texts[data->choice] : MString("");
 	data->fontSize = PointHelper::getIntData(MPlug(node, PointHelper::fontSize));
@@ -458,6 +583,36 @@ Returns the vector array from the supplied plug.
 };
 
 
+void PointHelper::getVectorArrayData(const MPlug& plug, MVectorArray& vectors)
+/**
+Copies the vector array from the supplied plug into a passed array.
+The array is only resized when the number of elements changes so repeated calls do not reallocate.
+
+@param plug: The plug to access.
+@param vectors: The passed array to populate.
+@return: void
+*/
+{
+
+	unsigned int numElements = plug.numElements();
+
+	if (vectors.length() != numElements)
+	{
+
+		vectors.setLength(numElements);
+
+	}
+
+	for (unsigned int i = 0; i < numElements; i++)
+	{
+
+		vectors[i] = PointHelper::getVectorData(plug.elementByPhysicalIndex(i));
+
+	}
+
+};
+
+
 MString PointHelper::getStringData(const MPlug& plug)
 /**
 Returns the string value from the supplied plug.
@@ -496,6 +651,245 @@ Returns the string array from the supplied plug.
 };
 
 
+void PointHelper::getStringArrayData(const MPlug& plug, MStringArray& strings)
+/**
+Copies the string array from the supplied plug into a passed array.
+The array is only resized when the number of elements changes.
+
+@param plug: The plug to access.
+@param strings: The passed array to populate.
+@return: void
+*/
+{
+
+	unsigned int numElements = plug.numElements();
+
+	if (strings.length() != numElements)
+	{
+
+		strings.setLength(numElements);
+
+	}
+
+	for (unsigned int i = 0; i < numElements; i++)
+	{
+
+		strings[i] = PointHelper::getStringData(plug.elementByPhysicalIndex(i));
+
+	}
+
+};
+
+
+std::shared_ptr<const Drawable::Library::ShapeLibrary> PointHelper::getShapeLibrary() const
+/**
+Returns the shape library named by the `shapeLibrary` attribute, or by POINT_HELPER_SHAPE_LIBRARY if the attribute is empty.
+Libraries are mapped once per process and shared by every helper, the handle is kept on the node until `shapeLibrary` is dirtied.
+
+@return: The shape library, or a null pointer if none is set or it could not be mapped.
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->shapeLibraryMutex);
+	this->resolveLibraryShape();
+
+	return this->shapeLibraryHandle;
+
+};
+
+
+const Drawable::Library::Shape* PointHelper::getLibraryShape(std::shared_ptr<const Drawable::Library::ShapeLibrary>& library) const
+/**
+Returns the shape named by the `shapeName` attribute from the helper's shape library.
+The shape is kept on the node until `shapeLibrary` or `shapeName` are dirtied, so no strings are built or searched per prepare.
+
+@param library: The passed pointer to populate with the library that owns the shape.
+@return: The library shape, or a null pointer if there is no library or it has no such shape.
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->shapeLibraryMutex);
+	this->resolveLibraryShape();
+
+	library = this->shapeLibraryHandle;
+	return this->libraryShape;
+
+};
+
+
+void PointHelper::resolveLibraryShape() const
+/**
+Resolves the shape library and library shape again if either attribute has been dirtied since they were last resolved.
+The caller must hold the shape library mutex.
+
+@return: void
+*/
+{
+
+	if (!this->shapeLibraryDirty.exchange(false))
+	{
+
+		return;
+
+	}
+
+	MObject node = this->thisMObject();
+	std::string path = PointHelper::getStringData(MPlug(node, PointHelper::shapeLibrary)).asChar();
+
+	if (path.empty())
+	{
+
+		const char* variable = std::getenv("POINT_HELPER_SHAPE_LIBRARY");
+		path = (variable != nullptr) ? variable : "";
+
+	}
+
+	// The library is only reacquired when the path changes, so failures are only reported once per path
+	//
+	if (!this->hasShapeLibraryPath || path != this->shapeLibraryPath)
+	{
+
+		this->shapeLibraryPath = path;
+		this->hasShapeLibraryPath = true;
+		this->shapeLibraryHandle = nullptr;
+
+		if (!path.empty())
+		{
+
+			std::string error;
+			this->shapeLibraryHandle = Drawable::Library::acquire(path, error);
+
+			if (this->shapeLibraryHandle == nullptr)
+			{
+
+				MGlobal::displayWarning(MString("pointHelper: ") + error.c_str());
+
+			}
+
+		}
+
+	}
+
+	this->libraryShape = (this->shapeLibraryHandle != nullptr) ? this->shapeLibraryHandle->find(PointHelper::getStringData(MPlug(node, PointHelper::shapeName)).asChar()) : nullptr;
+
+};
+
+
+Drawable::Library::AssetState PointHelper::getShapeAsset(std::shared_ptr<const Drawable::Library::ShapeAsset>& asset) const
+/**
+Requests the OBJ file named by the `shapeFile` attribute from the plugin-wide shape cache.
+The file is parsed on a worker thread the first time any helper requests it, so this never blocks.
+The result is kept on the node, so the cache is only asked again while the file is loading or after `shapeFile` is dirtied.
+
+@param asset: The passed pointer to populate once the shape is ready.
+@return: The state of the shape file.
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->shapeLibraryMutex);
+
+	if (this->shapeFileDirty.exchange(false))
+	{
+
+		this->shapeFilePath = PointHelper::getStringData(MPlug(this->thisMObject(), PointHelper::shapeFile)).asChar();
+		this->shapeAssetState = Drawable::Library::AssetState::Pending;
+
+	}
+
+	if (this->shapeAssetState == Drawable::Library::AssetState::Pending)
+	{
+
+		std::string error;
+		this->shapeAssetState = Drawable::Library::AssetCache::request(this->shapeFilePath, this->shapeAssetHandle, error);
+
+		// Failures are only reported once per path
+		//
+		if (this->shapeAssetState == Drawable::Library::AssetState::Failed && this->shapeFilePath != this->shapeFileWarning)
+		{
+
+			MGlobal::displayWarning(MString("pointHelper: ") + error.c_str());
+
+		}
+
+		this->shapeFileWarning = (this->shapeAssetState == Drawable::Library::AssetState::Failed) ? this->shapeFilePath : std::string();
+
+	}
+
+	asset = this->shapeAssetHandle;
+	return this->shapeAssetState;
+
+};
+
+
+std::shared_ptr<const MPointArray> PointHelper::getCurveLines(MBoundingBox* boundingBox) const
+/**
+Returns the connected curves tessellated into line segments, in object space.
+Curves are only tessellated again after they change, otherwise every helper draw shares the same array.
+
+@param boundingBox: Optional bounding-box to populate with the bounds of the lines.
+@return: The line segments as point pairs, or a null pointer if no curves are connected.
+*/
+{
+
+	std::lock_guard<std::mutex> lock(this->curveMutex);
+
+	if (this->curvesDirty.exchange(false))
+	{
+
+		// Tessellate every curve element
+		//
+		MPlug plug(this->thisMObject(), PointHelper::curveShape);
+		unsigned int numElements = plug.numElements();
+
+		std::vector<Drawable::Core::PointD> lines;
+		MObject curveData;
+
+		for (unsigned int i = 0; i < numElements; i++)
+		{
+
+			curveData = plug.elementByPhysicalIndex(i).asMObject();
+
+			if (curveData.isNull())
+			{
+
+				continue;
+
+			}
+
+			CHECK_MSTATUS(Drawable::tessellateCurve(curveData, lines));
+
+		}
+
+		// Cache lines and their bounds
+		//
+		std::shared_ptr<MPointArray> curveLines = std::make_shared<MPointArray>();
+		Drawable::fromCore(lines, *curveLines);
+
+		this->curveBoundingBox = MBoundingBox();
+
+		for (unsigned int i = 0; i < curveLines->length(); i++)
+		{
+
+			this->curveBoundingBox.expand((*curveLines)[i]);
+
+		}
+
+		this->curveLines = lines.empty() ? nullptr : curveLines;
+
+	}
+
+	if (boundingBox != nullptr)
+	{
+
+		*boundingBox = this->curveBoundingBox;
+
+	}
+
+	return this->curveLines;
+
+};
+
+
 MDagPath PointHelper::thisMDagPath() const
 /**
 Returns a dag path to this node.
@@ -509,35 +903,289 @@ Returns a dag path to this node.
 };
 
 
-std::map<std::string, bool> PointHelper::drawables()
+void PointHelper::drawables(bool* drawables)
 /**
-Returns the drawable flags from this node.
+Copies the drawable flags from this node into the supplied array.
+The array is indexed by Drawable::Shape and must hold Drawable::NUM_SHAPES flags.
+Every flag is unpacked from a single read of the `shapeFlags` attribute.
+Drawable booleans driven by a connection, such as a driven key or animation curve, never set their bit so their source is read instead.
 
-@return: The drawable flags.
+@param drawables: The passed array to populate.
+@return: void
 */
 {
 
-	MObject node = this->thisMObject();
+	const unsigned int flags = static_cast<unsigned int>(PointHelper::getIntData(MPlug(this->thisMObject(), PointHelper::shapeFlags)));
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		drawables[i] = (flags & (1u << i)) != 0;
+
+	}
+
+	// Read connected booleans
+	//
+	const unsigned int connected = this->connectedShapes.load();
+
+	if (connected == 0)
+	{
+
+		return;
+
+	}
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		if ((connected & (1u << i)) == 0)
+		{
+
+			continue;
+
+		}
+
+		MPlug source = MPlug(this->thisMObject(), PointHelper::drawableAttribute(i)).source();
+
+		if (!source.isNull())
+		{
 
-	return std::map<std::string, bool> {
-		{ "centerMarker", PointHelper::getBoolData(MPlug(node, PointHelper::centerMarker)) },
-		{ "axisTripod", PointHelper::getBoolData(MPlug(node, PointHelper::axisTripod)) },
-		{ "axisView", PointHelper::getBoolData(MPlug(node, PointHelper::axisView)) },
-		{ "cross", PointHelper::getBoolData(MPlug(node, PointHelper::cross)) },
-		{ "square", PointHelper::getBoolData(MPlug(node, PointHelper::square)) },
-		{ "box", PointHelper::getBoolData(MPlug(node, PointHelper::box)) },
-		{ "triangle", PointHelper::getBoolData(MPlug(node, PointHelper::triangle)) },
-		{ "pyramid", PointHelper::getBoolData(MPlug(node, PointHelper::pyramid)) },
-		{ "diamond", PointHelper::getBoolData(MPlug(node, PointHelper::diamond)) },
-		{ "disc", PointHelper::getBoolData(MPlug(node, PointHelper::disc)) },
-		{ "arrow", PointHelper::getBoolData(MPlug(node, PointHelper::arrow)) },
-		{ "notch", PointHelper::getBoolData(MPlug(node, PointHelper::notch)) },
-		{ "tearDrop", PointHelper::getBoolData(MPlug(node, PointHelper::tearDrop)) },
-		{ "cylinder", PointHelper::getBoolData(MPlug(node, PointHelper::cylinder)) },
-		{ "sphere", PointHelper::getBoolData(MPlug(node, PointHelper::sphere)) },
-		{ "custom", PointHelper::getBoolData(MPlug(node, PointHelper::custom)) }
+			drawables[i] = source.asBool();
+
+		}
+
+	}
+
+};
+
+
+MObject PointHelper::drawableAttribute(unsigned int shape)
+/**
+Returns the attribute that toggles the supplied drawable.
+
+@param shape: The drawable index, see Drawable::Shape.
+@return: The attribute, or a null object if the index is out of range.
+*/
+{
+
+	const MObject* attributes[Drawable::NUM_SHAPES] =
+	{
+		&PointHelper::arrow, &PointHelper::axisTripod, &PointHelper::axisView, &PointHelper::box,
+		&PointHelper::centerMarker, &PointHelper::cross, &PointHelper::custom, &PointHelper::cylinder,
+		&PointHelper::diamond, &PointHelper::disc, &PointHelper::notch, &PointHelper::pyramid,
+		&PointHelper::sphere, &PointHelper::square, &PointHelper::tearDrop, &PointHelper::triangle
 	};
 
+	return (shape < Drawable::NUM_SHAPES) ? *attributes[shape] : MObject::kNullObj;
+
+};
+
+
+void PointHelper::suspendDrawDirty()
+/**
+Stops point helpers from marking their geometry as draw dirty until resumeDrawDirty() is called.
+Bulk commands use this so a batch of edits only dirties each node once.
+Calls can be nested.
+
+@return: void
+*/
+{
+
+	PointHelper::drawDirtySuspendCount++;
+
+};
+
+
+void PointHelper::resumeDrawDirty(const MObjectArray& nodes)
+/**
+Ends a suspendDrawDirty() block.
+Once the outermost block ends the supplied nodes are marked as draw dirty in a single pass.
+
+@param nodes: The nodes edited while suspended.
+@return: void
+*/
+{
+
+	if (--PointHelper::drawDirtySuspendCount > 0)
+	{
+
+		return;
+
+	}
+
+	for (unsigned int i = 0; i < nodes.length(); i++)
+	{
+
+		MHWRender::MRenderer::setGeometryDrawDirty(nodes[i], true);
+
+	}
+
+};
+
+
+bool PointHelper::isDrawDirtySuspended()
+/**
+Evaluates if draw dirty notifications are currently suspended.
+
+@return: bool
+*/
+{
+
+	return PointHelper::drawDirtySuspendCount.load() > 0;
+
+};
+
+
+unsigned int PointHelper::drawableShape(const MObject& attribute)
+/**
+Returns the drawable index toggled by the supplied attribute.
+
+@param attribute: The attribute to look up.
+@return: The drawable index, see Drawable::Shape, or Drawable::NUM_SHAPES if the attribute does not toggle a drawable.
+*/
+{
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		if (attribute == PointHelper::drawableAttribute(i))
+		{
+
+			return i;
+
+		}
+
+	}
+
+	return Drawable::NUM_SHAPES;
+
+};
+
+
+bool PointHelper::getInternalValue(const MPlug& plug, MDataHandle& handle)
+/**
+This method is overridden by nodes that store attribute data in some internal format.
+The drawable booleans are proxies that read their bit from the `shapeFlags` attribute, or their source when they are connected.
+
+@param plug: The attribute that is being queried.
+@param handle: The data handle to store the attribute value in.
+@return: True if the attribute was handled.
+*/
+{
+
+	unsigned int shape = PointHelper::drawableShape(plug.attribute());
+
+	if (shape == Drawable::NUM_SHAPES)
+	{
+
+		return MPxLocatorNode::getInternalValue(plug, handle);
+
+	}
+
+	bool drawables[Drawable::NUM_SHAPES];
+	this->drawables(drawables);
+
+	handle.setBool(drawables[shape]);
+
+	return true;
+
+};
+
+
+bool PointHelper::setInternalValue(const MPlug& plug, const MDataHandle& handle)
+/**
+This method is overridden by nodes that store attribute data in some internal format.
+The drawable booleans are proxies that write their bit into the `shapeFlags` attribute.
+The bit is written straight into the datablock, setting the plug from here would re-enter the dependency graph and is not undo safe.
+Undoing a boolean edit calls this again with the previous value so both stay in sync.
+
+@param plug: The attribute that is being set.
+@param handle: The data handle containing the new value.
+@return: True if the attribute was handled.
+*/
+{
+
+	unsigned int shape = PointHelper::drawableShape(plug.attribute());
+
+	if (shape == Drawable::NUM_SHAPES)
+	{
+
+		return MPxLocatorNode::setInternalValue(plug, handle);
+
+	}
+
+	MStatus status;
+
+	MDataBlock data = this->forceCache();
+	MDataHandle flagsHandle = data.outputValue(PointHelper::shapeFlags, &status);
+	CHECK_MSTATUS_AND_RETURN(status, false);
+
+	const unsigned int bit = 1u << shape;
+	const unsigned int flags = static_cast<unsigned int>(flagsHandle.asInt());
+	const unsigned int newFlags = handle.asBool() ? (flags | bit) : (flags & ~bit);
+
+	if (newFlags != flags)
+	{
+
+		flagsHandle.setInt(static_cast<int>(newFlags));
+		flagsHandle.setClean();
+
+	}
+
+	return true;
+
+};
+
+
+MStatus PointHelper::connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc)
+/**
+This method gets called when connections are made to attributes of this node.
+Tracks which drawable booleans are driven so drawables() only reads the sources of those.
+
+@param plug: Attribute on this node.
+@param otherPlug: Attribute on the other node.
+@param asSrc: Is this plug a source of the connection.
+@return: Return status.
+*/
+{
+
+	unsigned int shape = PointHelper::drawableShape(plug.attribute());
+
+	if (!asSrc && shape < Drawable::NUM_SHAPES)
+	{
+
+		this->connectedShapes.fetch_or(1u << shape);
+
+	}
+
+	return MPxLocatorNode::connectionMade(plug, otherPlug, asSrc);
+
+};
+
+
+MStatus PointHelper::connectionBroken(const MPlug& plug, const MPlug& otherPlug, bool asSrc)
+/**
+This method gets called when connections are broken with attributes of this node.
+A disconnected drawable boolean falls back to its bit in `shapeFlags`.
+
+@param plug: Attribute on this node.
+@param otherPlug: Attribute on the other node.
+@param asSrc: Is this plug a source of the connection.
+@return: Return status.
+*/
+{
+
+	unsigned int shape = PointHelper::drawableShape(plug.attribute());
+
+	if (!asSrc && shape < Drawable::NUM_SHAPES)
+	{
+
+		this->connectedShapes.fetch_and(~(1u << shape));
+
+	}
+
+	return MPxLocatorNode::connectionBroken(plug, otherPlug, asSrc);
+
 };
 
 
@@ -582,6 +1230,34 @@ Supplying a bounding box will make selection calculation more efficient!
 
 	}
 
+	// Append the shape file's or library shape's bounds
+	// A shape file that is still loading is drawn as the default bounding-box
+	//
+	std::shared_ptr<const Drawable::Library::ShapeAsset> asset;
+	this->getShapeAsset(asset);
+
+	std::shared_ptr<const Drawable::Library::ShapeLibrary> library;
+	const Drawable::Library::Shape* libraryShape = (asset != nullptr) ? &asset->shape : this->getLibraryShape(library);
+
+	if (libraryShape != nullptr)
+	{
+
+		boundingBox.expand(MPoint(libraryShape->min[0], libraryShape->min[1], libraryShape->min[2]));
+		boundingBox.expand(MPoint(libraryShape->max[0], libraryShape->max[1], libraryShape->max[2]));
+
+	}
+
+	// Append any connected curves
+	//
+	MBoundingBox curveBoundingBox;
+
+	if (this->getCurveLines(&curveBoundingBox) != nullptr)
+	{
+
+		boundingBox.expand(curveBoundingBox);
+
+	}
+
 	// Transform bounding-box with object-matrix
 	//
 	MVector localPosition = PointHelper::getVectorData(MPlug(this->thisMObject(), PointHelper::localPosition));
@@ -731,11 +1407,25 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnNumericAttr.setChannelBox(true));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::renderCategory));
 
+	// Initialize `shapeFlags` attribute
+	// Bit n enables Drawable::Shape n, the drawable booleans below are proxies for these bits
+	//
+	const int defaultShapeFlags = (1 << static_cast<int>(Drawable::Shape::Box)) | (1 << static_cast<int>(Drawable::Shape::Cross));
+
+	PointHelper::shapeFlags = fnNumericAttr.create("shapeFlags", "shf", MFnNumericData::kInt, defaultShapeFlags, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnNumericAttr.setMin(0));
+	CHECK_MSTATUS(fnNumericAttr.setMax((1 << Drawable::NUM_SHAPES) - 1));
+	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
+
 	// Initialize `centerMarker` attribute
 	//
 	PointHelper::centerMarker = fnNumericAttr.create("centerMarker", "centerMarker", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `axisTripod` attribute
@@ -743,6 +1433,8 @@ Use this function to define any static attributes.
 	PointHelper::axisTripod = fnNumericAttr.create("axisTripod", "axisTripod", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `axisView` attribute
@@ -750,6 +1442,8 @@ Use this function to define any static attributes.
 	PointHelper::axisView = fnNumericAttr.create("axisView", "axisView", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `cross` attribute
@@ -757,6 +1451,8 @@ Use this function to define any static attributes.
 	PointHelper::cross = fnNumericAttr.create("cross", "cross", MFnNumericData::kBoolean, true, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `square` attribute
@@ -764,6 +1460,8 @@ Use this function to define any static attributes.
 	PointHelper::square = fnNumericAttr.create("square", "square", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `box` attribute
@@ -771,6 +1469,8 @@ Use this function to define any static attributes.
 	PointHelper::box = fnNumericAttr.create("box", "box", MFnNumericData::kBoolean, true, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `triangle` attribute
@@ -778,6 +1478,8 @@ Use this function to define any static attributes.
 	PointHelper::triangle = fnNumericAttr.create("triangle", "triangle", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `pyramid` attribute
@@ -785,6 +1487,8 @@ Use this function to define any static attributes.
 	PointHelper::pyramid = fnNumericAttr.create("pyramid", "pyramid", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `diamond` attribute
@@ -792,6 +1496,8 @@ Use this function to define any static attributes.
 	PointHelper::diamond = fnNumericAttr.create("diamond", "diamond", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `circle` attribute
@@ -799,6 +1505,8 @@ Use this function to define any static attributes.
 	PointHelper::disc = fnNumericAttr.create("disc", "disc", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `arrow` attribute
@@ -806,6 +1514,8 @@ Use this function to define any static attributes.
 	PointHelper::arrow = fnNumericAttr.create("arrow", "arrow", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `notch` attribute
@@ -813,6 +1523,8 @@ Use this function to define any static attributes.
 	PointHelper::notch = fnNumericAttr.create("notch", "notch", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `tearDrop` attribute
@@ -820,6 +1532,8 @@ Use this function to define any static attributes.
 	PointHelper::tearDrop = fnNumericAttr.create("tearDrop", "tearDrop", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `cylinder` attribute
@@ -827,6 +1541,8 @@ Use this function to define any static attributes.
 	PointHelper::cylinder = fnNumericAttr.create("cylinder", "cylinder", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `sphere` attribute
@@ -834,6 +1550,8 @@ Use this function to define any static attributes.
 	PointHelper::sphere = fnNumericAttr.create("sphere", "sphere", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// Initialize `choice` attribute
@@ -864,6 +1582,8 @@ Use this function to define any static attributes.
 	PointHelper::custom = fnNumericAttr.create("custom", "custom", MFnNumericData::kBoolean, false, &status);
 	CHECK_MSTATUS_AND_RETURN_IT(status);
 
+	CHECK_MSTATUS(fnNumericAttr.setInternal(true));
+	CHECK_MSTATUS(fnNumericAttr.setStorable(false));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::drawableCategory));
 
 	// ".xValue` attribute
@@ -895,6 +1615,38 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(fnNumericAttr.setArray(true));
 	CHECK_MSTATUS(fnNumericAttr.addToCategory(PointHelper::customCategory));
 
+	// Initialize `shapeLibrary` attribute
+	//
+	PointHelper::shapeLibrary = fnTypedAttr.create("shapeLibrary", "shl", MFnData::kString, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.setUsedAsFilename(true));
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelper::customCategory));
+
+	// Initialize `shapeName` attribute
+	//
+	PointHelper::shapeName = fnTypedAttr.create("shapeName", "shn", MFnData::kString, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelper::customCategory));
+
+	// Initialize `shapeFile` attribute
+	//
+	PointHelper::shapeFile = fnTypedAttr.create("shapeFile", "sfl", MFnData::kString, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.setUsedAsFilename(true));
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelper::customCategory));
+
+	// Initialize `curveShape` attribute
+	//
+	PointHelper::curveShape = fnTypedAttr.create("curveShape", "crs", MFnData::kNurbsCurve, MObject::kNullObj, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	CHECK_MSTATUS(fnTypedAttr.setArray(true));
+	CHECK_MSTATUS(fnTypedAttr.setDisconnectBehavior(MFnAttribute::kDelete));
+	CHECK_MSTATUS(fnTypedAttr.addToCategory(PointHelper::customCategory));
+
 	// Initialize `lineWidth` attribute
 	//
 	PointHelper::lineWidth = fnNumericAttr.create("lineWidth", "lw", MFnNumericData::kFloat, 1.0f, &status);
@@ -967,6 +1719,7 @@ Use this function to define any static attributes.
 	//
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::localRotate));
 	
+	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::shapeFlags));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::centerMarker));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::axisTripod));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::axisView));
@@ -989,6 +1742,10 @@ Use this function to define any static attributes.
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::fontSize));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::custom));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::controlPoints));
+	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::shapeLibrary));
+	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::shapeName));
+	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::shapeFile));
+	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::curveShape));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::lineWidth));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::drawOnTop));
 	CHECK_MSTATUS(PointHelper::addAttribute(PointHelper::fill));
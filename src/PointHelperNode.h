@@ -10,6 +10,9 @@
 
 #include "Drawable.h"
 #include "PointHelperData.h"
+#include "PointHelperProfiler.h"
+#include "PointHelperTracer.h"
+#include "PointHelperProbes.h"
 
 #include <maya/MPxLocatorNode.h>
 #include <maya/MObject.h>
@@ -61,6 +64,11 @@
 #include <maya/MTypeId.h>
 
 #include <assert.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
 
 
 enum class Axis
@@ -84,6 +92,7 @@ public:
 	virtual MStatus				compute(const MPlug& plug, MDataBlock& data);
 	virtual	void				draw(M3dView& view, const MDagPath& dagPath, M3dView::DisplayStyle displayStyle, M3dView::DisplayStatus displayStatus) {};
 
+	virtual	MStatus				setDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
 	virtual	MStatus				preEvaluation(const MDGContext& context, const MEvaluationNode& evaluationNode);
 	virtual	void				getCacheSetup(const MEvaluationNode& evaluationNode, MNodeCacheDisablingInfo& disablingInfo, MNodeCacheSetupInfo& cacheSetupInfo, MObjectArray& monitoredAttributes) const;
 
@@ -96,11 +105,28 @@ public:
 	static	double				getDoubleData(const MPlug& plug);
 	static	MVector				getVectorData(const MPlug& plug);
 	static	MVectorArray		getVectorArrayData(const MPlug& plug);
+	static	void				getVectorArrayData(const MPlug& plug, MVectorArray& vectors);
 	static	MString				getStringData(const MPlug& plug);
 	static	MStringArray		getStringArrayData(const MPlug& plug);
+	static	void				getStringArrayData(const MPlug& plug, MStringArray& strings);
+	virtual	std::shared_ptr<const Drawable::Library::ShapeLibrary>	getShapeLibrary() const;
+	virtual	const Drawable::Library::Shape*	getLibraryShape(std::shared_ptr<const Drawable::Library::ShapeLibrary>& library) const;
+	virtual	Drawable::Library::AssetState	getShapeAsset(std::shared_ptr<const Drawable::Library::ShapeAsset>& asset) const;
+	virtual	std::shared_ptr<const MPointArray>	getCurveLines(MBoundingBox* boundingBox = nullptr) const;
 	virtual	MDagPath			thisMDagPath() const;
 
-	virtual	std::map<std::string, bool>		drawables();
+	virtual	void				drawables(bool* drawables);
+	static	MObject				drawableAttribute(unsigned int shape);
+	static	unsigned int		drawableShape(const MObject& attribute);
+
+	virtual	bool				getInternalValue(const MPlug& plug, MDataHandle& handle);
+	virtual	bool				setInternalValue(const MPlug& plug, const MDataHandle& handle);
+	virtual	MStatus				connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
+	virtual	MStatus				connectionBroken(const MPlug& plug, const MPlug& otherPlug, bool asSrc);
+
+	static	void				suspendDrawDirty();
+	static	void				resumeDrawDirty(const MObjectArray& nodes);
+	static	bool				isDrawDirtySuspended();
 
 	virtual	bool				isBounded() const;
 	virtual	MBoundingBox		boundingBox() const;
@@ -131,6 +157,7 @@ public:
 	static  MObject				cylinder;
 	static  MObject				sphere;
 	static	MObject				custom;
+	static	MObject				shapeFlags;
 
 	static  MObject				size;
 	static  MObject				choice;
@@ -141,6 +168,10 @@ public:
 	static	MObject				xValue;
 	static	MObject				yValue;
 	static	MObject				zValue;
+	static	MObject				shapeLibrary;
+	static	MObject				shapeName;
+	static	MObject				shapeFile;
+	static	MObject				curveShape;
 	static  MObject				fill;
 	static  MObject				shaded;
 	static  MObject				drawOnTop;
@@ -162,6 +193,34 @@ public:
 	static	MString				drawRegistrantId;
 	static	MTypeId				id;
 
+protected:
+
+	static	std::atomic<int>	drawDirtySuspendCount;
+	static	std::atomic<uint64_t>	controlPointsGenerations;
+
+			void				resolveLibraryShape() const;
+
+	mutable	std::mutex			shapeLibraryMutex;
+	mutable	std::atomic<bool>	shapeLibraryDirty{ true };
+	mutable	std::shared_ptr<const Drawable::Library::ShapeLibrary>	shapeLibraryHandle;
+	mutable	const Drawable::Library::Shape*	libraryShape = nullptr;
+	mutable	std::string			shapeLibraryPath;
+	mutable	bool				hasShapeLibraryPath = false;
+	mutable	std::atomic<bool>	shapeFileDirty{ true };
+	mutable	std::string			shapeFilePath;
+	mutable	std::shared_ptr<const Drawable::Library::ShapeAsset>	shapeAssetHandle;
+	mutable	Drawable::Library::AssetState	shapeAssetState = Drawable::Library::AssetState::None;
+	mutable	std::string			shapeFileWarning;
+
+			std::atomic<unsigned int>	connectedShapes{ 0 };
+
+	mutable	std::mutex			curveMutex;
+	mutable	std::atomic<bool>	curvesDirty{ true };
+	mutable	std::shared_ptr<const MPointArray>	curveLines;
+	mutable	MBoundingBox		curveBoundingBox;
+
+			std::atomic<uint64_t>	controlPointsGeneration;
+
 };
 
 
@@ -0,0 +1,158 @@
+#ifndef _POINT_HELPER_PROBES
+#define _POINT_HELPER_PROBES
+//
+// File: PointHelperProbes.h
+//
+// Author: Ben Singleton
+//
+
+#include <cstdint>
+
+// USDT probes are compiled in on Linux whenever <sys/sdt.h> is available, define POINT_HELPER_USDT=0 to remove them
+// Each probe compiles to a single NOP until a tracer such as perf, bpftrace or systemtap attaches to it
+//
+#ifndef POINT_HELPER_USDT
+#define POINT_HELPER_USDT 1
+#endif
+
+#if POINT_HELPER_USDT && defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define POINT_HELPER_PROBE(name, node, drawable, vertices) DTRACE_PROBE3(pointhelper, name, node, drawable, vertices)
+#endif
+#endif
+
+#ifndef POINT_HELPER_PROBE
+#define POINT_HELPER_PROBE(name, node, drawable, vertices)
+#endif
+
+
+namespace PointHelperProbes
+{
+
+	static const uint32_t NO_DRAWABLE = 0xFFFFFFFF;
+
+
+	class ComputeProbe
+	/**
+	Fires pointhelper:compute_entry and pointhelper:compute_return.
+	*/
+	{
+
+	public:
+
+		ComputeProbe(const void* node) : node(node) { POINT_HELPER_PROBE(compute_entry, this->node, NO_DRAWABLE, 0); };
+		~ComputeProbe() { POINT_HELPER_PROBE(compute_return, this->node, NO_DRAWABLE, 0); };
+
+	protected:
+
+		const void*		node;
+
+	};
+
+
+	class CopyInternalDataProbe
+	/**
+	Fires pointhelper:copy_internal_data_entry and pointhelper:copy_internal_data_return.
+	*/
+	{
+
+	public:
+
+		CopyInternalDataProbe(const void* node) : node(node) { POINT_HELPER_PROBE(copy_internal_data_entry, this->node, NO_DRAWABLE, 0); };
+		~CopyInternalDataProbe() { POINT_HELPER_PROBE(copy_internal_data_return, this->node, NO_DRAWABLE, 0); };
+
+	protected:
+
+		const void*		node;
+
+	};
+
+
+	class PrepareForDrawProbe
+	/**
+	Fires pointhelper:prepare_for_draw_entry and pointhelper:prepare_for_draw_return.
+	*/
+	{
+
+	public:
+
+		PrepareForDrawProbe(const void* node) : node(node) { POINT_HELPER_PROBE(prepare_for_draw_entry, this->node, NO_DRAWABLE, 0); };
+		~PrepareForDrawProbe() { POINT_HELPER_PROBE(prepare_for_draw_return, this->node, NO_DRAWABLE, 0); };
+
+	protected:
+
+		const void*		node;
+
+	};
+
+
+	class DrawablePrepareProbe
+	/**
+	Fires pointhelper:drawable_prepare_entry and pointhelper:drawable_prepare_return with the drawable's id.
+	The return probe carries the number of vertices prepared, see setVertexCount().
+	*/
+	{
+
+	public:
+
+		DrawablePrepareProbe(const void* node, uint32_t drawable) : node(node), drawable(drawable), vertices(0) { POINT_HELPER_PROBE(drawable_prepare_entry, this->node, this->drawable, 0); };
+		~DrawablePrepareProbe() { POINT_HELPER_PROBE(drawable_prepare_return, this->node, this->drawable, this->vertices); };
+
+		void	setVertexCount(uint64_t vertices) { this->vertices = vertices; };
+
+	protected:
+
+		const void*		node;
+		uint32_t		drawable;
+		uint64_t		vertices;
+
+	};
+
+
+	class DrawableDrawProbe
+	/**
+	Fires pointhelper:drawable_draw_entry and pointhelper:drawable_draw_return with the drawable's id.
+	The return probe carries the number of vertices submitted, see setVertexCount().
+	*/
+	{
+
+	public:
+
+		DrawableDrawProbe(const void* node, uint32_t drawable) : node(node), drawable(drawable), vertices(0) { POINT_HELPER_PROBE(drawable_draw_entry, this->node, this->drawable, 0); };
+		~DrawableDrawProbe() { POINT_HELPER_PROBE(drawable_draw_return, this->node, this->drawable, this->vertices); };
+
+		void	setVertexCount(uint64_t vertices) { this->vertices = vertices; };
+
+	protected:
+
+		const void*		node;
+		uint32_t		drawable;
+		uint64_t		vertices;
+
+	};
+
+
+	class AddUIDrawablesProbe
+	/**
+	Fires pointhelper:add_ui_drawables_entry and pointhelper:add_ui_drawables_return.
+	The return probe carries the number of vertices submitted, see setVertexCount().
+	*/
+	{
+
+	public:
+
+		AddUIDrawablesProbe(const void* node) : node(node), vertices(0) { POINT_HELPER_PROBE(add_ui_drawables_entry, this->node, NO_DRAWABLE, 0); };
+		~AddUIDrawablesProbe() { POINT_HELPER_PROBE(add_ui_drawables_return, this->node, NO_DRAWABLE, this->vertices); };
+
+		void	setVertexCount(uint64_t vertices) { this->vertices = vertices; };
+
+	protected:
+
+		const void*		node;
+		uint64_t		vertices;
+
+	};
+
+};
+#endif
@@ -0,0 +1,132 @@
+//
+// File: PointHelperProfiler.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperProfiler.h"
+
+#include <cstdlib>
+#include <cstring>
+
+
+namespace PointHelperProfiler
+{
+
+	static const char* CATEGORY_NAME = "PointHelper";
+	static const char* CATEGORY_DESCRIPTION = "Point helper draw override, drawables and compute";
+
+	static int categoryId = -1;
+
+	static std::atomic<bool> enabled{ false };
+
+};
+
+using namespace PointHelperProfiler;
+
+
+int PointHelperProfiler::category()
+/**
+Returns the id of the plugin's profiler category.
+
+@return: int
+*/
+{
+
+	return categoryId;
+
+};
+
+
+MStatus PointHelperProfiler::registerCategory()
+/**
+Registers the plugin's profiler category.
+Markers start enabled when the POINT_HELPER_PROFILING environment variable is set to a non-zero value.
+
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	categoryId = MProfiler::addCategory(CATEGORY_NAME, CATEGORY_DESCRIPTION);
+	status = (categoryId >= 0) ? MS::kSuccess : MS::kFailure;
+
+	const char* variable = std::getenv("POINT_HELPER_PROFILING");
+	PointHelperProfiler::setEnabled(variable != nullptr && std::strcmp(variable, "") != 0 && std::strcmp(variable, "0") != 0);
+
+	return status;
+
+};
+
+
+MStatus PointHelperProfiler::deregisterCategory()
+/**
+Removes the plugin's profiler category.
+
+@return: Return status.
+*/
+{
+
+	PointHelperProfiler::setEnabled(false);
+
+	if (categoryId < 0)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	categoryId = -1;
+
+	return MProfiler::removeCategory(CATEGORY_NAME) >= 0 ? MS::kSuccess : MS::kFailure;
+
+};
+
+
+bool PointHelperProfiler::isEnabled()
+/**
+Returns whether profiling markers are currently emitted.
+
+@return: bool
+*/
+{
+
+	return enabled.load(std::memory_order_relaxed);
+
+};
+
+
+void PointHelperProfiler::setEnabled(bool isEnabled)
+/**
+Updates whether profiling markers are emitted.
+
+@param isEnabled: The new state.
+@return: void
+*/
+{
+
+	enabled.store(isEnabled && categoryId >= 0, std::memory_order_relaxed);
+
+};
+
+
+Scope::Scope() {};
+Scope::~Scope() {};
+
+
+void Scope::begin(MProfiler::ProfilingColor color, const char* eventName, const char* description, const MObject& node)
+/**
+Opens the profiling scope, the scope is closed when this object is destroyed.
+
+@param color: The color of the event in the profiler.
+@param eventName: The event name, this must be a string literal or otherwise outlive any profiler capture.
+@param description: The optional event description, with the same lifetime requirements as the name.
+@param node: The optional node associated with the event.
+@return: void
+*/
+{
+
+	this->scope.emplace(categoryId, color, eventName, description, node);
+
+};
@@ -0,0 +1,57 @@
+#ifndef _POINT_HELPER_PROFILER
+#define _POINT_HELPER_PROFILER
+//
+// File: PointHelperProfiler.h
+//
+// Author: Ben Singleton
+//
+
+#include <maya/MProfiler.h>
+#include <maya/MObject.h>
+#include <maya/MStatus.h>
+
+#include <atomic>
+#include <optional>
+
+
+namespace PointHelperProfiler
+{
+
+	int			category();
+
+	MStatus		registerCategory();
+	MStatus		deregisterCategory();
+
+	bool		isEnabled();
+	void		setEnabled(bool enabled);
+
+
+	class Scope
+	/**
+	Holds an MProfilingScope in the plugin's category until the enclosing scope exits.
+	Use POINT_HELPER_PROFILE() so the event arguments are only evaluated when markers are enabled.
+	*/
+	{
+
+	public:
+
+								Scope();
+								~Scope();
+
+				void			begin(MProfiler::ProfilingColor color, const char* eventName, const char* description = nullptr, const MObject& node = MObject::kNullObj);
+
+	protected:
+
+				std::optional<MProfilingScope>	scope;
+
+	};
+
+};
+
+
+#define POINT_HELPER_PROFILER_CONCAT_IMPL(a, b) a##b
+#define POINT_HELPER_PROFILER_CONCAT(a, b) POINT_HELPER_PROFILER_CONCAT_IMPL(a, b)
+
+#define POINT_HELPER_PROFILE(...) PointHelperProfiler::Scope POINT_HELPER_PROFILER_CONCAT(profilingScope, __LINE__); if (PointHelperProfiler::isEnabled()) { POINT_HELPER_PROFILER_CONCAT(profilingScope, __LINE__).begin(__VA_ARGS__); }
+
+#endif
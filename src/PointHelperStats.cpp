@@ -0,0 +1,789 @@
+//
+// File: PointHelperStats.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperStats.h"
+#include "Drawable.h"
+
+#include <maya/MFnDagNode.h>
+#include <maya/MGlobal.h>
+#include <maya/MViewport2Renderer.h>
+
+#include <algorithm>
+#include <sstream>
+
+
+namespace PointHelperStats
+{
+
+	const char* COUNTER_NAMES[NUM_COUNTERS] =
+	{
+		"prepareForDrawNs", "prepareForDrawCalls", "copyInternalDataNs", "copyInternalDataCalls",
+		"boundingBoxCalls", "drawNs", "drawCalls", "vertices", "primitives", "drawableBlocks",
+		"meshCalls", "lineListCalls", "lineCalls", "sphereCalls", "textCalls", "xrayToggles",
+		"colorChanges", "lineWidthChanges", "prepareSkips"
+	};
+
+	static const char* FRAME_CALLBACK_NAME = "PointHelperStats";
+	static const char* HUD_NAME = "pointHelperStatsHUD";
+
+
+	struct Registry
+	{
+
+		std::mutex					mutex;
+		std::vector<NodeStats*>		nodes;
+		Counters					released;
+		std::atomic<uint64_t>		frames{ 0 };
+		bool						callbackRegistered = false;
+
+	};
+
+
+	static Registry& registry()
+	/**
+	Returns the registry of live node counters.
+	A function level static avoids depending on the static initialization order of the plugin.
+
+	@return: Registry
+	*/
+	{
+
+		static Registry instance;
+		return instance;
+
+	};
+
+};
+
+using namespace PointHelperStats;
+
+
+const char* PointHelperStats::drawableName(unsigned int drawable)
+/**
+Returns the static name of the supplied drawable index that is safe to hand to external tools.
+Unknown indices return "unknown".
+
+@param drawable: The drawable index.
+@return: const char*
+*/
+{
+
+	return Drawable::shapeName(static_cast<Drawable::Shape>(drawable));
+
+};
+
+
+unsigned int PointHelperStats::drawablePrepareTime(unsigned int drawable)
+/**
+Returns the value index that holds the prepare time for the supplied drawable.
+
+@param drawable: The drawable index.
+@return: unsigned int
+*/
+{
+
+	return NUM_COUNTERS + (std::min(drawable, NUM_DRAWABLES - 1) * 2);
+
+};
+
+
+unsigned int PointHelperStats::drawableDrawTime(unsigned int drawable)
+/**
+Returns the value index that holds the draw time for the supplied drawable.
+
+@param drawable: The drawable index.
+@return: unsigned int
+*/
+{
+
+	return NUM_COUNTERS + (std::min(drawable, NUM_DRAWABLES - 1) * 2) + 1;
+
+};
+
+
+Counters::Counters()
+/**
+Constructor.
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_VALUES; i++)
+	{
+
+		this->cumulativeValues[i].store(0, std::memory_order_relaxed);
+		this->frameValues[i].store(0, std::memory_order_relaxed);
+		this->lastFrameValues[i].store(0, std::memory_order_relaxed);
+
+	}
+
+};
+
+
+Counters::~Counters() {};
+
+
+void Counters::add(unsigned int index, uint64_t value)
+/**
+Adds the supplied value to the cumulative and current frame counters.
+
+@param index: The value index.
+@param value: The value to add.
+@return: void
+*/
+{
+
+	this->cumulativeValues[index].fetch_add(value, std::memory_order_relaxed);
+	this->frameValues[index].fetch_add(value, std::memory_order_relaxed);
+
+};
+
+
+void Counters::add(Counter counter, uint64_t value)
+/**
+Adds the supplied value to the cumulative and current frame counters.
+
+@param counter: The counter.
+@param value: The value to add.
+@return: void
+*/
+{
+
+	this->add(static_cast<unsigned int>(counter), value);
+
+};
+
+
+uint64_t Counters::cumulative(unsigned int index) const
+/**
+Returns the cumulative value since the last reset.
+
+@param index: The value index.
+@return: uint64_t
+*/
+{
+
+	return this->cumulativeValues[index].load(std::memory_order_relaxed);
+
+};
+
+
+uint64_t Counters::lastFrame(unsigned int index) const
+/**
+Returns the value accumulated during the last completed frame.
+
+@param index: The value index.
+@return: uint64_t
+*/
+{
+
+	return this->lastFrameValues[index].load(std::memory_order_relaxed);
+
+};
+
+
+void Counters::merge(const Counters& other)
+/**
+Adds the cumulative, current frame and last frame values of the supplied counters to these.
+
+@param other: The counters to add.
+@return: void
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_VALUES; i++)
+	{
+
+		this->cumulativeValues[i].fetch_add(other.cumulativeValues[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		this->frameValues[i].fetch_add(other.frameValues[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		this->lastFrameValues[i].fetch_add(other.lastFrameValues[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	}
+
+};
+
+
+void Counters::endFrame()
+/**
+Moves the current frame counters into the last frame counters.
+
+@return: void
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_VALUES; i++)
+	{
+
+		this->lastFrameValues[i].store(this->frameValues[i].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+
+	}
+
+};
+
+
+void Counters::reset()
+/**
+Clears all counters.
+
+@return: void
+*/
+{
+
+	for (unsigned int i = 0; i < NUM_VALUES; i++)
+	{
+
+		this->cumulativeValues[i].store(0, std::memory_order_relaxed);
+		this->frameValues[i].store(0, std::memory_order_relaxed);
+		this->lastFrameValues[i].store(0, std::memory_order_relaxed);
+
+	}
+
+};
+
+
+void Counters::toJson(std::string& json) const
+/**
+Appends the cumulative and last frame counters to the supplied string as a JSON object.
+Drawables without any recorded time are omitted.
+
+@param json: The string to append to.
+@return: void
+*/
+{
+
+	std::ostringstream stream;
+	stream << "{";
+
+	const std::atomic<uint64_t>* sections[2] = { this->cumulativeValues, this->lastFrameValues };
+	const char* sectionNames[2] = { "cumulative", "lastFrame" };
+
+	for (unsigned int section = 0; section < 2; section++)
+	{
+
+		const std::atomic<uint64_t>* values = sections[section];
+
+		stream << (section > 0 ? ", " : "") << "\"" << sectionNames[section] << "\": {";
+
+		for (unsigned int i = 0; i < NUM_COUNTERS; i++)
+		{
+
+			stream << (i > 0 ? ", " : "") << "\"" << COUNTER_NAMES[i] << "\": " << values[i].load(std::memory_order_relaxed);
+
+		}
+
+		// Share of prepares that reused the previous geometry
+		//
+		uint64_t prepareCalls = values[static_cast<unsigned int>(Counter::PrepareForDrawCalls)].load(std::memory_order_relaxed);
+		uint64_t prepareSkips = values[static_cast<unsigned int>(Counter::PrepareSkips)].load(std::memory_order_relaxed);
+
+		stream << ", \"prepareSkipRate\": " << (prepareCalls > 0 ? static_cast<double>(prepareSkips) / static_cast<double>(prepareCalls) : 0.0);
+
+		stream << ", \"drawables\": {";
+
+		bool isFirst = true;
+
+		for (unsigned int i = 0; i < NUM_DRAWABLES; i++)
+		{
+
+			uint64_t prepareTime = values[drawablePrepareTime(i)].load(std::memory_order_relaxed);
+			uint64_t drawTime = values[drawableDrawTime(i)].load(std::memory_order_relaxed);
+
+			if (prepareTime == 0 && drawTime == 0)
+			{
+
+				continue;
+
+			}
+
+			stream << (isFirst ? "" : ", ") << "\"" << drawableName(i) << "\": {\"prepareNs\": " << prepareTime << ", \"drawNs\": " << drawTime << "}";
+			isFirst = false;
+
+		}
+
+		stream << "}}";
+
+	}
+
+	stream << "}";
+
+	json += stream.str();
+
+};
+
+
+NodeStats::NodeStats(const MObject& node) : Counters(), node(node) {};
+NodeStats::~NodeStats() {};
+
+
+void NodeStats::record(unsigned int index, uint64_t value)
+/**
+Adds the supplied value to this node.
+
+@param index: The value index.
+@param value: The value to add.
+@return: void
+*/
+{
+
+	this->add(index, value);
+
+};
+
+
+void NodeStats::record(Counter counter, uint64_t value)
+/**
+Adds the supplied value to this node.
+
+@param counter: The counter.
+@param value: The value to add.
+@return: void
+*/
+{
+
+	this->record(static_cast<unsigned int>(counter), value);
+
+};
+
+
+MString NodeStats::name() const
+/**
+Returns the full path name of the node these counters belong to.
+An empty string is returned if the node has since been deleted.
+
+@return: MString
+*/
+{
+
+	if (!this->node.isAlive() || !this->node.isValid())
+	{
+
+		return MString();
+
+	}
+
+	MStatus status;
+	MFnDagNode fnDagNode(this->node.object(), &status);
+
+	return status ? fnDagNode.fullPathName() : MString();
+
+};
+
+
+ScopedTimer::ScopedTimer(NodeStats* stats, unsigned int index) : stats(stats), index(index)
+/**
+Constructor.
+
+@param stats: The node counters to add to, null disables the timer.
+@param index: The value index to add the elapsed time to.
+*/
+{
+
+	if (this->stats != nullptr)
+	{
+
+		this->start = std::chrono::steady_clock::now();
+
+	}
+
+};
+
+
+ScopedTimer::~ScopedTimer()
+/**
+Destructor.
+*/
+{
+
+	if (this->stats != nullptr)
+	{
+
+		std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - this->start;
+		this->stats->record(this->index, static_cast<uint64_t>(elapsed.count()));
+
+	}
+
+};
+
+
+void PointHelperStats::total(Counters& totals)
+/**
+Sums the counters of every live node, and of the nodes released since the last reset, into the supplied counters.
+
+@param totals: The counters to add to.
+@return: void
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	totals.merge(instance.released);
+
+	for (NodeStats* stats : instance.nodes)
+	{
+
+		totals.merge(*stats);
+
+	}
+
+};
+
+
+NodeStats* PointHelperStats::acquire(const MObject& node)
+/**
+Creates and registers counters for the supplied node.
+Returns null when stats have been compiled out.
+
+@param node: The point helper node.
+@return: NodeStats*
+*/
+{
+
+#if POINT_HELPER_STATS_ENABLED
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	NodeStats* stats = new NodeStats(node);
+	instance.nodes.push_back(stats);
+
+	return stats;
+
+#else
+
+	return nullptr;
+
+#endif
+
+};
+
+
+void PointHelperStats::release(NodeStats* stats)
+/**
+Unregisters and deletes the supplied counters.
+Their values remain part of the totals.
+
+@param stats: The counters to release.
+@return: void
+*/
+{
+
+	if (stats == nullptr)
+	{
+
+		return;
+
+	}
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	instance.nodes.erase(std::remove(instance.nodes.begin(), instance.nodes.end(), stats), instance.nodes.end());
+	instance.released.merge(*stats);
+
+	delete stats;
+
+};
+
+
+void PointHelperStats::endFrame()
+/**
+Rolls the current frame counters over into the last frame counters.
+
+@return: void
+*/
+{
+
+#if POINT_HELPER_STATS_ENABLED
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	for (NodeStats* stats : instance.nodes)
+	{
+
+		stats->endFrame();
+
+	}
+
+	instance.released.endFrame();
+	instance.frames.fetch_add(1, std::memory_order_relaxed);
+
+#endif
+
+};
+
+
+void PointHelperStats::reset()
+/**
+Clears the totals and the counters of every node.
+
+@return: void
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	for (NodeStats* stats : instance.nodes)
+	{
+
+		stats->reset();
+
+	}
+
+	instance.released.reset();
+	instance.frames.store(0, std::memory_order_relaxed);
+
+};
+
+
+std::string PointHelperStats::report(bool includeNodes)
+/**
+Returns the totals and, optionally, the counters of every node as a JSON string.
+
+@param includeNodes: Determines if per-node counters are included.
+@return: std::string
+*/
+{
+
+#if POINT_HELPER_STATS_ENABLED
+
+	Counters totals;
+	total(totals);
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	std::string json = "{\"enabled\": true, \"frames\": " + std::to_string(instance.frames.load(std::memory_order_relaxed)) + ", \"total\": ";
+	totals.toJson(json);
+
+	if (includeNodes)
+	{
+
+		json += ", \"nodes\": {";
+
+		bool isFirst = true;
+
+		for (NodeStats* stats : instance.nodes)
+		{
+
+			MString name = stats->name();
+
+			if (name.length() == 0)
+			{
+
+				continue;
+
+			}
+
+			json += (isFirst ? "\"" : ", \"") + std::string(name.asChar()) + "\": ";
+			stats->toJson(json);
+
+			isFirst = false;
+
+		}
+
+		json += "}";
+
+	}
+
+	json += "}";
+
+	return json;
+
+#else
+
+	return "{\"enabled\": false}";
+
+#endif
+
+};
+
+
+std::string PointHelperStats::summary()
+/**
+Returns the submission counters from the last completed frame as a single line of text.
+This is the string displayed by the heads-up display, see setHudVisible().
+
+@return: std::string
+*/
+{
+
+#if POINT_HELPER_STATS_ENABLED
+
+	static const Counter counters[] =
+	{
+		Counter::DrawCalls, Counter::DrawableBlocks, Counter::MeshCalls, Counter::LineListCalls, Counter::LineCalls, Counter::SphereCalls,
+		Counter::TextCalls, Counter::Vertices, Counter::XrayToggles, Counter::ColorChanges, Counter::LineWidthChanges
+	};
+
+	static const char* labels[] =
+	{
+		"helpers", "blocks", "mesh", "lineList", "line", "sphere", "text", "vertices", "xray", "color", "lineWidth"
+	};
+
+	std::ostringstream stream;
+
+	Counters totals;
+	total(totals);
+
+	for (size_t i = 0; i < (sizeof(counters) / sizeof(Counter)); i++)
+	{
+
+		stream << (i > 0 ? "  " : "") << labels[i] << " " << totals.lastFrame(static_cast<unsigned int>(counters[i]));
+
+	}
+
+	return stream.str();
+
+#else
+
+	return "disabled";
+
+#endif
+
+};
+
+
+MStatus PointHelperStats::setHudVisible(bool visible)
+/**
+Adds or removes a heads-up display that shows summary() after every refresh.
+The display is a regular MEL headsUpDisplay so it can be repositioned with the headsUpDisplay command.
+
+@param visible: Determines if the display is shown.
+@return: Return status.
+*/
+{
+
+	if (MGlobal::mayaState() != MGlobal::kInteractive || visible == PointHelperStats::isHudVisible())
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	MString command;
+
+	if (visible)
+	{
+
+		command.format(
+			"headsUpDisplay -section 0 -block `headsUpDisplay -nextFreeBlock 0` -blockSize \"small\" -label \"PointHelper\" -labelFontSize \"small\" -dataFontSize \"small\" -command \"pointHelperStats -summary\" -attachToRefresh ^1s;",
+			HUD_NAME
+		);
+
+	}
+	else
+	{
+
+		command.format("headsUpDisplay -remove ^1s;", HUD_NAME);
+
+	}
+
+	return MGlobal::executeCommand(command);
+
+};
+
+
+bool PointHelperStats::isHudVisible()
+/**
+Returns whether the heads-up display has been added.
+
+@return: bool
+*/
+{
+
+	if (MGlobal::mayaState() != MGlobal::kInteractive)
+	{
+
+		return false;
+
+	}
+
+	MString command;
+	command.format("headsUpDisplay -exists ^1s;", HUD_NAME);
+
+	int exists = 0;
+	MStatus status = MGlobal::executeCommand(command, exists);
+
+	return status && exists != 0;
+
+};
+
+
+MStatus PointHelperStats::registerFrameCallback()
+/**
+Registers a render notification that rolls the counters over at the end of every viewport render.
+This is skipped when stats are compiled out or when no renderer exists, such as in batch mode.
+
+@return: Return status.
+*/
+{
+
+#if POINT_HELPER_STATS_ENABLED
+
+	MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
+
+	if (renderer == nullptr)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	MStatus status = renderer->addNotification(PointHelperStats::onEndRender, FRAME_CALLBACK_NAME, MHWRender::MPassContext::kEndRenderSemantic, nullptr);
+	registry().callbackRegistered = status == MS::kSuccess;
+
+	return status;
+
+#else
+
+	return MS::kSuccess;
+
+#endif
+
+};
+
+
+MStatus PointHelperStats::deregisterFrameCallback()
+/**
+Removes the render notification added by registerFrameCallback().
+
+@return: Return status.
+*/
+{
+
+	Registry& instance = registry();
+	MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
+
+	if (!instance.callbackRegistered || renderer == nullptr)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	instance.callbackRegistered = false;
+
+	return renderer->removeNotification(FRAME_CALLBACK_NAME, MHWRender::MPassContext::kEndRenderSemantic);
+
+};
+
+
+void PointHelperStats::onEndRender(MHWRender::MDrawContext& context, void* clientData)
+/**
+Render notification callback used to end the current frame.
+Each viewport render counts as a frame so multiple visible viewports will advance the counters more than once per refresh.
+
+@param context: The draw context.
+@param clientData: Unused.
+@return: void
+*/
+{
+
+	PointHelperStats::endFrame();
+
+};
@@ -0,0 +1,182 @@
+#ifndef _POINT_HELPER_STATS
+#define _POINT_HELPER_STATS
+//
+// File: PointHelperStats.h
+//
+// Author: Ben Singleton
+//
+
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MString.h>
+#include <maya/MStatus.h>
+#include <maya/MDrawContext.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Counters are compiled in by default, define POINT_HELPER_STATS_ENABLED=0 to remove them from the draw path
+//
+#ifndef POINT_HELPER_STATS_ENABLED
+#define POINT_HELPER_STATS_ENABLED 1
+#endif
+
+
+namespace PointHelperStats
+{
+
+	enum class Counter : uint32_t
+	{
+
+		PrepareForDrawTime = 0,
+		PrepareForDrawCalls,
+		CopyInternalDataTime,
+		CopyInternalDataCalls,
+		BoundingBoxCalls,
+		DrawTime,
+		DrawCalls,
+		Vertices,
+		Primitives,
+		DrawableBlocks,
+		MeshCalls,
+		LineListCalls,
+		LineCalls,
+		SphereCalls,
+		TextCalls,
+		XrayToggles,
+		ColorChanges,
+		LineWidthChanges,
+		PrepareSkips,
+		Count
+
+	};
+
+	static const unsigned int NUM_COUNTERS = static_cast<unsigned int>(Counter::Count);
+	static const unsigned int NUM_DRAWABLES = 16;
+	static const unsigned int NUM_VALUES = NUM_COUNTERS + (NUM_DRAWABLES * 2);
+
+	extern const char* COUNTER_NAMES[NUM_COUNTERS];
+
+	const char*		drawableName(unsigned int drawable);
+	unsigned int	drawablePrepareTime(unsigned int drawable);
+	unsigned int	drawableDrawTime(unsigned int drawable);
+
+
+	class Counters
+	/**
+	Lock-free cumulative and per-frame counters.
+	Values are indexed by Counter followed by a prepare and draw time per drawable.
+	*/
+	{
+
+	public:
+
+								Counters();
+		virtual					~Counters();
+
+				void			add(unsigned int index, uint64_t value);
+				void			add(Counter counter, uint64_t value);
+
+				uint64_t		cumulative(unsigned int index) const;
+				uint64_t		lastFrame(unsigned int index) const;
+
+				void			merge(const Counters& other);
+
+				void			endFrame();
+				void			reset();
+
+				void			toJson(std::string& json) const;
+
+	protected:
+
+				std::atomic<uint64_t>	cumulativeValues[NUM_VALUES];
+				std::atomic<uint64_t>	frameValues[NUM_VALUES];
+				std::atomic<uint64_t>	lastFrameValues[NUM_VALUES];
+
+	};
+
+
+	class NodeStats : public Counters
+	/**
+	Counters for a single point helper.
+	Totals are summed from every node when they are queried so the draw path only writes to its own node.
+	*/
+	{
+
+	public:
+
+								NodeStats(const MObject& node);
+		virtual					~NodeStats();
+
+				void			record(unsigned int index, uint64_t value);
+				void			record(Counter counter, uint64_t value);
+
+				MString			name() const;
+
+	protected:
+
+				MObjectHandle	node;
+
+	};
+
+
+	class ScopedTimer
+	/**
+	Adds the elapsed time of the enclosing scope, in nanoseconds, to a node's counters.
+	*/
+	{
+
+	public:
+
+								ScopedTimer(NodeStats* stats, unsigned int index);
+								~ScopedTimer();
+
+	protected:
+
+				NodeStats*								stats;
+				unsigned int							index;
+				std::chrono::steady_clock::time_point	start;
+
+	};
+
+
+	void			total(Counters& totals);
+
+	NodeStats*		acquire(const MObject& node);
+	void			release(NodeStats* stats);
+
+	void			endFrame();
+	void			reset();
+	std::string		report(bool includeNodes);
+	std::string		summary();
+
+	MStatus			setHudVisible(bool visible);
+	bool			isHudVisible();
+
+	MStatus			registerFrameCallback();
+	MStatus			deregisterFrameCallback();
+	void			onEndRender(MHWRender::MDrawContext& context, void* clientData);
+
+};
+
+
+#if POINT_HELPER_STATS_ENABLED
+
+#define POINT_HELPER_STATS_CONCAT_IMPL(a, b) a##b
+#define POINT_HELPER_STATS_CONCAT(a, b) POINT_HELPER_STATS_CONCAT_IMPL(a, b)
+
+#define POINT_HELPER_STATS_TIMER(stats, index) PointHelperStats::ScopedTimer POINT_HELPER_STATS_CONCAT(statsTimer, __LINE__)(stats, static_cast<unsigned int>(index))
+#define POINT_HELPER_STATS_RECORD(stats, counter, value) if ((stats) != nullptr) { (stats)->record(counter, value); }
+
+#else
+
+#define POINT_HELPER_STATS_TIMER(stats, index)
+#define POINT_HELPER_STATS_RECORD(stats, counter, value)
+
+#endif
+
+#endif
@@ -0,0 +1,149 @@
+//
+// File: PointHelperStatsCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperStatsCommand.h"
+
+
+const MString	PointHelperStatsCommand::commandName("pointHelperStats");
+
+const char*		PointHelperStatsCommand::resetFlag = "-r";
+const char*		PointHelperStatsCommand::resetLongFlag = "-reset";
+const char*		PointHelperStatsCommand::totalFlag = "-t";
+const char*		PointHelperStatsCommand::totalLongFlag = "-total";
+const char*		PointHelperStatsCommand::profilingFlag = "-p";
+const char*		PointHelperStatsCommand::profilingLongFlag = "-profiling";
+const char*		PointHelperStatsCommand::summaryFlag = "-s";
+const char*		PointHelperStatsCommand::summaryLongFlag = "-summary";
+const char*		PointHelperStatsCommand::hudFlag = "-hud";
+const char*		PointHelperStatsCommand::hudLongFlag = "-headsUpDisplay";
+
+
+PointHelperStatsCommand::PointHelperStatsCommand() : MPxCommand() {};
+PointHelperStatsCommand::~PointHelperStatsCommand() {};
+
+
+MStatus PointHelperStatsCommand::doIt(const MArgList& args)
+/**
+Returns the draw path counters as a JSON string.
+The counters hold cumulative values since the last reset and the values from the last completed frame, per helper and in total.
+The profiling flag toggles the plugin's Maya Profiler markers.
+The summary flag returns the last frame's submission counters as a single line, which the headsUpDisplay flag shows in the viewport.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	bool includeNodes = !argDatabase.isFlagSet(PointHelperStatsCommand::totalFlag);
+	bool reset = argDatabase.isFlagSet(PointHelperStatsCommand::resetFlag);
+
+	if (argDatabase.isFlagSet(PointHelperStatsCommand::profilingFlag))
+	{
+
+		bool profiling = false;
+
+		status = argDatabase.getFlagArgument(PointHelperStatsCommand::profilingFlag, 0, profiling);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		PointHelperProfiler::setEnabled(profiling);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStatsCommand::hudFlag))
+	{
+
+		bool hud = false;
+
+		status = argDatabase.getFlagArgument(PointHelperStatsCommand::hudFlag, 0, hud);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = PointHelperStats::setHudVisible(hud);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStatsCommand::summaryFlag))
+	{
+
+		this->setResult(MString(PointHelperStats::summary().c_str()));
+		return MS::kSuccess;
+
+	}
+
+	// Report counters before resetting them
+	//
+	std::string json = PointHelperStats::report(includeNodes);
+
+	if (reset)
+	{
+
+		PointHelperStats::reset();
+
+	}
+
+	this->setResult(MString(json.c_str()));
+
+	return MS::kSuccess;
+
+};
+
+
+bool PointHelperStatsCommand::isUndoable() const
+/**
+Resetting counters is not undoable.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+void* PointHelperStatsCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperStatsCommand
+*/
+{
+
+	return new PointHelperStatsCommand();
+
+};
+
+
+MSyntax PointHelperStatsCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStatsCommand::resetFlag, PointHelperStatsCommand::resetLongFlag));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStatsCommand::totalFlag, PointHelperStatsCommand::totalLongFlag));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStatsCommand::profilingFlag, PointHelperStatsCommand::profilingLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStatsCommand::summaryFlag, PointHelperStatsCommand::summaryLongFlag));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStatsCommand::hudFlag, PointHelperStatsCommand::hudLongFlag, MSyntax::kBoolean));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
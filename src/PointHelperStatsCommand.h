@@ -0,0 +1,51 @@
+#ifndef _POINT_HELPER_STATS_COMMAND
+#define _POINT_HELPER_STATS_COMMAND
+//
+// File: PointHelperStatsCommand.h
+//
+// Command: pointHelperStats
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperStats.h"
+#include "PointHelperProfiler.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MString.h>
+
+
+class PointHelperStatsCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperStatsCommand();
+	virtual						~PointHelperStatsCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			resetFlag;
+	static	const char*			resetLongFlag;
+	static	const char*			totalFlag;
+	static	const char*			totalLongFlag;
+	static	const char*			profilingFlag;
+	static	const char*			profilingLongFlag;
+	static	const char*			summaryFlag;
+	static	const char*			summaryLongFlag;
+	static	const char*			hudFlag;
+	static	const char*			hudLongFlag;
+
+};
+#endif
@@ -0,0 +1,763 @@
+//
+// File: PointHelperStressCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperStressCommand.h"
+
+#include <maya/MGlobal.h>
+#include <maya/M3dView.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MObjectArray.h>
+#include <maya/MStringArray.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+
+const MString	PointHelperStressCommand::commandName("pointHelperStress");
+
+const char*		PointHelperStressCommand::countFlag = "-c";
+const char*		PointHelperStressCommand::countLongFlag = "-count";
+const char*		PointHelperStressCommand::seedFlag = "-s";
+const char*		PointHelperStressCommand::seedLongFlag = "-seed";
+const char*		PointHelperStressCommand::shapesFlag = "-sh";
+const char*		PointHelperStressCommand::shapesLongFlag = "-shapes";
+const char*		PointHelperStressCommand::shapesPerHelperFlag = "-sph";
+const char*		PointHelperStressCommand::shapesPerHelperLongFlag = "-shapesPerHelper";
+const char*		PointHelperStressCommand::fillFlag = "-f";
+const char*		PointHelperStressCommand::fillLongFlag = "-fill";
+const char*		PointHelperStressCommand::textFlag = "-t";
+const char*		PointHelperStressCommand::textLongFlag = "-text";
+const char*		PointHelperStressCommand::controlPointsFlag = "-cp";
+const char*		PointHelperStressCommand::controlPointsLongFlag = "-controlPoints";
+const char*		PointHelperStressCommand::instanceFlag = "-i";
+const char*		PointHelperStressCommand::instanceLongFlag = "-instance";
+const char*		PointHelperStressCommand::animateFlag = "-a";
+const char*		PointHelperStressCommand::animateLongFlag = "-animate";
+const char*		PointHelperStressCommand::startFlag = "-st";
+const char*		PointHelperStressCommand::startLongFlag = "-start";
+const char*		PointHelperStressCommand::endFlag = "-e";
+const char*		PointHelperStressCommand::endLongFlag = "-end";
+const char*		PointHelperStressCommand::noTimingFlag = "-nt";
+const char*		PointHelperStressCommand::noTimingLongFlag = "-noTiming";
+
+
+class StressRandom
+/**
+A splitmix64 generator.
+Standard library distributions differ between implementations, so the layout is derived from raw 64-bit values to stay identical on every platform.
+*/
+{
+
+public:
+
+	StressRandom(const uint64_t seed) : state(seed) {};
+
+	uint64_t next()
+	{
+
+		uint64_t z = (this->state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+		return z ^ (z >> 31);
+
+	};
+
+	double uniform()
+	{
+
+		return static_cast<double>(this->next() >> 11) * (1.0 / 9007199254740992.0);
+
+	};
+
+	double uniform(const double min, const double max)
+	{
+
+		return min + ((max - min) * this->uniform());
+
+	};
+
+	int integer(const int min, const int max)
+	{
+
+		return min + static_cast<int>(this->next() % static_cast<uint64_t>((max - min) + 1));
+
+	};
+
+	bool chance(const double probability)
+	{
+
+		return this->uniform() < probability;
+
+	};
+
+protected:
+
+	uint64_t state;
+
+};
+
+
+PointHelperStressCommand::PointHelperStressCommand() : MPxCommand()
+{
+
+	this->count = 1000;
+	this->seed = 1;
+	this->shapesPerHelper = 2;
+	this->fillRatio = 0.5;
+	this->textRatio = 0.1;
+	this->maxControlPoints = 0;
+	this->instanceRatio = 0.0;
+	this->animate = false;
+	this->startFrame = 1;
+	this->endFrame = 100;
+	this->timing = true;
+	this->numInstances = 0;
+
+	std::fill(this->shapeWeights, this->shapeWeights + Drawable::NUM_SHAPES, 1.0);
+
+};
+
+
+PointHelperStressCommand::~PointHelperStressCommand() {};
+
+
+MStatus PointHelperStressCommand::doIt(const MArgList& args)
+/**
+Builds a reproducible stress scene of point helpers then times viewport refreshes over a frame range.
+The same arguments and seed always produce the same scene.
+The result is a JSON string containing the frame rate, frame time percentiles and the plugin's draw counters.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	status = this->parseArguments(args);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	status = this->createHelpers();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (!this->timing)
+	{
+
+		return MS::kSuccess;
+
+	}
+
+	std::string json;
+
+	status = this->timeRefreshes(json);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	this->setResult(MString(json.c_str()));
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperStressCommand::redoIt()
+/**
+Recreates the stress scene.
+
+@return: Return status.
+*/
+{
+
+	return this->dagModifier.doIt();
+
+};
+
+
+MStatus PointHelperStressCommand::undoIt()
+/**
+Deletes the stress scene.
+
+@return: Return status.
+*/
+{
+
+	return this->dagModifier.undoIt();
+
+};
+
+
+bool PointHelperStressCommand::isUndoable() const
+/**
+The stress scene is left in place for inspection so the command can be undone to remove it.
+
+@return: bool
+*/
+{
+
+	return true;
+
+};
+
+
+MStatus PointHelperStressCommand::parseArguments(const MArgList& args)
+/**
+Parses the command arguments into the scene settings.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::countFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::countFlag, 0, this->count);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::seedFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::seedFlag, 0, this->seed);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::shapesFlag))
+	{
+
+		MString shapes = argDatabase.flagArgumentString(PointHelperStressCommand::shapesFlag, 0, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = this->parseShapes(shapes);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::shapesPerHelperFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::shapesPerHelperFlag, 0, this->shapesPerHelper);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::fillFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::fillFlag, 0, this->fillRatio);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::textFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::textFlag, 0, this->textRatio);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::controlPointsFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::controlPointsFlag, 0, this->maxControlPoints);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::instanceFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::instanceFlag, 0, this->instanceRatio);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::startFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::startFlag, 0, this->startFrame);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperStressCommand::endFlag))
+	{
+
+		status = argDatabase.getFlagArgument(PointHelperStressCommand::endFlag, 0, this->endFrame);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	this->animate = argDatabase.isFlagSet(PointHelperStressCommand::animateFlag);
+	this->timing = !argDatabase.isFlagSet(PointHelperStressCommand::noTimingFlag);
+
+	// Validate settings
+	//
+	if (this->count < 1 || this->shapesPerHelper < 0 || this->endFrame < this->startFrame)
+	{
+
+		MGlobal::displayError("pointHelperStress: -count must be positive, -shapesPerHelper cannot be negative and -end cannot precede -start!");
+		return MS::kInvalidParameter;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperStressCommand::parseShapes(const MString& shapes)
+/**
+Parses a shape mix such as "cross box:2 sphere:0.5" into drawable weights.
+Drawables that are not listed are never picked.
+
+@param shapes: Space or comma separated drawable names with optional weights.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	std::fill(this->shapeWeights, this->shapeWeights + Drawable::NUM_SHAPES, 0.0);
+
+	MString separated(shapes);
+	separated.substitute(",", " ");
+
+	MStringArray tokens;
+
+	status = separated.split(' ', tokens);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	for (unsigned int i = 0; i < tokens.length(); i++)
+	{
+
+		MStringArray parts;
+
+		status = tokens[i].split(':', parts);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (parts.length() == 0)
+		{
+
+			continue;
+
+		}
+
+		unsigned int id = static_cast<unsigned int>(Drawable::findShape(parts[0]));
+		double weight = (parts.length() > 1) ? parts[1].asDouble() : 1.0;
+
+		if (id >= Drawable::NUM_SHAPES || weight < 0.0)
+		{
+
+			MGlobal::displayError("pointHelperStress: invalid shape \"" + tokens[i] + "\"!");
+			return MS::kInvalidParameter;
+
+		}
+
+		this->shapeWeights[id] = weight;
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperStressCommand::createHelpers()
+/**
+Creates the stress scene through this command's modifier so it can be undone in one step.
+Every random value is drawn in a fixed order from a generator seeded by -seed.
+
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	StressRandom random(static_cast<uint64_t>(this->seed));
+
+	// Create transforms with point helper shapes
+	//
+	MObjectArray transforms(this->count);
+
+	for (int i = 0; i < this->count; i++)
+	{
+
+		transforms[i] = this->dagModifier.createNode("pointHelper", MObject::kNullObj, &status);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	}
+
+	status = this->dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Scatter the helpers through a cube that grows with the count so the density stays constant
+	//
+	const double extent = 10.0 * std::cbrt(static_cast<double>(this->count));
+
+	double totalWeight = 0.0;
+
+	for (unsigned int i = 0; i < Drawable::NUM_SHAPES; i++)
+	{
+
+		totalWeight += this->shapeWeights[i];
+
+	}
+
+	MDagPath dagPath;
+	MFnDependencyNode fnTransform;
+	MFnAnimCurve fnAnimCurve;
+
+	this->numInstances = 0;
+
+	for (int i = 0; i < this->count; i++)
+	{
+
+		status = MDagPath::getAPathTo(transforms[i], dagPath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = fnTransform.setObject(transforms[i]);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		status = dagPath.extendToShape();
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		MObject shape = dagPath.node();
+
+		// Place transform
+		//
+		const char* translateNames[3] = { "translateX", "translateY", "translateZ" };
+		const char* rotateNames[3] = { "rotateX", "rotateY", "rotateZ" };
+
+		double translate[3], rotate[3];
+
+		for (int j = 0; j < 3; j++)
+		{
+
+			translate[j] = random.uniform(-extent, extent);
+			rotate[j] = random.uniform(-Drawable::PI, Drawable::PI);
+
+			this->dagModifier.newPlugValueDouble(fnTransform.findPlug(translateNames[j], false), translate[j]);
+			this->dagModifier.newPlugValueDouble(fnTransform.findPlug(rotateNames[j], false), rotate[j]);
+
+		}
+
+		// Pick drawables by weight without replacement
+		//
+		bool enabled[Drawable::NUM_SHAPES] = { false };
+		double remainingWeight = totalWeight;
+
+		for (int j = 0; j < this->shapesPerHelper && remainingWeight > 0.0; j++)
+		{
+
+			double pick = random.uniform(0.0, remainingWeight);
+			unsigned int id = Drawable::NUM_SHAPES;
+
+			for (unsigned int k = 0; k < Drawable::NUM_SHAPES; k++)
+			{
+
+				if (enabled[k] || this->shapeWeights[k] <= 0.0)
+				{
+
+					continue;
+
+				}
+
+				id = k;
+				pick -= this->shapeWeights[k];
+
+				if (pick < 0.0)
+				{
+
+					break;
+
+				}
+
+			}
+
+			if (id == Drawable::NUM_SHAPES)
+			{
+
+				break;
+
+			}
+
+			enabled[id] = true;
+			remainingWeight -= this->shapeWeights[id];
+
+		}
+
+		int flags = 0;
+
+		for (unsigned int j = 0; j < Drawable::NUM_SHAPES; j++)
+		{
+
+			flags |= enabled[j] ? (1 << j) : 0;
+
+		}
+
+		this->dagModifier.newPlugValueInt(MPlug(shape, PointHelper::shapeFlags), flags);
+
+		// Edit appearance
+		//
+		this->dagModifier.newPlugValueDouble(MPlug(shape, PointHelper::size), random.uniform(0.5, 2.0));
+		this->dagModifier.newPlugValueBool(MPlug(shape, PointHelper::fill), random.chance(this->fillRatio));
+
+		if (random.chance(this->textRatio))
+		{
+
+			MString label("helper");
+			label += i;
+
+			this->dagModifier.newPlugValueString(MPlug(shape, PointHelper::text).elementByLogicalIndex(0), label);
+
+		}
+
+		// Add control points
+		//
+		int numControlPoints = (this->maxControlPoints > 0) ? random.integer(0, this->maxControlPoints) : 0;
+
+		for (int j = 0; j < numControlPoints; j++)
+		{
+
+			MPlug element = MPlug(shape, PointHelper::controlPoints).elementByLogicalIndex(j);
+
+			for (unsigned int k = 0; k < 3; k++)
+			{
+
+				this->dagModifier.newPlugValueDouble(element.child(k), random.uniform(-1.0, 1.0));
+
+			}
+
+		}
+
+		// Instance the shape under a second transform
+		//
+		if (random.chance(this->instanceRatio))
+		{
+
+			MObject instance = this->dagModifier.createNode("transform", MObject::kNullObj, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			status = this->dagModifier.doIt();
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			MFnDependencyNode fnInstance(instance);
+			this->dagModifier.newPlugValueDouble(fnInstance.findPlug("translateX", false), translate[0] + 1.0);
+			this->dagModifier.newPlugValueDouble(fnInstance.findPlug("translateY", false), translate[1]);
+			this->dagModifier.newPlugValueDouble(fnInstance.findPlug("translateZ", false), translate[2]);
+
+			MDagPath instancePath;
+
+			status = MDagPath::getAPathTo(instance, instancePath);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			this->dagModifier.commandToExecute("parent -add -shape \"" + dagPath.fullPathName() + "\" \"" + instancePath.fullPathName() + "\"");
+			this->numInstances++;
+
+		}
+
+		// Key translateY and rotateY over the frame range
+		//
+		if (this->animate)
+		{
+
+			const MTime start(static_cast<double>(this->startFrame), MTime::uiUnit());
+			const MTime end(static_cast<double>(this->endFrame), MTime::uiUnit());
+
+			const double bounce = random.uniform(1.0, 5.0);
+			const double spin = random.uniform(-Drawable::PI, Drawable::PI);
+
+			fnAnimCurve.create(fnTransform.findPlug("translateY", false), &this->dagModifier, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			fnAnimCurve.addKey(start, translate[1]);
+			fnAnimCurve.addKey(end, translate[1] + bounce);
+
+			fnAnimCurve.create(fnTransform.findPlug("rotateY", false), &this->dagModifier, &status);
+			CHECK_MSTATUS_AND_RETURN_IT(status);
+
+			fnAnimCurve.addKey(start, rotate[1]);
+			fnAnimCurve.addKey(end, rotate[1] + spin);
+
+		}
+
+	}
+
+	status = this->dagModifier.doIt();
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	return MS::kSuccess;
+
+};
+
+
+MStatus PointHelperStressCommand::timeRefreshes(std::string& json)
+/**
+Steps through the frame range, forcing a viewport refresh on each frame, and serializes the timings.
+In batch mode there is no viewport so only the time change is measured.
+The draw counters are reset beforehand so they only cover the timed frames.
+
+@param json: The passed string to populate.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Find the viewport
+	//
+	bool refresh = MGlobal::mayaState() == MGlobal::kInteractive;
+	M3dView view;
+
+	if (refresh)
+	{
+
+		view = M3dView::active3dView(&status);
+		refresh = status == MS::kSuccess;
+
+	}
+
+	// Time each frame
+	//
+	using Clock = std::chrono::steady_clock;
+
+	const MTime originalTime = MAnimControl::currentTime();
+	const int numFrames = (this->endFrame - this->startFrame) + 1;
+
+	std::vector<double> frameMs(numFrames);
+
+	PointHelperStats::reset();
+
+	Clock::time_point begin = Clock::now();
+
+	for (int i = 0; i < numFrames; i++)
+	{
+
+		Clock::time_point start = Clock::now();
+
+		status = MAnimControl::setCurrentTime(MTime(static_cast<double>(this->startFrame + i), MTime::uiUnit()));
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		if (refresh)
+		{
+
+			view.refresh(false, true);
+
+		}
+
+		frameMs[i] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	}
+
+	double totalSeconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+	status = MAnimControl::setCurrentTime(originalTime);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	// Compute nearest-rank percentiles
+	//
+	std::vector<double> sorted(frameMs);
+	std::sort(sorted.begin(), sorted.end());
+
+	auto percentile = [&sorted](const double p) -> double
+	{
+
+		size_t rank = static_cast<size_t>(std::ceil((p / 100.0) * static_cast<double>(sorted.size())));
+		return sorted[(rank > 0) ? rank - 1 : 0];
+
+	};
+
+	double meanMs = 0.0;
+
+	for (double value : frameMs)
+	{
+
+		meanMs += value;
+
+	}
+
+	meanMs /= static_cast<double>(numFrames);
+
+	// Serialize results
+	//
+	std::ostringstream stream;
+	stream << "{\"helpers\": " << this->count;
+	stream << ", \"instances\": " << this->numInstances;
+	stream << ", \"seed\": " << this->seed;
+	stream << ", \"frames\": " << numFrames;
+	stream << ", \"refresh\": " << (refresh ? "true" : "false");
+	stream << ", \"fps\": " << ((totalSeconds > 0.0) ? static_cast<double>(numFrames) / totalSeconds : 0.0);
+	stream << ", \"frameMs\": {\"mean\": " << meanMs;
+	stream << ", \"p50\": " << percentile(50.0);
+	stream << ", \"p90\": " << percentile(90.0);
+	stream << ", \"p95\": " << percentile(95.0);
+	stream << ", \"p99\": " << percentile(99.0);
+	stream << ", \"max\": " << sorted.back() << "}";
+	stream << ", \"stats\": " << PointHelperStats::report(false);
+	stream << "}";
+
+	json = stream.str();
+
+	return MS::kSuccess;
+
+};
+
+
+void* PointHelperStressCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperStressCommand
+*/
+{
+
+	return new PointHelperStressCommand();
+
+};
+
+
+MSyntax PointHelperStressCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::countFlag, PointHelperStressCommand::countLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::seedFlag, PointHelperStressCommand::seedLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::shapesFlag, PointHelperStressCommand::shapesLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::shapesPerHelperFlag, PointHelperStressCommand::shapesPerHelperLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::fillFlag, PointHelperStressCommand::fillLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::textFlag, PointHelperStressCommand::textLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::controlPointsFlag, PointHelperStressCommand::controlPointsLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::instanceFlag, PointHelperStressCommand::instanceLongFlag, MSyntax::kDouble));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::animateFlag, PointHelperStressCommand::animateLongFlag));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::startFlag, PointHelperStressCommand::startLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::endFlag, PointHelperStressCommand::endLongFlag, MSyntax::kLong));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperStressCommand::noTimingFlag, PointHelperStressCommand::noTimingLongFlag));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
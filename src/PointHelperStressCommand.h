@@ -0,0 +1,99 @@
+#ifndef _POINT_HELPER_STRESS_COMMAND
+#define _POINT_HELPER_STRESS_COMMAND
+//
+// File: PointHelperStressCommand.h
+//
+// Command: pointHelperStress
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperNode.h"
+#include "PointHelperStats.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MDagModifier.h>
+#include <maya/MDagPath.h>
+#include <maya/MFnAnimCurve.h>
+#include <maya/MAnimControl.h>
+#include <maya/MTime.h>
+#include <maya/MString.h>
+
+#include <cstdint>
+#include <string>
+
+
+class PointHelperStressCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperStressCommand();
+	virtual						~PointHelperStressCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	MStatus				redoIt();
+	virtual	MStatus				undoIt();
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+protected:
+
+			MStatus				parseArguments(const MArgList& args);
+			MStatus				parseShapes(const MString& shapes);
+			MStatus				createHelpers();
+			MStatus				timeRefreshes(std::string& json);
+
+			MDagModifier		dagModifier;
+
+			int					count;
+			int					seed;
+			double				shapeWeights[Drawable::NUM_SHAPES];
+			int					shapesPerHelper;
+			double				fillRatio;
+			double				textRatio;
+			int					maxControlPoints;
+			double				instanceRatio;
+			bool				animate;
+			int					startFrame;
+			int					endFrame;
+			bool				timing;
+
+			unsigned int		numInstances;
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			countFlag;
+	static	const char*			countLongFlag;
+	static	const char*			seedFlag;
+	static	const char*			seedLongFlag;
+	static	const char*			shapesFlag;
+	static	const char*			shapesLongFlag;
+	static	const char*			shapesPerHelperFlag;
+	static	const char*			shapesPerHelperLongFlag;
+	static	const char*			fillFlag;
+	static	const char*			fillLongFlag;
+	static	const char*			textFlag;
+	static	const char*			textLongFlag;
+	static	const char*			controlPointsFlag;
+	static	const char*			controlPointsLongFlag;
+	static	const char*			instanceFlag;
+	static	const char*			instanceLongFlag;
+	static	const char*			animateFlag;
+	static	const char*			animateLongFlag;
+	static	const char*			startFlag;
+	static	const char*			startLongFlag;
+	static	const char*			endFlag;
+	static	const char*			endLongFlag;
+	static	const char*			noTimingFlag;
+	static	const char*			noTimingLongFlag;
+
+};
+#endif
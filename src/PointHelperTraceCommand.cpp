@@ -0,0 +1,141 @@
+//
+// File: PointHelperTraceCommand.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperTraceCommand.h"
+
+
+const MString	PointHelperTraceCommand::commandName("pointHelperTrace");
+
+const char*		PointHelperTraceCommand::enableFlag = "-e";
+const char*		PointHelperTraceCommand::enableLongFlag = "-enable";
+const char*		PointHelperTraceCommand::flushFlag = "-f";
+const char*		PointHelperTraceCommand::flushLongFlag = "-flush";
+const char*		PointHelperTraceCommand::clearFlag = "-c";
+const char*		PointHelperTraceCommand::clearLongFlag = "-clear";
+
+
+PointHelperTraceCommand::PointHelperTraceCommand() : MPxCommand() {};
+PointHelperTraceCommand::~PointHelperTraceCommand() {};
+
+
+MStatus PointHelperTraceCommand::doIt(const MArgList& args)
+/**
+Controls the Chrome trace-event tracer.
+The enable flag starts or stops recording, the flush flag writes every buffered event to a JSON file and the clear flag discards them.
+Returns the number of events written when flushing, otherwise whether tracing is enabled.
+
+@param args: The command arguments.
+@return: Return status.
+*/
+{
+
+	MStatus status;
+
+	// Parse arguments
+	//
+	MArgDatabase argDatabase(this->syntax(), args, &status);
+	CHECK_MSTATUS_AND_RETURN_IT(status);
+
+	if (argDatabase.isFlagSet(PointHelperTraceCommand::clearFlag))
+	{
+
+		PointHelperTracer::clear();
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperTraceCommand::enableFlag))
+	{
+
+		bool enabled = false;
+
+		status = argDatabase.getFlagArgument(PointHelperTraceCommand::enableFlag, 0, enabled);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		PointHelperTracer::setEnabled(enabled);
+
+	}
+
+	if (argDatabase.isFlagSet(PointHelperTraceCommand::flushFlag))
+	{
+
+		MString filePath;
+
+		status = argDatabase.getFlagArgument(PointHelperTraceCommand::flushFlag, 0, filePath);
+		CHECK_MSTATUS_AND_RETURN_IT(status);
+
+		size_t numEvents = 0;
+		status = PointHelperTracer::flush(filePath, numEvents);
+
+		if (!status)
+		{
+
+			this->displayError("Unable to write trace to: " + filePath);
+			return status;
+
+		}
+
+		this->setResult(static_cast<int>(numEvents));
+
+	}
+	else
+	{
+
+		this->setResult(PointHelperTracer::isEnabled());
+
+	}
+
+	return MS::kSuccess;
+
+};
+
+
+bool PointHelperTraceCommand::isUndoable() const
+/**
+Tracer state is not undoable.
+
+@return: bool
+*/
+{
+
+	return false;
+
+};
+
+
+void* PointHelperTraceCommand::creator()
+/**
+This function is called by Maya when a new instance is requested.
+See pluginMain.cpp for details.
+
+@return: PointHelperTraceCommand
+*/
+{
+
+	return new PointHelperTraceCommand();
+
+};
+
+
+MSyntax PointHelperTraceCommand::newSyntax()
+/**
+Returns the syntax for this command.
+
+@return: MSyntax
+*/
+{
+
+	MSyntax syntax;
+
+	CHECK_MSTATUS(syntax.addFlag(PointHelperTraceCommand::enableFlag, PointHelperTraceCommand::enableLongFlag, MSyntax::kBoolean));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperTraceCommand::flushFlag, PointHelperTraceCommand::flushLongFlag, MSyntax::kString));
+	CHECK_MSTATUS(syntax.addFlag(PointHelperTraceCommand::clearFlag, PointHelperTraceCommand::clearLongFlag));
+
+	syntax.enableQuery(false);
+	syntax.enableEdit(false);
+
+	return syntax;
+
+};
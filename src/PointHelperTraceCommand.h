@@ -0,0 +1,46 @@
+#ifndef _POINT_HELPER_TRACE_COMMAND
+#define _POINT_HELPER_TRACE_COMMAND
+//
+// File: PointHelperTraceCommand.h
+//
+// Command: pointHelperTrace
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperTracer.h"
+
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MArgDatabase.h>
+#include <maya/MSyntax.h>
+#include <maya/MString.h>
+
+
+class PointHelperTraceCommand : public MPxCommand
+{
+
+public:
+
+								PointHelperTraceCommand();
+	virtual						~PointHelperTraceCommand();
+
+	virtual	MStatus				doIt(const MArgList& args);
+	virtual	bool				isUndoable() const;
+
+	static	void*				creator();
+	static	MSyntax				newSyntax();
+
+public:
+
+	static	const MString		commandName;
+
+	static	const char*			enableFlag;
+	static	const char*			enableLongFlag;
+	static	const char*			flushFlag;
+	static	const char*			flushLongFlag;
+	static	const char*			clearFlag;
+	static	const char*			clearLongFlag;
+
+};
+#endif
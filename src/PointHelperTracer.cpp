@@ -0,0 +1,446 @@
+//
+// File: PointHelperTracer.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "PointHelperTracer.h"
+
+#include <maya/MFnDependencyNode.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+
+namespace PointHelperTracer
+{
+
+	static const char* CATEGORY = "PointHelper";
+
+
+	struct Registry
+	{
+
+		std::mutex					mutex;
+		std::vector<ThreadBuffer*>	buffers;
+		std::vector<Event>			pending;
+		std::atomic<bool>			enabled{ false };
+		std::chrono::steady_clock::time_point	epoch = std::chrono::steady_clock::now();
+
+	};
+
+
+	static Registry& registry()
+	/**
+	Returns the registry of per-thread buffers.
+	Buffers are kept for the lifetime of the plugin since worker threads are pooled and outlive any single trace.
+
+	@return: Registry
+	*/
+	{
+
+		static Registry instance;
+		return instance;
+
+	};
+
+
+	static ThreadBuffer* threadBuffer()
+	/**
+	Returns the calling thread's buffer, registering a new one on first use.
+
+	@return: ThreadBuffer*
+	*/
+	{
+
+		static thread_local ThreadBuffer* buffer = nullptr;
+
+		if (buffer == nullptr)
+		{
+
+			Registry& instance = registry();
+			std::lock_guard<std::mutex> lock(instance.mutex);
+
+			buffer = new ThreadBuffer(static_cast<uint32_t>(instance.buffers.size() + 1));
+			instance.buffers.push_back(buffer);
+
+		}
+
+		return buffer;
+
+	};
+
+
+	static void writeEscaped(std::ostream& stream, const char* text)
+	/**
+	Writes the supplied text as a JSON string body.
+
+	@param stream: The stream to write to.
+	@param text: The text to escape.
+	@return: void
+	*/
+	{
+
+		for (const char* character = text; *character != '\0'; character++)
+		{
+
+			switch (*character)
+			{
+
+			case '"': stream << "\\\""; break;
+			case '\\': stream << "\\\\"; break;
+			case '\n': stream << "\\n"; break;
+			case '\t': stream << "\\t"; break;
+			default:
+
+				if (static_cast<unsigned char>(*character) >= 0x20)
+				{
+
+					stream << *character;
+
+				}
+
+				break;
+
+			}
+
+		}
+
+	};
+
+};
+
+using namespace PointHelperTracer;
+
+
+ThreadBuffer::ThreadBuffer(uint32_t threadId) : id(threadId), events(BUFFER_CAPACITY), head(0), tail(0), numDropped(0) {};
+ThreadBuffer::~ThreadBuffer() {};
+
+
+bool ThreadBuffer::push(const Event& event)
+/**
+Appends an event to the ring.
+Must only be called from the owning thread.
+
+@param event: The event to append.
+@return: bool
+*/
+{
+
+	size_t head = this->head.load(std::memory_order_relaxed);
+	size_t tail = this->tail.load(std::memory_order_acquire);
+
+	if ((head - tail) >= this->events.size())
+	{
+
+		this->numDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+
+	}
+
+	this->events[head % this->events.size()] = event;
+	this->head.store(head + 1, std::memory_order_release);
+
+	return true;
+
+};
+
+
+size_t ThreadBuffer::drain(std::vector<Event>& events)
+/**
+Moves every published event into the supplied array.
+Only one thread may drain at a time, see flush().
+
+@param events: The passed array to append to.
+@return: size_t
+*/
+{
+
+	size_t tail = this->tail.load(std::memory_order_relaxed);
+	size_t head = this->head.load(std::memory_order_acquire);
+
+	for (size_t i = tail; i < head; i++)
+	{
+
+		events.push_back(this->events[i % this->events.size()]);
+
+	}
+
+	this->tail.store(head, std::memory_order_release);
+
+	return head - tail;
+
+};
+
+
+uint32_t ThreadBuffer::threadId() const
+/**
+Returns the sequential id assigned to the owning thread.
+
+@return: uint32_t
+*/
+{
+
+	return this->id;
+
+};
+
+
+uint64_t ThreadBuffer::dropped() const
+/**
+Returns the number of events dropped because the ring was full.
+
+@return: uint64_t
+*/
+{
+
+	return this->numDropped.load(std::memory_order_relaxed);
+
+};
+
+
+Scope::Scope() : name(nullptr) {};
+
+
+Scope::~Scope()
+/**
+Destructor.
+*/
+{
+
+	if (this->name != nullptr)
+	{
+
+		PointHelperTracer::record('E', this->name);
+
+	}
+
+};
+
+
+void Scope::begin(const char* name, const MObject& node, const char* message)
+/**
+Writes the begin event for this scope.
+
+@param name: The event name, this must be a string literal or otherwise outlive the trace.
+@param node: The optional node associated with the event.
+@param message: Optional text that is copied into the begin event.
+@return: void
+*/
+{
+
+	this->name = name;
+	PointHelperTracer::record('B', name, node, message);
+
+};
+
+
+bool PointHelperTracer::isEnabled()
+/**
+Returns whether trace events are currently recorded.
+
+@return: bool
+*/
+{
+
+	return registry().enabled.load(std::memory_order_relaxed);
+
+};
+
+
+void PointHelperTracer::setEnabled(bool enabled)
+/**
+Updates whether trace events are recorded.
+
+@param enabled: The new state.
+@return: void
+*/
+{
+
+	registry().enabled.store(enabled, std::memory_order_relaxed);
+
+};
+
+
+void PointHelperTracer::record(char phase, const char* name, const MObject& node, const char* message)
+/**
+Writes a single event to the calling thread's buffer.
+
+@param phase: The trace event phase, 'B' for begin, 'E' for end and 'i' for instant events.
+@param name: The event name, this must be a string literal or otherwise outlive the trace.
+@param node: The optional node associated with the event.
+@param message: Optional text that is copied into the event, truncated to MESSAGE_LENGTH.
+@return: void
+*/
+{
+
+	Event event;
+	event.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - registry().epoch).count());
+	event.name = name;
+	event.category = CATEGORY;
+	event.phase = phase;
+	event.node = node;
+	event.message[0] = '\0';
+
+	if (message != nullptr)
+	{
+
+		std::strncpy(event.message, message, MESSAGE_LENGTH - 1);
+		event.message[MESSAGE_LENGTH - 1] = '\0';
+
+	}
+
+	threadBuffer()->push(event);
+
+};
+
+
+size_t PointHelperTracer::flush(std::string& json)
+/**
+Drains every thread buffer and serializes the events as Chrome trace-event JSON.
+Node names are resolved here, rather than when recording, so this must be called from the main thread.
+
+@param json: The string to write to.
+@return: size_t
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	std::ostringstream stream;
+	stream << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+	size_t numEvents = 0;
+	uint64_t numDropped = 0;
+
+	for (ThreadBuffer* buffer : instance.buffers)
+	{
+
+		instance.pending.clear();
+		buffer->drain(instance.pending);
+
+		numDropped += buffer->dropped();
+
+		stream << (numEvents > 0 ? ",\n" : "\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->threadId() << ", \"args\": {\"name\": \"PointHelper thread " << buffer->threadId() << "\"}}";
+		numEvents++;
+
+		for (const Event& event : instance.pending)
+		{
+
+			stream << ",\n{\"name\": \"";
+			writeEscaped(stream, event.name);
+			stream << "\", \"cat\": \"" << event.category << "\", \"ph\": \"" << event.phase << "\"";
+			stream << ", \"ts\": " << (event.timestamp / 1000) << "." << ((event.timestamp % 1000) / 100) << ((event.timestamp % 100) / 10) << (event.timestamp % 10);
+			stream << ", \"pid\": 1, \"tid\": " << buffer->threadId();
+
+			if (event.phase == 'i')
+			{
+
+				stream << ", \"s\": \"t\"";
+
+			}
+
+			MObjectHandle handle = event.node;
+			bool hasNode = handle.isValid() && handle.isAlive() && !handle.object().isNull();
+
+			if (hasNode || event.message[0] != '\0')
+			{
+
+				stream << ", \"args\": {";
+
+				if (hasNode)
+				{
+
+					MFnDependencyNode fnNode(handle.object());
+					stream << "\"node\": \"";
+					writeEscaped(stream, fnNode.name().asChar());
+					stream << "\"";
+
+				}
+
+				if (event.message[0] != '\0')
+				{
+
+					stream << (hasNode ? ", " : "") << "\"message\": \"";
+					writeEscaped(stream, event.message);
+					stream << "\"";
+
+				}
+
+				stream << "}";
+
+			}
+
+			stream << "}";
+			numEvents++;
+
+		}
+
+	}
+
+	stream << "\n], \"otherData\": {\"droppedEvents\": " << numDropped << "}}";
+
+	json = stream.str();
+
+	return numEvents;
+
+};
+
+
+MStatus PointHelperTracer::flush(const MString& filePath, size_t& numEvents)
+/**
+Drains every thread buffer and writes the events to the supplied file.
+
+@param filePath: The path of the JSON file to write.
+@param numEvents: The number of events written.
+@return: Return status.
+*/
+{
+
+	std::string json;
+	numEvents = PointHelperTracer::flush(json);
+
+	std::ofstream file(filePath.asChar(), std::ios::out | std::ios::trunc);
+
+	if (!file.is_open())
+	{
+
+		return MS::kFailure;
+
+	}
+
+	file << json;
+	file.close();
+
+	return file.good() ? MS::kSuccess : MS::kFailure;
+
+};
+
+
+void PointHelperTracer::clear()
+/**
+Discards every buffered event.
+
+@return: void
+*/
+{
+
+	Registry& instance = registry();
+	std::lock_guard<std::mutex> lock(instance.mutex);
+
+	for (ThreadBuffer* buffer : instance.buffers)
+	{
+
+		instance.pending.clear();
+		buffer->drain(instance.pending);
+
+	}
+
+	instance.pending.clear();
+
+};
@@ -0,0 +1,108 @@
+#ifndef _POINT_HELPER_TRACER
+#define _POINT_HELPER_TRACER
+//
+// File: PointHelperTracer.h
+//
+// Author: Ben Singleton
+//
+
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MString.h>
+#include <maya/MStatus.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace PointHelperTracer
+{
+
+	static const size_t BUFFER_CAPACITY = 16384;
+	static const size_t MESSAGE_LENGTH = 64;
+
+
+	struct Event
+	{
+
+		uint64_t		timestamp;
+		const char*		name;
+		const char*		category;
+		char			phase;
+		MObjectHandle	node;
+		char			message[MESSAGE_LENGTH];
+
+	};
+
+
+	class ThreadBuffer
+	/**
+	Single producer, single consumer ring of trace events owned by one thread.
+	The owning thread pushes without locking, flush() drains from any thread.
+	Events pushed while the ring is full are dropped and counted.
+	*/
+	{
+
+	public:
+
+								ThreadBuffer(uint32_t threadId);
+		virtual					~ThreadBuffer();
+
+				bool			push(const Event& event);
+				size_t			drain(std::vector<Event>& events);
+
+				uint32_t		threadId() const;
+				uint64_t		dropped() const;
+
+	protected:
+
+				uint32_t				id;
+				std::vector<Event>		events;
+				std::atomic<size_t>		head;
+				std::atomic<size_t>		tail;
+				std::atomic<uint64_t>	numDropped;
+
+	};
+
+
+	class Scope
+	/**
+	Writes a begin event when opened and the matching end event when destroyed.
+	Use POINT_HELPER_TRACE() so the event arguments are only evaluated when tracing is enabled.
+	*/
+	{
+
+	public:
+
+								Scope();
+								~Scope();
+
+				void			begin(const char* name, const MObject& node = MObject::kNullObj, const char* message = nullptr);
+
+	protected:
+
+				const char*		name;
+
+	};
+
+
+	bool			isEnabled();
+	void			setEnabled(bool enabled);
+
+	void			record(char phase, const char* name, const MObject& node = MObject::kNullObj, const char* message = nullptr);
+
+	size_t			flush(std::string& json);
+	MStatus			flush(const MString& filePath, size_t& numEvents);
+	void			clear();
+
+};
+
+
+#define POINT_HELPER_TRACER_CONCAT_IMPL(a, b) a##b
+#define POINT_HELPER_TRACER_CONCAT(a, b) POINT_HELPER_TRACER_CONCAT_IMPL(a, b)
+
+#define POINT_HELPER_TRACE(...) PointHelperTracer::Scope POINT_HELPER_TRACER_CONCAT(traceScope, __LINE__); if (PointHelperTracer::isEnabled()) { POINT_HELPER_TRACER_CONCAT(traceScope, __LINE__).begin(__VA_ARGS__); }
+
+#endif
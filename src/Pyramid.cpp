@@ -8,6 +8,7 @@
 
 
 MObject	Pyramid::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Pyramid::MESH_BUFFERS = Drawable::MeshBuffers();
 
 
 Pyramid::Pyramid() : Drawable::AbstractDrawable()
@@ -39,6 +40,11 @@ Constructor.
 		Pyramid::MESH_DATA = Drawable::createMeshData(points, polygonCounts, polygonConnects, edgeSmoothings, &status);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Pyramid::MESH_DATA, Pyramid::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -47,42 +53,29 @@ Constructor.
 Pyramid::~Pyramid() {};
 
 
-void Pyramid::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Pyramid::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a pyramid.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Pyramid::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	status = Drawable::getLines(meshData, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Pyramid::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Pyramid::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Pyramid::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
 /**
 Draws a pyramid.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -93,12 +86,25 @@ Draws a pyramid.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
+
+};
+
 
-};
\ No newline at end of file
+size_t Pyramid::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every pyramid.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Pyramid::MESH_DATA) + Drawable::sizeOf(Pyramid::MESH_BUFFERS);
+
+};
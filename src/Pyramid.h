@@ -17,16 +17,15 @@ public:
 							Pyramid();
 	virtual					~Pyramid();
 
-	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData);
-	virtual	void			draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
+	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void			draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
+
+	virtual	size_t			meshDataMemoryUsage();
 
 protected:
 
 	static	MObject			MESH_DATA;
-
-			MPointArray		triangles;
-			MVectorArray	normals;
-			MPointArray		lines;
+	static	Drawable::MeshBuffers	MESH_BUFFERS;
 
 private:
 
@@ -0,0 +1,112 @@
+//
+// File: RecordingDrawManager.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "RecordingDrawManager.h"
+
+using namespace Drawable;
+
+
+RecordingDrawManager::RecordingDrawManager() : AbstractDrawManager()
+/**
+Constructor.
+*/
+{
+
+	this->logging = true;
+	this->reset();
+
+};
+
+
+RecordingDrawManager::~RecordingDrawManager() {};
+
+
+void RecordingDrawManager::reset()
+/**
+Clears the recorded log and counters.
+The log's capacity is kept so repeated frames do not reallocate.
+
+@return: void
+*/
+{
+
+	this->records.clear();
+	this->resetCounts();
+
+};
+
+
+void RecordingDrawManager::setLogging(bool logging)
+/**
+Updates whether individual calls are appended to the log.
+Counters are always updated, disabling the log keeps long benchmarks from growing memory.
+
+@param logging: The new logging state.
+@return: void
+*/
+{
+
+	this->logging = logging;
+
+};
+
+
+void RecordingDrawManager::record(DrawCall call, uint32_t vertexCount, uint32_t primitiveCount)
+/**
+Records a single draw call.
+
+@param call: The draw call type.
+@param vertexCount: The number of vertices submitted by the call.
+@param primitiveCount: The number of primitives submitted by the call.
+@return: void
+*/
+{
+
+	this->count(call);
+	this->tally(vertexCount, primitiveCount);
+
+	if (this->logging)
+	{
+
+		this->records.push_back(DrawRecord{ call, vertexCount });
+
+	}
+
+};
+
+
+const std::vector<DrawRecord>& RecordingDrawManager::log() const
+/**
+Returns the recorded calls in submission order.
+
+@return: std::vector<DrawRecord>
+*/
+{
+
+	return this->records;
+
+};
+
+
+void RecordingDrawManager::beginDrawable() { this->record(DrawCall::BeginDrawable, 0, 0); };
+void RecordingDrawManager::endDrawable() { this->record(DrawCall::EndDrawable, 0, 0); };
+
+void RecordingDrawManager::beginDrawInXray() { this->record(DrawCall::BeginDrawInXray, 0, 0); };
+void RecordingDrawManager::endDrawInXray() { this->record(DrawCall::EndDrawInXray, 0, 0); };
+
+void RecordingDrawManager::setColor(const MColor& color) { this->record(DrawCall::SetColor, 0, 0); };
+void RecordingDrawManager::setDepthPriority(unsigned int priority) { this->record(DrawCall::SetDepthPriority, 0, 0); };
+void RecordingDrawManager::setLineWidth(float width) { this->record(DrawCall::SetLineWidth, 0, 0); };
+void RecordingDrawManager::setLineStyle(MHWRender::MUIDrawManager::LineStyle style) { this->record(DrawCall::SetLineStyle, 0, 0); };
+void RecordingDrawManager::setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style) { this->record(DrawCall::SetPaintStyle, 0, 0); };
+void RecordingDrawManager::setFontSize(unsigned int fontSize) { this->record(DrawCall::SetFontSize, 0, 0); };
+
+void RecordingDrawManager::mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal, const MColorArray* color) { this->record(DrawCall::Mesh, position.length(), AbstractDrawManager::primitiveCount(mode, position.length())); };
+void RecordingDrawManager::lineList(const MPointArray& points, bool draw2D) { this->record(DrawCall::LineList, points.length(), points.length() / 2); };
+void RecordingDrawManager::line(const MPoint& startPoint, const MPoint& endPoint) { this->record(DrawCall::Line, 2, 1); };
+void RecordingDrawManager::sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled) { this->record(DrawCall::Sphere, subdivisionsAxis * subdivisionsHeight, 2 * subdivisionsAxis * subdivisionsHeight); };
+void RecordingDrawManager::text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment) { this->record(DrawCall::Text, 1, 1); };
+void RecordingDrawManager::icon(const MPoint& position, const MString& name, float scale) { this->record(DrawCall::Icon, 1, 1); };
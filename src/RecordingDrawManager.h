@@ -0,0 +1,73 @@
+#ifndef _RECORDING_DRAW_MANAGER
+#define _RECORDING_DRAW_MANAGER
+//
+// File: RecordingDrawManager.h
+//
+// Author: Ben Singleton
+//
+
+#include "AbstractDrawManager.h"
+
+#include <vector>
+
+
+namespace Drawable
+{
+
+	struct DrawRecord
+	{
+
+		DrawCall	call;
+		uint32_t	vertexCount;
+
+	};
+
+
+	class RecordingDrawManager : public AbstractDrawManager
+	/**
+	Test double that records draw calls and vertex counts instead of drawing them.
+	Used to benchmark the draw path without a viewport and to assert on call counts.
+	*/
+	{
+
+	public:
+
+							RecordingDrawManager();
+		virtual				~RecordingDrawManager();
+
+		virtual	void		beginDrawable();
+		virtual	void		endDrawable();
+
+		virtual	void		beginDrawInXray();
+		virtual	void		endDrawInXray();
+
+		virtual	void		setColor(const MColor& color);
+		virtual	void		setDepthPriority(unsigned int priority);
+		virtual	void		setLineWidth(float width);
+		virtual	void		setLineStyle(MHWRender::MUIDrawManager::LineStyle style);
+		virtual	void		setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style);
+		virtual	void		setFontSize(unsigned int fontSize);
+
+		virtual	void		mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal = nullptr, const MColorArray* color = nullptr);
+		virtual	void		lineList(const MPointArray& points, bool draw2D);
+		virtual	void		line(const MPoint& startPoint, const MPoint& endPoint);
+		virtual	void		sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled);
+		virtual	void		text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment);
+		virtual	void		icon(const MPoint& position, const MString& name, float scale);
+
+				void		reset();
+				void		setLogging(bool logging);
+
+		const std::vector<DrawRecord>&	log() const;
+
+	protected:
+
+				void		record(DrawCall call, uint32_t vertexCount, uint32_t primitiveCount);
+
+				bool					logging;
+				std::vector<DrawRecord>	records;
+
+	};
+
+};
+#endif
@@ -8,6 +8,7 @@
 
 
 MObject	Sphere::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Sphere::MESH_BUFFERS = Drawable::MeshBuffers();
 double	Sphere::SPHERE_RADIUS = 0.5;
 int		Sphere::SUBDIVISIONS_AXIS = 40;
 int		Sphere::SUBDIVISIONS_HEIGHT = 40;
@@ -19,6 +20,8 @@ Constructor.
 */
 {
 
+	MStatus status;
+
 	// Check if mesh data is null
 	//
 	if (Sphere::MESH_DATA.isNull()) 
@@ -31,6 +34,20 @@ Constructor.
 
 		Drawable::sphere(MVector::zero, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS, Sphere::SUBDIVISIONS_HEIGHT, Sphere::MESH_DATA);
 
+		// Extract object space triangles shared by every instance
+		//
+		status = Drawable::getTriangles(Sphere::MESH_DATA, Sphere::MESH_BUFFERS.triangles, Sphere::MESH_BUFFERS.normals);
+		CHECK_MSTATUS(status);
+
+		// Build circle array for wireframe
+		//
+		std::vector<MPointArray> points(3);
+		points[0] = Drawable::circle(MVector::zero, MVector::xAxis, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS + 1);
+		points[1] = Drawable::circle(MVector::zero, MVector::yAxis, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS + 1);
+		points[2] = Drawable::circle(MVector::zero, MVector::zAxis, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS + 1);
+
+		Sphere::MESH_BUFFERS.lines = Drawable::stagger(points);
+
 	}
 
 };
@@ -39,49 +56,29 @@ Constructor.
 Sphere::~Sphere() {};
 
 
-void Sphere::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Sphere::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a cylinder.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
-	//
-	MObject meshData = Drawable::copyMeshData(Sphere::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Get mesh triangles
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Build circle array for wireframe
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	std::vector<MPointArray> points(3);
-	points[0] = Drawable::circle(MVector::zero, MVector::xAxis, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS + 1);
-	points[1] = Drawable::circle(MVector::zero, MVector::yAxis, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS + 1);
-	points[2] = Drawable::circle(MVector::zero, MVector::zAxis, Sphere::SPHERE_RADIUS, Sphere::SUBDIVISIONS_AXIS + 1);
-
-	this->lines = Drawable::stagger(points);
-	Drawable::transform(pointHelperData->objectMatrix, this->lines);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Sphere::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Sphere::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData) 
+void Sphere::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData) 
 /**
 Draws a sphere.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @param pointHelperData: Pointer to a data class with draw information from the associated point helper.
 @return: void
 */
@@ -93,12 +90,26 @@ Draws a sphere.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
+
+}
+
+
+
+size_t Sphere::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every sphere.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Sphere::MESH_DATA) + Drawable::sizeOf(Sphere::MESH_BUFFERS);
 
-}
\ No newline at end of file
+};
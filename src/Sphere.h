@@ -17,16 +17,15 @@ public:
 							Sphere();
 	virtual					~Sphere();
 
-	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData);
-	virtual	void			draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
+	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void			draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
+
+	virtual	size_t			meshDataMemoryUsage();
 
 protected:
 
-			MPointArray		triangles;
-			MVectorArray	normals;
-			MPointArray		lines;
-	
 	static	MObject			MESH_DATA;
+	static	Drawable::MeshBuffers	MESH_BUFFERS;
 	static	double			SPHERE_RADIUS;
 	static	int				SUBDIVISIONS_AXIS;
 	static	int				SUBDIVISIONS_HEIGHT;
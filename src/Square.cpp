@@ -8,6 +8,7 @@
 
 
 MObject		Square::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Square::MESH_BUFFERS = Drawable::MeshBuffers();
 MIntArray	Square::BOUNDARY = MIntArray();
 
 
@@ -44,6 +45,11 @@ Constructor.
 		status = Drawable::getBoundary(Square::MESH_DATA, Square::BOUNDARY);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Square::MESH_DATA, Square::BOUNDARY, Square::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -52,44 +58,29 @@ Constructor.
 Square::~Square() {};
 
 
-void Square::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Square::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a square.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Square::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Get lines from boundary
-	//
-	status = Drawable::getLines(meshData, Square::BOUNDARY, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Square::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Square::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Square::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
 /**
 Draws a square.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -102,12 +93,25 @@ Draws a square.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
-};
\ No newline at end of file
+};
+
+
+size_t Square::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every square.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Square::MESH_DATA) + Drawable::sizeOf(Square::BOUNDARY);
+
+};
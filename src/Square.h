@@ -17,18 +17,15 @@ public:
 							Square();
 	virtual					~Square();
 
-	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData);
-	virtual	void			draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData);
+	virtual	void			prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData);
+	virtual	void			draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData);
 
-protected:
-
-			MPointArray		triangles;
-			MVectorArray	normals;
-			MPointArray		lines;
+	virtual	size_t			meshDataMemoryUsage();
 
 private:
 
 	static	MObject		MESH_DATA;
+	static	Drawable::MeshBuffers	MESH_BUFFERS;
 	static	MIntArray	BOUNDARY;
 
 	const double POINTS[4][4] = 
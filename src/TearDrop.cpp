@@ -8,6 +8,7 @@
 
 
 MObject		TearDrop::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	TearDrop::MESH_BUFFERS = Drawable::MeshBuffers();
 MIntArray	TearDrop::BOUNDARY = MIntArray();
 double		TearDrop::TEARDROP_RADIUS = 0.5;
 int			TearDrop::SUBDIVISIONS_AXIS = 40;
@@ -64,6 +65,11 @@ Constructor.
 		MObject component = Drawable::createComponent(MFn::kMeshEdgeComponent, boundary, &status);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(TearDrop::MESH_DATA, TearDrop::BOUNDARY, TearDrop::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -72,44 +78,29 @@ Constructor.
 TearDrop::~TearDrop() {};
 
 
-void TearDrop::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void TearDrop::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a tear drop.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(TearDrop::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Get lines from boundary
-	//
-	status = Drawable::getLines(meshData, TearDrop::BOUNDARY, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), TearDrop::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void TearDrop::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData) 
+void TearDrop::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData) 
 /**
 Draws a box.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -124,12 +115,25 @@ Draws a box.
 		// Draw mesh
 		//
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
-};
\ No newline at end of file
+};
+
+
+size_t TearDrop::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every tearDrop.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(TearDrop::MESH_DATA) + Drawable::sizeOf(TearDrop::BOUNDARY);
+
+};
@@ -8,6 +8,7 @@
 
 
 MObject		Triangle::MESH_DATA = MObject::kNullObj;
+Drawable::MeshBuffers	Triangle::MESH_BUFFERS = Drawable::MeshBuffers();
 MIntArray	Triangle::BOUNDARY = MIntArray();
 
 
@@ -44,6 +45,11 @@ Constructor.
 		status = Drawable::getBoundary(Triangle::MESH_DATA, Triangle::BOUNDARY);
 		CHECK_MSTATUS(status);
 
+		// Extract object space buffers shared by every instance
+		//
+		status = Drawable::getMeshBuffers(Triangle::MESH_DATA, Triangle::BOUNDARY, Triangle::MESH_BUFFERS);
+		CHECK_MSTATUS(status);
+
 	}
 
 };
@@ -52,44 +58,29 @@ Constructor.
 Triangle::~Triangle() {};
 
 
-void Triangle::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, const MHWRender::MFrameContext& frameContext, PointHelperData* pointHelperData)
+void Triangle::prepareForDraw(const MDagPath& objPath, const MDagPath& cameraPath, PointHelperData* pointHelperData)
 /**
 Prepares to draw a triangle.
 
 @param objPath: The path to the object being drawn.
 @param cameraPath: The path to the camera that is being used to draw.
-@param frameContext: Frame level context information.
 @param PointHelperData: Data cached by the previous draw of the instance.
 @return: void
 */
 {
 
-	MStatus status;
-
-	// Copy mesh data
+	// Share the transformed buffers with every helper that has the same object matrix
 	//
-	MObject meshData = Drawable::copyMeshData(Triangle::MESH_DATA, pointHelperData->objectMatrix, &status);
-	CHECK_MSTATUS(status);
-
-	// Extrapolate data from mesh
-	//
-	status = Drawable::getTriangles(meshData, this->triangles, this->normals);
-	CHECK_MSTATUS(status);
-
-	// Get lines from boundary
-	//
-	status = Drawable::getLines(meshData, Triangle::BOUNDARY, this->lines);
-	CHECK_MSTATUS(status);
+	Drawable::GeometryCache::prepare(Drawable::GeometryKey(this->id, pointHelperData->objectMatrix), Triangle::MESH_BUFFERS, this->geometry);
 
 };
 
 
-void Triangle::draw(MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const PointHelperData* pointHelperData)
+void Triangle::draw(Drawable::AbstractDrawManager& drawManager, const PointHelperData* pointHelperData)
 /**
 Draws a triangle.
 
 @param drawManager: Interface used for drawing basic shapes inside the viewport.
-@param frameContext: Contains global information for the current render frame.
 @return: void
 */
 {
@@ -102,12 +93,25 @@ Draws a triangle.
 	{
 
 		drawManager.setPaintStyle(pointHelperData->shaded ? MHWRender::MUIDrawManager::kShaded : MHWRender::MUIDrawManager::kFlat);
-		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->triangles, &this->normals);
+		drawManager.mesh(MHWRender::MUIDrawManager::kTriangles, this->geometry->triangles, &this->geometry->normals);
 
 	}
 
 	// Draw lines and points
 	//
-	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->lines);
+	drawManager.mesh(MHWRender::MUIDrawManager::kLines, this->geometry->lines);
 
-};
\ No newline at end of file
+};
+
+
+size_t Triangle::meshDataMemoryUsage()
+/**
+Returns the bytes held by the mesh data shared between every triangle.
+
+@return: size_t
+*/
+{
+
+	return Drawable::sizeOfMeshData(Triangle::MESH_DATA) + Drawable::sizeOf(Triangle::BOUNDARY);
+
+};
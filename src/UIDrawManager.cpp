@@ -0,0 +1,163 @@
+//
+// File: UIDrawManager.cpp
+//
+// Author: Ben Singleton
+//
+
+#include "UIDrawManager.h"
+
+using namespace Drawable;
+
+
+UIDrawManager::UIDrawManager(MHWRender::MUIDrawManager& drawManager) : AbstractDrawManager(), drawManager(drawManager) {};
+UIDrawManager::~UIDrawManager() {};
+
+
+void UIDrawManager::beginDrawable()
+{
+
+	this->count(DrawCall::BeginDrawable);
+	this->drawManager.beginDrawable();
+
+};
+
+
+void UIDrawManager::endDrawable()
+{
+
+	this->count(DrawCall::EndDrawable);
+	this->drawManager.endDrawable();
+
+};
+
+
+void UIDrawManager::beginDrawInXray()
+{
+
+	this->count(DrawCall::BeginDrawInXray);
+	this->drawManager.beginDrawInXray();
+
+};
+
+
+void UIDrawManager::endDrawInXray()
+{
+
+	this->count(DrawCall::EndDrawInXray);
+	this->drawManager.endDrawInXray();
+
+};
+
+
+void UIDrawManager::setColor(const MColor& color)
+{
+
+	this->count(DrawCall::SetColor);
+	this->drawManager.setColor(color);
+
+};
+
+
+void UIDrawManager::setDepthPriority(unsigned int priority)
+{
+
+	this->count(DrawCall::SetDepthPriority);
+	this->drawManager.setDepthPriority(priority);
+
+};
+
+
+void UIDrawManager::setLineWidth(float width)
+{
+
+	this->count(DrawCall::SetLineWidth);
+	this->drawManager.setLineWidth(width);
+
+};
+
+
+void UIDrawManager::setLineStyle(MHWRender::MUIDrawManager::LineStyle style)
+{
+
+	this->count(DrawCall::SetLineStyle);
+	this->drawManager.setLineStyle(style);
+
+};
+
+
+void UIDrawManager::setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style)
+{
+
+	this->count(DrawCall::SetPaintStyle);
+	this->drawManager.setPaintStyle(style);
+
+};
+
+
+void UIDrawManager::setFontSize(unsigned int fontSize)
+{
+
+	this->count(DrawCall::SetFontSize);
+	this->drawManager.setFontSize(fontSize);
+
+};
+
+
+void UIDrawManager::mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal, const MColorArray* color)
+{
+
+	this->count(DrawCall::Mesh);
+	this->tally(position.length(), AbstractDrawManager::primitiveCount(mode, position.length()));
+	this->drawManager.mesh(mode, position, normal, color);
+
+};
+
+
+void UIDrawManager::lineList(const MPointArray& points, bool draw2D)
+{
+
+	this->count(DrawCall::LineList);
+	this->tally(points.length(), points.length() / 2);
+	this->drawManager.lineList(points, draw2D);
+
+};
+
+
+void UIDrawManager::line(const MPoint& startPoint, const MPoint& endPoint)
+{
+
+	this->count(DrawCall::Line);
+	this->tally(2, 1);
+	this->drawManager.line(startPoint, endPoint);
+
+};
+
+
+void UIDrawManager::sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled)
+{
+
+	this->count(DrawCall::Sphere);
+	this->tally(subdivisionsAxis * subdivisionsHeight, 2 * subdivisionsAxis * subdivisionsHeight);
+	this->drawManager.sphere(center, radius, subdivisionsAxis, subdivisionsHeight, filled);
+
+};
+
+
+void UIDrawManager::text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment)
+{
+
+	this->count(DrawCall::Text);
+	this->tally(1, 1);
+	this->drawManager.text(position, text, alignment);
+
+};
+
+
+void UIDrawManager::icon(const MPoint& position, const MString& name, float scale)
+{
+
+	this->count(DrawCall::Icon);
+	this->tally(1, 1);
+	this->drawManager.icon(position, name, scale);
+
+};
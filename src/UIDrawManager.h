@@ -0,0 +1,53 @@
+#ifndef _UI_DRAW_MANAGER
+#define _UI_DRAW_MANAGER
+//
+// File: UIDrawManager.h
+//
+// Author: Ben Singleton
+//
+
+#include "AbstractDrawManager.h"
+
+
+namespace Drawable
+{
+
+	class UIDrawManager : public AbstractDrawManager
+	/**
+	Forwards all draw calls to the viewport's MHWRender::MUIDrawManager.
+	*/
+	{
+
+	public:
+
+							UIDrawManager(MHWRender::MUIDrawManager& drawManager);
+		virtual				~UIDrawManager();
+
+		virtual	void		beginDrawable();
+		virtual	void		endDrawable();
+
+		virtual	void		beginDrawInXray();
+		virtual	void		endDrawInXray();
+
+		virtual	void		setColor(const MColor& color);
+		virtual	void		setDepthPriority(unsigned int priority);
+		virtual	void		setLineWidth(float width);
+		virtual	void		setLineStyle(MHWRender::MUIDrawManager::LineStyle style);
+		virtual	void		setPaintStyle(MHWRender::MUIDrawManager::PaintStyle style);
+		virtual	void		setFontSize(unsigned int fontSize);
+
+		virtual	void		mesh(MHWRender::MUIDrawManager::Primitive mode, const MPointArray& position, const MVectorArray* normal = nullptr, const MColorArray* color = nullptr);
+		virtual	void		lineList(const MPointArray& points, bool draw2D);
+		virtual	void		line(const MPoint& startPoint, const MPoint& endPoint);
+		virtual	void		sphere(const MPoint& center, double radius, unsigned int subdivisionsAxis, unsigned int subdivisionsHeight, bool filled);
+		virtual	void		text(const MPoint& position, const MString& text, MHWRender::MUIDrawManager::TextAlignment alignment);
+		virtual	void		icon(const MPoint& position, const MString& name, float scale);
+
+	protected:
+
+			MHWRender::MUIDrawManager&	drawManager;
+
+	};
+
+};
+#endif
@@ -6,11 +6,27 @@
 
 #include "PointHelperNode.h"
 #include "PointHelperDrawOverride.h"
+#include "PointHelperGeometryOverride.h"
+#include "PointHelperArrayNode.h"
+#include "PointHelperArrayDrawOverride.h"
+#include "PointHelperBenchmarkCommand.h"
+#include "PointHelperStatsCommand.h"
+#include "PointHelperTraceCommand.h"
+#include "PointHelperMemoryCommand.h"
+#include "PointHelperStressCommand.h"
+#include "PointHelperCreateCommand.h"
+#include "PointHelperEditCommand.h"
+#include "PointHelperImportCommand.h"
+#include "PointHelperExportCommand.h"
+#include "GeometryCache.h"
 
 #include <maya/MFnPlugin.h>
 #include <maya/MDrawRegistry.h>
 
 
+static bool GEOMETRY_OVERRIDE_REGISTERED = false;
+
+
 MStatus initializePlugin(MObject obj) 
 { 
 
@@ -27,7 +43,50 @@ MStatus initializePlugin(MObject obj)
 
 	}
 
-	status = MHWRender::MDrawRegistry::registerDrawOverrideCreator(PointHelper::drawDbClassification, PointHelper::drawRegistrantId, PointHelperDrawOverride::creator);
+	// The retained geometry override replaces the draw override when enabled
+	//
+	if (PointHelperGeometryOverride::isEnabled())
+	{
+
+		status = MHWRender::MDrawRegistry::registerGeometryOverrideCreator(PointHelper::drawDbClassification, PointHelper::drawRegistrantId, PointHelperGeometryOverride::creator);
+
+		if (!status)
+		{
+
+			status.perror("registerGeometryOverrideCreator");
+			return status;
+
+		}
+
+		GEOMETRY_OVERRIDE_REGISTERED = true;
+
+	}
+	else
+	{
+
+		status = MHWRender::MDrawRegistry::registerDrawOverrideCreator(PointHelper::drawDbClassification, PointHelper::drawRegistrantId, PointHelperDrawOverride::creator);
+
+		if (!status) 
+		{
+
+			status.perror("registerDrawOverrideCreator");
+			return status;
+
+		}
+
+	}
+
+	status = plugin.registerNode("pointHelperArray", PointHelperArray::id, &PointHelperArray::creator, &PointHelperArray::initialize, MPxNode::kLocatorNode, &PointHelperArray::drawDbClassification);
+	
+	if (!status) 
+	{
+
+		status.perror("registerNode");
+		return status;
+
+	}
+
+	status = MHWRender::MDrawRegistry::registerDrawOverrideCreator(PointHelperArray::drawDbClassification, PointHelperArray::drawRegistrantId, PointHelperArrayDrawOverride::creator);
 
 	if (!status) 
 	{
@@ -37,6 +96,115 @@ MStatus initializePlugin(MObject obj)
 
 	}
 
+	status = plugin.registerCommand(PointHelperBenchmarkCommand::commandName, PointHelperBenchmarkCommand::creator, PointHelperBenchmarkCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperStatsCommand::commandName, PointHelperStatsCommand::creator, PointHelperStatsCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperTraceCommand::commandName, PointHelperTraceCommand::creator, PointHelperTraceCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperMemoryCommand::commandName, PointHelperMemoryCommand::creator, PointHelperMemoryCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperStressCommand::commandName, PointHelperStressCommand::creator, PointHelperStressCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperCreateCommand::commandName, PointHelperCreateCommand::creator, PointHelperCreateCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperEditCommand::commandName, PointHelperEditCommand::creator, PointHelperEditCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = plugin.registerCommand(PointHelperImportCommand::commandName, PointHelperImportCommand::creator, PointHelperImportCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+	status = plugin.registerCommand(PointHelperExportCommand::commandName, PointHelperExportCommand::creator, PointHelperExportCommand::newSyntax);
+
+	if (!status) 
+	{
+
+		status.perror("registerCommand");
+		return status;
+
+	}
+
+	status = PointHelperProfiler::registerCategory();
+
+	if (!status) 
+	{
+
+		status.perror("registerCategory");
+		return status;
+
+	}
+
+	status = PointHelperStats::registerFrameCallback();
+
+	if (!status) 
+	{
+
+		status.perror("registerFrameCallback");
+		return status;
+
+	}
+
 	return status;
 
 }
@@ -46,17 +214,182 @@ MStatus uninitializePlugin(MObject obj)
 
 	MStatus   status;
 
-	status = MHWRender::MDrawRegistry::deregisterDrawOverrideCreator(PointHelper::drawDbClassification, PointHelper::drawRegistrantId);
+	status = PointHelperStats::setHudVisible(false);
 
 	if (!status) 
 	{
 
-		status.perror("deregisterDrawOverrideCreator");
+		status.perror("setHudVisible");
+		return status;
+
+	}
+
+	status = PointHelperStats::deregisterFrameCallback();
+
+	if (!status) 
+	{
+
+		status.perror("deregisterFrameCallback");
 		return status;
 
 	}
 
+	status = PointHelperProfiler::deregisterCategory();
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCategory");
+		return status;
+
+	}
+
+	PointHelperTracer::setEnabled(false);
+	Drawable::Library::AssetCache::clear();
+	Drawable::GeometryCache::clear();
+
 	MFnPlugin plugin(obj);
+	status = plugin.deregisterCommand(PointHelperExportCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperImportCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperEditCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperCreateCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperStressCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperMemoryCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperTraceCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperStatsCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = plugin.deregisterCommand(PointHelperBenchmarkCommand::commandName);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterCommand");
+		return status;
+
+	}
+
+	status = MHWRender::MDrawRegistry::deregisterDrawOverrideCreator(PointHelperArray::drawDbClassification, PointHelperArray::drawRegistrantId);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterDrawOverrideCreator");
+		return status;
+
+	}
+
+	status = plugin.deregisterNode(PointHelperArray::id);
+
+	if (!status) 
+	{
+
+		status.perror("deregisterNode");
+		return status;
+
+	}
+
+	if (GEOMETRY_OVERRIDE_REGISTERED)
+	{
+
+		status = MHWRender::MDrawRegistry::deregisterGeometryOverrideCreator(PointHelper::drawDbClassification, PointHelper::drawRegistrantId);
+
+		if (!status)
+		{
+
+			status.perror("deregisterGeometryOverrideCreator");
+			return status;
+
+		}
+
+		GEOMETRY_OVERRIDE_REGISTERED = false;
+
+	}
+	else
+	{
+
+		status = MHWRender::MDrawRegistry::deregisterDrawOverrideCreator(PointHelper::drawDbClassification, PointHelper::drawRegistrantId);
+
+		if (!status) 
+		{
+
+			status.perror("deregisterDrawOverrideCreator");
+			return status;
+
+		}
+
+	}
+
 	status = plugin.deregisterNode(PointHelper::id);
 
 	if (!status) 